@@ -3,6 +3,7 @@
 
 #include "DataStructures/ApplyMatrices.hpp"
 
+#include <algorithm>
 #include <array>
 #include <complex>
 #include <cstddef>
@@ -42,7 +43,6 @@ void do_transpose(const gsl::not_null<double*> result, const double* const data,
 }
 
 struct Scratch {
-  std::vector<double> buffer;
   double* a;
   double* b;
 };
@@ -51,7 +51,7 @@ struct Scratch {
 // applied in and gives the largest amount of space that could be
 // required for any application order.
 template <typename MatrixType, size_t Dim>
-Scratch get_scratch(const std::array<MatrixType, Dim>& matrices,
+size_t scratch_size(const std::array<MatrixType, Dim>& matrices,
                     const Index<Dim>& extents,
                     const size_t number_of_independent_components) noexcept {
   size_t size = number_of_independent_components;
@@ -64,11 +64,39 @@ Scratch get_scratch(const std::array<MatrixType, Dim>& matrices,
                        dereference_wrapper(matrix).columns());
     }
   }
-  Scratch result{};
-  result.buffer.resize(2 * size);
-  result.a = &result.buffer[0];
-  result.b = &result.buffer[size];
-  return result;
+  return size;
+}
+
+// The buffer is only grown, so it can be reused for all blocks of
+// components processed by a single call to `apply_matrices`.
+template <typename MatrixType, size_t Dim>
+Scratch get_scratch(const gsl::not_null<std::vector<double>*> buffer,
+                    const std::array<MatrixType, Dim>& matrices,
+                    const Index<Dim>& extents,
+                    const size_t number_of_independent_components) noexcept {
+  const size_t size =
+      scratch_size(matrices, extents, number_of_independent_components);
+  if (buffer->size() < 2 * size) {
+    buffer->resize(2 * size);
+  }
+  return {buffer->data(), &(*buffer)[size]};
+}
+
+// Target size (in doubles) of the scratch space used for one block of
+// independent components.  The intermediate results of applying the
+// matrices in each dimension to a block stay in the L2 cache instead
+// of being streamed through main memory once per dimension.
+constexpr size_t scratch_doubles_per_block = 16384;
+
+// The number of independent components to process together.  Always
+// at least one, even if a single component exceeds the target size.
+template <typename ElementType, typename MatrixType, size_t Dim>
+size_t components_per_block(const std::array<MatrixType, Dim>& matrices,
+                            const Index<Dim>& extents) noexcept {
+  constexpr size_t doubles_per_element = sizeof(ElementType) / sizeof(double);
+  const size_t doubles_per_component =
+      2 * doubles_per_element * scratch_size(matrices, extents, 1);
+  return std::max(size_t{1}, scratch_doubles_per_block / doubles_per_component);
 }
 
 // Produce the array of the number of rows in each matrix.  Empty
@@ -89,62 +117,74 @@ std::array<size_t, Dim> matrix_rows(const std::array<MatrixType, Dim>& matrices,
 }  // namespace
 
 namespace apply_matrices_detail {
+// Applies the matrices to a block of independent components.  The
+// boolean parameters record which of the matrices are the identity,
+// so that the corresponding multiplications can be skipped.
 template <typename ElementType, size_t Dim, bool... DimensionIsIdentity>
-template <typename MatrixType>
-void Impl<ElementType, Dim, DimensionIsIdentity...>::apply(
-    const gsl::not_null<ElementType*> result,
-    const std::array<MatrixType, Dim>& matrices, const ElementType* const data,
-    const Index<Dim>& extents,
-    const size_t number_of_independent_components) noexcept {
-  if (dereference_wrapper(matrices[sizeof...(DimensionIsIdentity)]) ==
-      Matrix{}) {
-    Impl<ElementType, Dim, DimensionIsIdentity..., true>::apply(
-        result, matrices, data, extents, number_of_independent_components);
-  } else {
-    Impl<ElementType, Dim, DimensionIsIdentity..., false>::apply(
-        result, matrices, data, extents, number_of_independent_components);
+struct ApplyBlock {
+  template <typename MatrixType>
+  static void apply(const gsl::not_null<ElementType*> result,
+                    const std::array<MatrixType, Dim>& matrices,
+                    const ElementType* const data, const Index<Dim>& extents,
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
+    if (dereference_wrapper(matrices[sizeof...(DimensionIsIdentity)]) ==
+        Matrix{}) {
+      ApplyBlock<ElementType, Dim, DimensionIsIdentity..., true>::apply(
+          result, matrices, data, extents, number_of_independent_components,
+          buffer);
+    } else {
+      ApplyBlock<ElementType, Dim, DimensionIsIdentity..., false>::apply(
+          result, matrices, data, extents, number_of_independent_components,
+          buffer);
+    }
   }
-}
+};
 
 template <typename ElementType>
-struct Impl<ElementType, 0> {
+struct ApplyBlock<ElementType, 0> {
   static constexpr const size_t Dim = 0;
   template <typename MatrixType>
   static void apply(const gsl::not_null<ElementType*> result,
                     const std::array<MatrixType, Dim>& /*matrices*/,
                     const ElementType* const data,
                     const Index<Dim>& /*extents*/,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*>
+                    /*buffer*/) noexcept {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     std::copy(data, data + number_of_independent_components, result.get());
   }
 };
 
 template <>
-struct Impl<double, 1, false> {
+struct ApplyBlock<double, 1, false> {
   static constexpr const size_t Dim = 1;
   template <typename MatrixType>
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*>
+                    /*buffer*/) noexcept {
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(result, &data_size, matrices[0], data);
   }
 };
 
 template <>
-struct Impl<std::complex<double>, 1, false> {
+struct ApplyBlock<std::complex<double>, 1, false> {
   static constexpr const size_t Dim = 1;
   template <typename MatrixType>
   static void apply(const gsl::not_null<std::complex<double>*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     size_t data_size = number_of_independent_components * extents.product() * 2;
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components * 2);
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
     // treat the complex values as an additional 'dimension' to transpose, a
@@ -160,13 +200,15 @@ struct Impl<std::complex<double>, 1, false> {
 };
 
 template <typename ElementType>
-struct Impl<ElementType, 1, true> {
+struct ApplyBlock<ElementType, 1, true> {
   static constexpr const size_t Dim = 1;
   template <typename MatrixType>
   static void apply(const gsl::not_null<ElementType*> result,
                     const std::array<MatrixType, Dim>& /*matrices*/,
                     const ElementType* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*>
+                    /*buffer*/) noexcept {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     std::copy(data, data + number_of_independent_components * extents.product(),
               result.get());
@@ -174,16 +216,17 @@ struct Impl<ElementType, 1, true> {
 };
 
 template <>
-struct Impl<double, 2, false, false> {
+struct ApplyBlock<double, 2, false, false> {
   static constexpr size_t Dim = 2;
   template <typename MatrixType>
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components);
 
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(scratch.a, &data_size, matrices[0], data);
@@ -195,17 +238,18 @@ struct Impl<double, 2, false, false> {
 };
 
 template <>
-struct Impl<std::complex<double>, 2, false, false> {
+struct ApplyBlock<std::complex<double>, 2, false, false> {
   static constexpr size_t Dim = 2;
   template <typename MatrixType>
   static void apply(const gsl::not_null<std::complex<double>*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components * 2);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -226,29 +270,32 @@ struct Impl<std::complex<double>, 2, false, false> {
 };
 
 template <>
-struct Impl<double, 2, false, true> {
+struct ApplyBlock<double, 2, false, true> {
   static constexpr size_t Dim = 2;
   template <typename MatrixType>
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*>
+                    /*buffer*/) noexcept {
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(result, &data_size, matrices[0], data);
   }
 };
 
 template <>
-struct Impl<std::complex<double>, 2, false, true> {
+struct ApplyBlock<std::complex<double>, 2, false, true> {
   static constexpr size_t Dim = 2;
   template <typename MatrixType>
   static void apply(const gsl::not_null<std::complex<double>*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components * 2);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -266,16 +313,17 @@ struct Impl<std::complex<double>, 2, false, true> {
 };
 
 template <>
-struct Impl<double, 2, true, false> {
+struct ApplyBlock<double, 2, true, false> {
   static constexpr size_t Dim = 2;
   template <typename MatrixType>
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components);
 
     size_t data_size = number_of_independent_components * extents.product();
     do_transpose(scratch.b, data, data_size, rows[0]);
@@ -286,17 +334,18 @@ struct Impl<double, 2, true, false> {
 };
 
 template <>
-struct Impl<std::complex<double>, 2, true, false> {
+struct ApplyBlock<std::complex<double>, 2, true, false> {
   static constexpr size_t Dim = 2;
   template <typename MatrixType>
   static void apply(const gsl::not_null<std::complex<double>*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components * 2);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -316,13 +365,15 @@ struct Impl<std::complex<double>, 2, true, false> {
 };
 
 template <typename ElementType>
-struct Impl<ElementType, 2, true, true> {
+struct ApplyBlock<ElementType, 2, true, true> {
   static constexpr size_t Dim = 2;
   template <typename MatrixType>
   static void apply(const gsl::not_null<ElementType*> result,
                     const std::array<MatrixType, Dim>& /*matrices*/,
                     const ElementType* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*>
+                    /*buffer*/) noexcept {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     std::copy(data, data + number_of_independent_components * extents.product(),
               result.get());
@@ -330,16 +381,17 @@ struct Impl<ElementType, 2, true, true> {
 };
 
 template <>
-struct Impl<double, 3, false, false, false> {
+struct ApplyBlock<double, 3, false, false, false> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components);
 
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(scratch.a, &data_size, matrices[0], data);
@@ -353,17 +405,18 @@ struct Impl<double, 3, false, false, false> {
 };
 
 template <>
-struct Impl<std::complex<double>, 3, false, false, false> {
+struct ApplyBlock<std::complex<double>, 3, false, false, false> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<std::complex<double>*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components * 2);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -386,16 +439,17 @@ struct Impl<std::complex<double>, 3, false, false, false> {
 };
 
 template <>
-struct Impl<double, 3, false, false, true> {
+struct ApplyBlock<double, 3, false, false, true> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components);
 
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(scratch.a, &data_size, matrices[0], data);
@@ -407,17 +461,18 @@ struct Impl<double, 3, false, false, true> {
 };
 
 template <>
-struct Impl<std::complex<double>, 3, false, false, true> {
+struct ApplyBlock<std::complex<double>, 3, false, false, true> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<std::complex<double>*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components * 2);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -438,16 +493,17 @@ struct Impl<std::complex<double>, 3, false, false, true> {
 };
 
 template <>
-struct Impl<double, 3, false, true, false> {
+struct ApplyBlock<double, 3, false, true, false> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components);
 
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(scratch.a, &data_size, matrices[0], data);
@@ -459,17 +515,18 @@ struct Impl<double, 3, false, true, false> {
 };
 
 template <>
-struct Impl<std::complex<double>, 3, false, true, false> {
+struct ApplyBlock<std::complex<double>, 3, false, true, false> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<std::complex<double>*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components * 2);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -490,29 +547,32 @@ struct Impl<std::complex<double>, 3, false, true, false> {
 };
 
 template <>
-struct Impl<double, 3, false, true, true> {
+struct ApplyBlock<double, 3, false, true, true> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*>
+                    /*buffer*/) noexcept {
     size_t data_size = number_of_independent_components * extents.product();
     multiply_in_first_dimension(result, &data_size, matrices[0], data);
   }
 };
 
 template <>
-struct Impl<std::complex<double>, 3, false, true, true> {
+struct ApplyBlock<std::complex<double>, 3, false, true, true> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<std::complex<double>*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components * 2);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -530,16 +590,17 @@ struct Impl<std::complex<double>, 3, false, true, true> {
 };
 
 template <>
-struct Impl<double, 3, true, false, false> {
+struct ApplyBlock<double, 3, true, false, false> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components);
 
     size_t data_size = number_of_independent_components * extents.product();
     do_transpose(scratch.b, data, data_size, rows[0]);
@@ -552,17 +613,18 @@ struct Impl<double, 3, true, false, false> {
 };
 
 template <>
-struct Impl<std::complex<double>, 3, true, false, false> {
+struct ApplyBlock<std::complex<double>, 3, true, false, false> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<std::complex<double>*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components * 2);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -584,16 +646,17 @@ struct Impl<std::complex<double>, 3, true, false, false> {
 };
 
 template <>
-struct Impl<double, 3, true, false, true> {
+struct ApplyBlock<double, 3, true, false, true> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components);
 
     size_t data_size = number_of_independent_components * extents.product();
     do_transpose(scratch.b, data, data_size, rows[0]);
@@ -604,17 +667,18 @@ struct Impl<double, 3, true, false, true> {
 };
 
 template <>
-struct Impl<std::complex<double>, 3, true, false, true> {
+struct ApplyBlock<std::complex<double>, 3, true, false, true> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<std::complex<double>*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components * 2);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -634,16 +698,17 @@ struct Impl<std::complex<double>, 3, true, false, true> {
 };
 
 template <>
-struct Impl<double, 3, true, true, false> {
+struct ApplyBlock<double, 3, true, true, false> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<double*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components);
 
     size_t data_size = number_of_independent_components * extents.product();
     do_transpose(scratch.b, data, data_size, rows[0] * rows[1]);
@@ -654,17 +719,18 @@ struct Impl<double, 3, true, true, false> {
 };
 
 template <>
-struct Impl<std::complex<double>, 3, true, true, false> {
+struct ApplyBlock<std::complex<double>, 3, true, true, false> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<std::complex<double>*> result,
                     const std::array<MatrixType, Dim>& matrices,
                     const std::complex<double>* const data,
                     const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*> buffer) noexcept {
     const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components * 2);
+    auto scratch = get_scratch(buffer, matrices, extents,
+                               number_of_independent_components * 2);
 
     // complex values will be treated as pairs of doubles for the LAPACK call,
     // as we will typically be applying a real matrix to a complex vector. To
@@ -684,19 +750,54 @@ struct Impl<std::complex<double>, 3, true, true, false> {
 };
 
 template <typename ElementType>
-struct Impl<ElementType, 3, true, true, true> {
+struct ApplyBlock<ElementType, 3, true, true, true> {
   static constexpr size_t Dim = 3;
   template <typename MatrixType>
   static void apply(const gsl::not_null<ElementType*> result,
                     const std::array<MatrixType, Dim>& /*matrices*/,
                     const ElementType* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+                    const size_t number_of_independent_components,
+                    const gsl::not_null<std::vector<double>*>
+                    /*buffer*/) noexcept {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     std::copy(data, data + number_of_independent_components * extents.product(),
               result.get());
   }
 };
 
+template <typename ElementType, size_t Dim, bool... DimensionIsIdentity>
+template <typename MatrixType>
+void Impl<ElementType, Dim, DimensionIsIdentity...>::apply(
+    const gsl::not_null<ElementType*> result,
+    const std::array<MatrixType, Dim>& matrices, const ElementType* const data,
+    const Index<Dim>& extents,
+    const size_t number_of_independent_components) noexcept {
+  static_assert(sizeof...(DimensionIsIdentity) == 0,
+                "Only the entry point of apply_matrices should be used.");
+  // The independent components are the slowest-varying index of both
+  // the input and the result, so each block of components is a
+  // contiguous chunk of both.  Processing the components in blocks
+  // keeps the intermediate results for all dimensions in cache and
+  // reuses the same scratch buffer for every block.
+  const size_t block_size =
+      components_per_block<ElementType>(matrices, extents);
+  const size_t source_points = extents.product();
+  const size_t result_points = result_size(matrices, extents);
+  std::vector<double> buffer{};
+  for (size_t first_component = 0;
+       first_component < number_of_independent_components;
+       first_component += block_size) {
+    ApplyBlock<ElementType, Dim>::apply(
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        result.get() + first_component * result_points, matrices,
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        data + first_component * source_points, extents,
+        std::min(block_size,
+                 number_of_independent_components - first_component),
+        make_not_null(&buffer));
+  }
+}
+
 #define ELEMENTTYPE(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define DIM(data) BOOST_PP_TUPLE_ELEM(1, data)
 #define MATRIX(data) BOOST_PP_TUPLE_ELEM(2, data)
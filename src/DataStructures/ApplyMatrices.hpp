@@ -58,6 +58,10 @@ size_t result_size(const std::array<MatrixType, Dim>& matrices,
 /// will be treated as the identity, but the matrix multiplications
 /// will be skipped for increased efficiency.
 ///
+/// The independent components are processed in blocks small enough
+/// that the intermediate results for all dimensions stay in cache, so
+/// the data is not streamed through main memory once per dimension.
+///
 /// \note The element type stored in the vectors to be transformed may be either
 /// `double` or `std::complex<double>`. The matrix, however, must be real. In
 /// the case of acting on a vector of complex values, the matrix is treated as
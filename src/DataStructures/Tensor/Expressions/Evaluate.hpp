@@ -6,12 +6,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <blaze/math/Subvector.h>
+#include <cstddef>
 #include <type_traits>
 
 #include "DataStructures/Tensor/Expressions/LhsTensorSymmAndIndices.hpp"
 #include "DataStructures/Tensor/Expressions/TensorExpression.hpp"
 #include "DataStructures/Tensor/Structure.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/VectorImpl.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 
@@ -36,6 +40,64 @@ constexpr bool contains_indices_to_contract(
     return false;
   }
 }
+
+/// The number of grid points of the tiles in which the components of a tensor
+/// expression of vectors are evaluated (see `evaluate_components_tiled`).
+/// 256 doubles take up 2 KiB per component, so the operand components of
+/// typical expressions stay in the L1 and L2 caches while all LHS components
+/// of a tile are computed.
+constexpr size_t evaluate_tile_size = 256;
+
+template <typename... LhsTensorIndices, typename LhsTensor, typename RhsTE>
+void evaluate_components(const gsl::not_null<LhsTensor*> lhs_tensor,
+                         const RhsTE& rhs_tensorexpression) {
+  for (size_t i = 0; i < LhsTensor::size(); i++) {
+    (*lhs_tensor)[i] =
+        rhs_tensorexpression.template get<LhsTensorIndices...>(
+            LhsTensor::structure::get_canonical_tensor_index(i));
+  }
+}
+
+/*!
+ * \brief Evaluate the components of a tensor expression of vectors in tiles of
+ * `evaluate_tile_size` grid points
+ *
+ * \details Evaluating the LHS components one after another as full-length
+ * vector expressions reads every RHS operand component from memory once for
+ * every LHS component it contributes to, e.g. once per LHS component in a
+ * contraction. Instead, all LHS components are computed for one tile of grid
+ * points before moving on to the next tile, so the RHS operand components are
+ * read from memory once and then reused from the cache. Each tile is evaluated
+ * by the vectorized Blaze kernels on subvectors of the operands.
+ */
+template <typename... LhsTensorIndices, typename LhsTensor, typename RhsTE>
+void evaluate_components_tiled(const gsl::not_null<LhsTensor*> lhs_tensor,
+                               const RhsTE& rhs_tensorexpression) {
+  const size_t number_of_grid_points =
+      rhs_tensorexpression
+          .template get<LhsTensorIndices...>(
+              LhsTensor::structure::get_canonical_tensor_index(0))
+          .size();
+  // A single tile gains nothing over evaluating the full vectors
+  if (number_of_grid_points <= evaluate_tile_size) {
+    evaluate_components<LhsTensorIndices...>(lhs_tensor, rhs_tensorexpression);
+    return;
+  }
+  for (size_t i = 0; i < LhsTensor::size(); i++) {
+    (*lhs_tensor)[i].destructive_resize(number_of_grid_points);
+  }
+  for (size_t offset = 0; offset < number_of_grid_points;
+       offset += evaluate_tile_size) {
+    const size_t tile_size =
+        std::min(evaluate_tile_size, number_of_grid_points - offset);
+    for (size_t i = 0; i < LhsTensor::size(); i++) {
+      blaze::subvector((*lhs_tensor)[i], offset, tile_size) = blaze::subvector(
+          rhs_tensorexpression.template get<LhsTensorIndices...>(
+              LhsTensor::structure::get_canonical_tensor_index(i)),
+          offset, tile_size);
+    }
+  }
+}
 }  // namespace detail
 
 /*!
@@ -56,6 +118,13 @@ constexpr bool contains_indices_to_contract(
  * may not be preserved by the RHS expression's order of operations, which
  * depends on how the expression is written and implemented.
  *
+ * If the tensors hold vectors, such as `DataVector`s, all LHS components are
+ * evaluated for a tile of grid points before moving on to the next tile, so the
+ * RHS components are read from memory only once (see
+ * `detail::evaluate_components_tiled`). As for any component-wise evaluation,
+ * the LHS tensor must not be an operand of the RHS expression unless each LHS
+ * component only depends on the same component of the RHS operand.
+ *
  * ### Example usage
  * Given two rank 2 Tensors `R` and `S` with index order (a, b), add them
  * together and fill the provided resultant LHS Tensor `L` with index order
@@ -125,13 +194,13 @@ void evaluate(
       "The index list of the LHS tensor does not match the index list of the "
       "evaluated RHS expression.");
 
-  using lhs_tensor_type = typename std::decay_t<decltype(*lhs_tensor)>;
-
-  for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
-    (*lhs_tensor)[i] =
-        rhs_tensorexpression
-            .template get<std::decay_t<decltype(LhsTensorIndices)>...>(
-                lhs_tensor_type::structure::get_canonical_tensor_index(i));
+  if constexpr (is_derived_of_vector_impl_v<X>) {
+    detail::evaluate_components_tiled<
+        std::decay_t<decltype(LhsTensorIndices)>...>(lhs_tensor,
+                                                     rhs_tensorexpression);
+  } else {
+    detail::evaluate_components<std::decay_t<decltype(LhsTensorIndices)>...>(
+        lhs_tensor, rhs_tensorexpression);
   }
 }
 
@@ -3,10 +3,13 @@
 
 #include "DataStructures/Tensor/TensorData.hpp"
 
+#include <functional>
 #include <ostream>
 #include <pup.h>
 #include <pup_stl.h>
 
+#include "Utilities/Numeric.hpp"
+
 void TensorComponent::pup(PUP::er& p) noexcept {
   p | name;
   p | data;
@@ -36,3 +39,15 @@ void ElementVolumeData::pup(PUP::er& p) noexcept {
   p | quadrature;
   p | basis;
 }
+
+size_t ContiguousElementVolumeData::number_of_grid_points() const noexcept {
+  return alg::accumulate(extents, size_t{1}, std::multiplies<>{});
+}
+
+void ContiguousElementVolumeData::pup(PUP::er& p) noexcept {
+  p | grid_name;
+  p | extents;
+  p | components;
+  p | basis;
+  p | quadrature;
+}
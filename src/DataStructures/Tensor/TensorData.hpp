@@ -86,3 +86,39 @@ struct ElementVolumeData : ExtentsAndTensorVolumeData {
   std::vector<Spectral::Basis> basis{};
   std::vector<Spectral::Quadrature> quadrature{};
 };
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief The tensor components on an element, stored contiguously and without
+ * their names.
+ *
+ * The names and the order of the tensor components are the same for all
+ * elements of a volume observation, so they are kept once for all elements
+ * (see `observers::VolumeDataSchema`) instead of with the data of each element.
+ * Component `i` occupies the grid points `[i * N, (i + 1) * N)` of
+ * `components`, where `N` is the number of grid points given by the `extents`.
+ * The `grid_name` identifies the element in the file, e.g. the output of the
+ * stream operator of its `ElementId`.
+ */
+struct ContiguousElementVolumeData {
+  ContiguousElementVolumeData() = default;
+  ContiguousElementVolumeData(
+      std::string grid_name_in, std::vector<size_t> extents_in,
+      DataVector components_in, std::vector<Spectral::Basis> basis_in,
+      std::vector<Spectral::Quadrature> quadrature_in) noexcept
+      : grid_name(std::move(grid_name_in)),
+        extents(std::move(extents_in)),
+        components(std::move(components_in)),
+        basis(std::move(basis_in)),
+        quadrature(std::move(quadrature_in)) {}
+
+  /// The number of grid points of each tensor component
+  size_t number_of_grid_points() const noexcept;
+
+  void pup(PUP::er& p) noexcept;  // NOLINT
+  std::string grid_name{};
+  std::vector<size_t> extents{};
+  DataVector components{};
+  std::vector<Spectral::Basis> basis{};
+  std::vector<Spectral::Quadrature> quadrature{};
+};
@@ -3,12 +3,18 @@
 
 #include "Domain/BlockLogicalCoordinates.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <optional>
+#include <type_traits>
 #include <vector>
 
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/Block.hpp"
+#include "Domain/BlockSearchGrid.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
 #include "Domain/Domain.hpp"  // IWYU pragma: keep
 #include "Domain/Structure/BlockId.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -21,6 +27,66 @@ using block_logical_coord_holder = std::optional<
     IdPair<domain::BlockId, tnsr::I<double, Dim, typename ::Frame::Logical>>>;
 using functions_of_time_type = std::unordered_map<
     std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>;
+
+// The coordinates of `x` in the grid frame of `block`
+template <size_t Dim, typename Frame>
+std::optional<tnsr::I<double, Dim, ::Frame::Grid>> grid_coordinates(
+    const Block<Dim>& block, const tnsr::I<double, Dim, Frame>& x,
+    const double time,
+    const functions_of_time_type& functions_of_time) noexcept {
+  if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+    if (block.is_time_dependent()) {
+      return block.moving_mesh_grid_to_inertial_map().inverse(
+          x, time, functions_of_time);
+    }
+  } else {
+    // Currently we only support Grid and Inertial frames in the
+    // block, so make sure Frame is ::Frame::Grid. (The
+    // Inertial case was handled above.)
+    static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                  "Cannot convert from given frame to Grid frame");
+    (void)block;
+    (void)time;
+    (void)functions_of_time;
+  }
+  // Either the point is already in the grid frame, or the map is
+  // time-independent, so the grid and inertial frames are the same.
+  tnsr::I<double, Dim, ::Frame::Grid> x_grid{};
+  for (size_t d = 0; d < Dim; ++d) {
+    x_grid.get(d) = x.get(d);
+  }
+  return x_grid;
+}
+
+// The logical coordinates of `x_grid` in `block`, if it is in the block
+template <size_t Dim>
+std::optional<tnsr::I<double, Dim, ::Frame::Logical>>
+logical_coordinates_in_block(
+    const Block<Dim>& block,
+    const tnsr::I<double, Dim, ::Frame::Grid>& x_grid) noexcept {
+  std::optional<tnsr::I<double, Dim, ::Frame::Logical>> x_logical{};
+  if (block.is_time_dependent()) {
+    // logical to grid map is time-independent.
+    x_logical = block.moving_mesh_logical_to_grid_map().inverse(x_grid);
+  } else {
+    tnsr::I<double, Dim, ::Frame::Inertial> x_inertial{};
+    for (size_t d = 0; d < Dim; ++d) {
+      x_inertial.get(d) = x_grid.get(d);
+    }
+    x_logical = block.stationary_map().inverse(x_inertial);
+  }
+  if (not x_logical.has_value()) {
+    return std::nullopt;
+  }
+  for (size_t d = 0; d < Dim; ++d) {
+    // Assumes that logical coordinates go from -1 to +1 in each
+    // dimension.
+    if (not(x_logical->get(d) >= -1.0 and x_logical->get(d) <= 1.0)) {
+      return std::nullopt;
+    }
+  }
+  return x_logical;
+}
 }  // namespace
 
 template <size_t Dim, typename Frame>
@@ -30,96 +96,80 @@ std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates(
     const functions_of_time_type& functions_of_time) noexcept {
   const size_t num_pts = get<0>(x).size();
   std::vector<block_logical_coord_holder<Dim>> block_coord_holders(num_pts);
+  const auto& blocks = domain.blocks();
+  const auto& search_grid = domain.block_search_grid();
+  if (blocks.empty()) {
+    return block_coord_holders;
+  }
+  // A point has the same grid-frame coordinates in all blocks if it is given
+  // in the grid frame, or if all blocks share their grid-to-inertial map.
+  bool blocks_share_grid_frame = true;
+  if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+    blocks_share_grid_frame = search_grid.blocks_share_grid_to_inertial_map();
+  }
+  // Otherwise the grid-frame coordinates of the point are computed once for
+  // each group of blocks with the same grid-to-inertial map, and stored at the
+  // index of the first block of the group.
+  std::vector<std::optional<tnsr::I<double, Dim, ::Frame::Grid>>>
+      x_grid_groups{};
+  std::vector<bool> x_grid_group_is_computed{};
+  if (not blocks_share_grid_frame) {
+    x_grid_groups.resize(blocks.size());
+    x_grid_group_is_computed.resize(blocks.size());
+  }
+
   for (size_t s = 0; s < num_pts; ++s) {
     tnsr::I<double, Dim, Frame> x_frame(0.0);
     for (size_t d = 0; d < Dim; ++d) {
       x_frame.get(d) = x.get(d)[s];
     }
-    tnsr::I<double, Dim, typename ::Frame::Logical> x_logical{};
     // Check which block this point is in. Each point will be in one
     // and only one block, unless it is on a shared boundary.  In that
     // case, choose the first matching block (and this block will have
-    // the smallest block_id).
-    for (const auto& block : domain.blocks()) {
-      if (block.is_time_dependent()) {
-        if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
-          // Point is in the inertial frame, so we need to map to the grid
-          // frame and then the logical frame.
-          const auto moving_inv =
-              block.moving_mesh_grid_to_inertial_map().inverse(
-                  x_frame, time, functions_of_time);
-          if (not moving_inv.has_value()) {
-            continue;
-          }
-          // logical to grid map is time-independent.
-          const auto inv = block.moving_mesh_logical_to_grid_map().inverse(
-              moving_inv.value());
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
+    // the smallest block_id).  Candidate blocks are therefore tried in
+    // order of increasing id, and the inverse maps are only called for
+    // blocks whose bounding boxes contain the point.
+    const auto is_in_block =
+        [&block_coord_holders, &search_grid, s](
+            const Block<Dim>& block,
+            const tnsr::I<double, Dim, ::Frame::Grid>& x_grid) noexcept {
+          if (not search_grid.bounding_box_contains(block.id(), x_grid)) {
+            return false;
           }
-        } else {  // frame is different than ::Frame::Inertial
-          // Currently 'time' is unused in this branch.
-          // To make the compiler happy, need to trick it to think that
-          // 'time' is used.
-          (void) time;
-          // Currently we only support Grid and Inertial frames in the
-          // block, so make sure Frame is ::Frame::Grid. (The
-          // Inertial case was handled above.)
-          static_assert(std::is_same_v<Frame, ::Frame::Grid>,
-                        "Cannot convert from given frame to Grid frame");
-
-          // Point is in the grid frame, just map to logical frame.
-          const auto inv =
-              block.moving_mesh_logical_to_grid_map().inverse(x_frame);
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
+          auto x_logical = logical_coordinates_in_block(block, x_grid);
+          if (not x_logical.has_value()) {
+            return false;
           }
-        }
-      } else {  // not block.is_time_dependent()
-        if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
-          const auto inv = block.stationary_map().inverse(x_frame);
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        } else {
-          // If the map is time-independent, then the grid and
-          // inertial frames are the same.  So if we are in the grid frame,
-          // convert to the inertial frame.  Otherwise throw a static_assert.
-          // Once we support more frames (e.g. distorted) this logic will
-          // change.
-          static_assert(std::is_same_v<Frame, ::Frame::Grid>,
-                        "Cannot convert from given frame to Grid frame");
-          tnsr::I<double, Dim, ::Frame::Inertial> x_inertial(0.0);
-          for (size_t d = 0; d < Dim; ++d) {
-            x_inertial.get(d) = x_frame.get(d);
-          }
-          const auto inv = block.stationary_map().inverse(x_inertial);
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        }
+          block_coord_holders[s] = make_id_pair(
+              domain::BlockId(block.id()), std::move(x_logical.value()));
+          return true;
+        };
+    if (blocks_share_grid_frame) {
+      const auto x_grid =
+          grid_coordinates(blocks.front(), x_frame, time, functions_of_time);
+      if (not x_grid.has_value()) {
+        continue;
       }
-      bool is_contained = true;
-      for (size_t d = 0; d < Dim; ++d) {
-        // Assumes that logical coordinates go from -1 to +1 in each
-        // dimension.
-        is_contained = is_contained and x_logical.get(d) >= -1.0 and
-                       x_logical.get(d) <= 1.0;
+      for (const size_t block_id : search_grid.candidate_blocks(*x_grid)) {
+        if (is_in_block(blocks[block_id], *x_grid)) {
+          break;
+        }
       }
-      if (is_contained) {
-        // Point is in this block.  Don't bother checking subsequent
-        // blocks.
-        block_coord_holders[s] =
-            make_id_pair(domain::BlockId(block.id()), std::move(x_logical));
-        break;
+    } else {
+      std::fill(x_grid_group_is_computed.begin(),
+                x_grid_group_is_computed.end(), false);
+      for (const auto& block : blocks) {
+        const size_t group =
+            search_grid.grid_to_inertial_map_group(block.id());
+        if (not x_grid_group_is_computed[group]) {
+          x_grid_groups[group] = grid_coordinates(blocks[group], x_frame,
+                                                  time, functions_of_time);
+          x_grid_group_is_computed[group] = true;
+        }
+        if (x_grid_groups[group].has_value() and
+            is_in_block(block, *x_grid_groups[group])) {
+          break;
+        }
       }
     }
   }
@@ -0,0 +1,262 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/BlockSearchGrid.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Block.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+
+namespace domain {
+namespace {
+// The number of logical points per dimension at which the maps are sampled
+constexpr size_t samples_per_dim = 9;
+
+// The grid-frame coordinates of the samples in `block`
+template <size_t Dim>
+std::array<DataVector, Dim> sample_block(
+    const Block<Dim>& block,
+    const tnsr::I<DataVector, Dim, Frame::Logical>& logical_samples) noexcept {
+  std::array<DataVector, Dim> result{};
+  if (block.is_time_dependent()) {
+    auto grid_samples =
+        block.moving_mesh_logical_to_grid_map()(logical_samples);
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(result, d) = std::move(grid_samples.get(d));
+    }
+  } else {
+    // The grid and inertial frames of a time-independent block coincide
+    auto inertial_samples = block.stationary_map()(logical_samples);
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(result, d) = std::move(inertial_samples.get(d));
+    }
+  }
+  return result;
+}
+}  // namespace
+
+template <size_t Dim>
+BlockSearchGrid<Dim>::BlockSearchGrid(
+    const std::vector<Block<Dim>>& blocks) noexcept
+    : lower_bounds_(blocks.size()), upper_bounds_(blocks.size()) {
+  size_t number_of_samples = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    number_of_samples *= samples_per_dim;
+  }
+  tnsr::I<DataVector, Dim, Frame::Logical> logical_samples(number_of_samples);
+  for (size_t s = 0; s < number_of_samples; ++s) {
+    size_t index = s;
+    for (size_t d = 0; d < Dim; ++d) {
+      logical_samples.get(d)[s] =
+          -1.0 + 2.0 * static_cast<double>(index % samples_per_dim) /
+                     static_cast<double>(samples_per_dim - 1);
+      index /= samples_per_dim;
+    }
+  }
+
+  auto union_lower_bounds =
+      make_array<Dim>(std::numeric_limits<double>::infinity());
+  auto union_upper_bounds =
+      make_array<Dim>(-std::numeric_limits<double>::infinity());
+  for (const auto& block : blocks) {
+    const size_t block_id = block.id();
+    ASSERT(block_id < blocks.size() and &blocks[block_id] == &block,
+           "The block with id " << block_id << " is not at that index");
+    const auto samples = sample_block(block, logical_samples);
+    auto& lower = lower_bounds_[block_id];
+    auto& upper = upper_bounds_[block_id];
+    bool is_finite = true;
+    for (size_t d = 0; d < Dim; ++d) {
+      const auto& samples_in_dim = gsl::at(samples, d);
+      is_finite = is_finite and
+                  std::all_of(samples_in_dim.begin(), samples_in_dim.end(),
+                              [](const double x) { return std::isfinite(x); });
+      gsl::at(lower, d) = *std::min_element(samples_in_dim.begin(),
+                                            samples_in_dim.end());
+      gsl::at(upper, d) = *std::max_element(samples_in_dim.begin(),
+                                            samples_in_dim.end());
+    }
+    if (not is_finite) {
+      lower = make_array<Dim>(-std::numeric_limits<double>::infinity());
+      upper = make_array<Dim>(std::numeric_limits<double>::infinity());
+      unbounded_blocks_.push_back(block_id);
+      continue;
+    }
+
+    // Pad the box by the largest distance between neighboring samples, which
+    // bounds how far the block bulges out between them for any reasonably
+    // smooth map.
+    double max_spacing_squared = 0.0;
+    size_t stride = 1;
+    for (size_t neighbor_dim = 0; neighbor_dim < Dim; ++neighbor_dim) {
+      for (size_t s = 0; s < number_of_samples; ++s) {
+        if ((s / stride) % samples_per_dim == samples_per_dim - 1) {
+          continue;
+        }
+        double spacing_squared = 0.0;
+        for (size_t d = 0; d < Dim; ++d) {
+          const auto& samples_in_dim = gsl::at(samples, d);
+          spacing_squared +=
+              square(samples_in_dim[s + stride] - samples_in_dim[s]);
+        }
+        max_spacing_squared = std::max(max_spacing_squared, spacing_squared);
+      }
+      stride *= samples_per_dim;
+    }
+    const double padding = sqrt(max_spacing_squared);
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(lower, d) -= padding;
+      gsl::at(upper, d) += padding;
+      gsl::at(union_lower_bounds, d) =
+          std::min(gsl::at(union_lower_bounds, d), gsl::at(lower, d));
+      gsl::at(union_upper_bounds, d) =
+          std::max(gsl::at(union_upper_bounds, d), gsl::at(upper, d));
+    }
+  }
+
+  if (unbounded_blocks_.size() < blocks.size()) {
+    // About two cells per block in each dimension
+    cells_per_dim_ = std::max(
+        static_cast<size_t>(1),
+        static_cast<size_t>(std::ceil(
+            2.0 * std::pow(static_cast<double>(blocks.size()), 1.0 / Dim))));
+    grid_lower_bounds_ = union_lower_bounds;
+    grid_upper_bounds_ = union_upper_bounds;
+    size_t number_of_cells = 1;
+    for (size_t d = 0; d < Dim; ++d) {
+      const double width =
+          gsl::at(grid_upper_bounds_, d) - gsl::at(grid_lower_bounds_, d);
+      gsl::at(inverse_cell_widths_, d) =
+          width > 0.0 ? static_cast<double>(cells_per_dim_) / width : 0.0;
+      number_of_cells *= cells_per_dim_;
+    }
+    cell_blocks_.resize(number_of_cells);
+    // Blocks are added in order of increasing id, so the list of each cell is
+    // sorted.
+    for (size_t block_id = 0; block_id < blocks.size(); ++block_id) {
+      std::array<size_t, Dim> first_cell{};
+      std::array<size_t, Dim> last_cell{};
+      for (size_t d = 0; d < Dim; ++d) {
+        gsl::at(first_cell, d) =
+            cell_index(d, gsl::at(lower_bounds_[block_id], d));
+        gsl::at(last_cell, d) =
+            cell_index(d, gsl::at(upper_bounds_[block_id], d));
+      }
+      std::array<size_t, Dim> cell = first_cell;
+      while (true) {
+        size_t flat_index = 0;
+        for (size_t d = Dim; d-- > 0;) {
+          flat_index = flat_index * cells_per_dim_ + gsl::at(cell, d);
+        }
+        cell_blocks_[flat_index].push_back(block_id);
+        size_t d = 0;
+        for (; d < Dim; ++d) {
+          if (gsl::at(cell, d) < gsl::at(last_cell, d)) {
+            ++gsl::at(cell, d);
+            break;
+          }
+          gsl::at(cell, d) = gsl::at(first_cell, d);
+        }
+        if (d == Dim) {
+          break;
+        }
+      }
+    }
+  }
+
+  update_grid_to_inertial_map_groups(blocks);
+}
+
+template <size_t Dim>
+void BlockSearchGrid<Dim>::update_grid_to_inertial_map_groups(
+    const std::vector<Block<Dim>>& blocks) noexcept {
+  grid_to_inertial_map_groups_.resize(blocks.size());
+  // The first block of each group
+  std::vector<size_t> groups{};
+  for (const auto& block : blocks) {
+    size_t group = block.id();
+    for (const size_t other_id : groups) {
+      const auto& other = blocks[other_id];
+      if (block.is_time_dependent() == other.is_time_dependent() and
+          (not block.is_time_dependent() or
+           block.moving_mesh_grid_to_inertial_map() ==
+               other.moving_mesh_grid_to_inertial_map())) {
+        group = other_id;
+        break;
+      }
+    }
+    if (group == block.id()) {
+      groups.push_back(group);
+    }
+    grid_to_inertial_map_groups_[block.id()] = group;
+  }
+  blocks_share_grid_to_inertial_map_ = groups.size() <= 1;
+}
+
+template <size_t Dim>
+const std::vector<size_t>& BlockSearchGrid<Dim>::candidate_blocks(
+    const tnsr::I<double, Dim, Frame::Grid>& x_grid) const noexcept {
+  if (cell_blocks_.empty()) {
+    return unbounded_blocks_;
+  }
+  size_t flat_index = 0;
+  for (size_t d = Dim; d-- > 0;) {
+    // Written so that a NaN coordinate is outside the grid
+    if (not(x_grid.get(d) >= gsl::at(grid_lower_bounds_, d) and
+            x_grid.get(d) <= gsl::at(grid_upper_bounds_, d))) {
+      return unbounded_blocks_;
+    }
+    flat_index = flat_index * cells_per_dim_ + cell_index(d, x_grid.get(d));
+  }
+  return cell_blocks_[flat_index];
+}
+
+template <size_t Dim>
+bool BlockSearchGrid<Dim>::bounding_box_contains(
+    const size_t block_id,
+    const tnsr::I<double, Dim, Frame::Grid>& x_grid) const noexcept {
+  for (size_t d = 0; d < Dim; ++d) {
+    if (x_grid.get(d) < gsl::at(lower_bounds_[block_id], d) or
+        x_grid.get(d) > gsl::at(upper_bounds_[block_id], d)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <size_t Dim>
+size_t BlockSearchGrid<Dim>::cell_index(const size_t d,
+                                        const double x) const noexcept {
+  const double position =
+      (x - gsl::at(grid_lower_bounds_, d)) * gsl::at(inverse_cell_widths_, d);
+  if (not(position > 0.0)) {
+    return 0;
+  }
+  if (position >= static_cast<double>(cells_per_dim_)) {
+    return cells_per_dim_ - 1;
+  }
+  return static_cast<size_t>(position);
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data) template class BlockSearchGrid<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
+}  // namespace domain
@@ -0,0 +1,98 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+
+/// \cond
+template <size_t VolumeDim>
+class Block;
+namespace Frame {
+struct Grid;
+}  // namespace Frame
+/// \endcond
+
+namespace domain {
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief A spatial index over the blocks of a domain that finds the few blocks
+ * that may contain a point in the grid frame.
+ *
+ * \details The bounding box of each block in the grid frame is found by
+ * sampling its logical-to-grid map on a uniform grid of logical points, and is
+ * padded by the largest distance between neighboring samples so that it
+ * encloses the parts of the block that bulge out between the samples. A block
+ * whose map does not give finite values at all samples gets an unbounded box.
+ * The union of the bounded boxes is divided into a uniform grid of cells, and
+ * each cell lists the blocks whose boxes overlap it. Because the
+ * logical-to-grid maps are time-independent, the index never needs to be
+ * rebuilt when the functions of time change.
+ *
+ * The index also groups the blocks by their grid-to-inertial maps, so that the
+ * (time-dependent, and often expensive) inverse of a map shared by several
+ * blocks needs to be computed only once per point. All time-independent
+ * blocks are in the same group, because their grid and inertial frames
+ * coincide.
+ */
+template <size_t Dim>
+class BlockSearchGrid {
+ public:
+  BlockSearchGrid() = default;
+
+  /// \requires the id of each block to be its index in `blocks`
+  explicit BlockSearchGrid(const std::vector<Block<Dim>>& blocks) noexcept;
+
+  /// Regroups the blocks by their grid-to-inertial maps. Must be called when
+  /// a time-dependent map is injected into a block.
+  void update_grid_to_inertial_map_groups(
+      const std::vector<Block<Dim>>& blocks) noexcept;
+
+  /// The ids, in increasing order, of the blocks whose bounding boxes may
+  /// contain the point `x_grid`. Points in no block may have candidates.
+  const std::vector<size_t>& candidate_blocks(
+      const tnsr::I<double, Dim, Frame::Grid>& x_grid) const noexcept;
+
+  /// Whether the bounding box of the block `block_id` contains `x_grid`
+  bool bounding_box_contains(
+      size_t block_id,
+      const tnsr::I<double, Dim, Frame::Grid>& x_grid) const noexcept;
+
+  const std::array<double, Dim>& lower_bounds(size_t block_id) const noexcept {
+    return lower_bounds_[block_id];
+  }
+  const std::array<double, Dim>& upper_bounds(size_t block_id) const noexcept {
+    return upper_bounds_[block_id];
+  }
+
+  /// The smallest id of the blocks that have the same grid-to-inertial map as
+  /// the block `block_id`
+  size_t grid_to_inertial_map_group(size_t block_id) const noexcept {
+    return grid_to_inertial_map_groups_[block_id];
+  }
+
+  /// Whether all blocks have the same grid-to-inertial map, so that a point
+  /// has the same grid-frame coordinates for all of them
+  bool blocks_share_grid_to_inertial_map() const noexcept {
+    return blocks_share_grid_to_inertial_map_;
+  }
+
+ private:
+  size_t cell_index(size_t d, double x) const noexcept;
+
+  std::vector<std::array<double, Dim>> lower_bounds_{};
+  std::vector<std::array<double, Dim>> upper_bounds_{};
+  std::vector<size_t> unbounded_blocks_{};
+  size_t cells_per_dim_ = 0;
+  std::array<double, Dim> grid_lower_bounds_{};
+  std::array<double, Dim> grid_upper_bounds_{};
+  std::array<double, Dim> inverse_cell_widths_{};
+  std::vector<std::vector<size_t>> cell_blocks_{};
+  std::vector<size_t> grid_to_inertial_map_groups_{};
+  bool blocks_share_grid_to_inertial_map_ = true;
+};
+}  // namespace domain
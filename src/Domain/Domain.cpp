@@ -21,7 +21,7 @@ struct Logical;
 
 template <size_t VolumeDim>
 Domain<VolumeDim>::Domain(std::vector<Block<VolumeDim>> blocks) noexcept
-    : blocks_(std::move(blocks)) {}
+    : blocks_(std::move(blocks)), block_search_grid_(blocks_) {}
 
 template <size_t VolumeDim>
 Domain<VolumeDim>::Domain(
@@ -50,6 +50,7 @@ Domain<VolumeDim>::Domain(
                            std::move(boundary_conditions[i]));
     }
   }
+  block_search_grid_ = domain::BlockSearchGrid<VolumeDim>(blocks_);
 }
 
 template <size_t VolumeDim>
@@ -89,6 +90,7 @@ Domain<VolumeDim>::Domain(
                            std::move(boundary_conditions[i]));
     }
   }
+  block_search_grid_ = domain::BlockSearchGrid<VolumeDim>(blocks_);
 }
 
 template <size_t VolumeDim>
@@ -103,6 +105,9 @@ void Domain<VolumeDim>::inject_time_dependent_map_for_block(
                          << blocks_.size());
   blocks_[block_id].inject_time_dependent_map(
       std::move(moving_mesh_inertial_map));
+  // The grid frame of the block is unchanged, so only the grouping of the
+  // blocks by their grid-to-inertial maps needs to be updated.
+  block_search_grid_.update_grid_to_inertial_map_groups(blocks_);
 }
 
 template <size_t VolumeDim>
@@ -131,6 +136,9 @@ std::ostream& operator<<(std::ostream& os,
 template <size_t VolumeDim>
 void Domain<VolumeDim>::pup(PUP::er& p) noexcept {
   p | blocks_;
+  if (p.isUnpacking()) {
+    block_search_grid_ = domain::BlockSearchGrid<VolumeDim>(blocks_);
+  }
 }
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
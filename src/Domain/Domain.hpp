@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "Domain/Block.hpp"  // IWYU pragma: keep
+#include "Domain/BlockSearchGrid.hpp"
 #include "Domain/BoundaryConditions/BoundaryCondition.hpp"
 #include "Domain/DomainHelpers.hpp"
 #include "Domain/Structure/DirectionMap.hpp"
@@ -114,11 +115,18 @@ class Domain {
     return blocks_;
   }
 
+  /// The spatial index used to find the blocks that contain a point. It is
+  /// built from the blocks and is not serialized.
+  const domain::BlockSearchGrid<VolumeDim>& block_search_grid() const noexcept {
+    return block_search_grid_;
+  }
+
   // clang-tidy: google-runtime-references
   void pup(PUP::er& p) noexcept;  // NOLINT
 
  private:
   std::vector<Block<VolumeDim>> blocks_{};
+  domain::BlockSearchGrid<VolumeDim> block_search_grid_{};
 };
 
 template <size_t VolumeDim>
@@ -0,0 +1,152 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/ElementDistribution.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace domain {
+namespace {
+// Cuts the elements [first, last) along the curve into one contiguous piece
+// for each of the `weights`, with a cost of each piece that is proportional to
+// its weight, and returns the end of each piece. An element is added to a
+// piece if at least half of its cost fits.
+std::vector<size_t> cut_curve(const std::vector<double>& costs,
+                              const size_t first, const size_t last,
+                              const std::vector<size_t>& weights) noexcept {
+  const double total_cost =
+      std::accumulate(costs.begin() + static_cast<std::ptrdiff_t>(first),
+                      costs.begin() + static_cast<std::ptrdiff_t>(last), 0.);
+  const auto total_weight = static_cast<double>(
+      std::accumulate(weights.begin(), weights.end(), 0_st));
+  std::vector<size_t> piece_ends(weights.size());
+  size_t element = first;
+  double cost_so_far = 0.;
+  size_t weight_so_far = 0;
+  for (size_t piece = 0; piece < weights.size(); ++piece) {
+    weight_so_far += weights[piece];
+    if (piece + 1 == weights.size()) {
+      element = last;
+    } else {
+      const double target_cost =
+          total_cost * static_cast<double>(weight_so_far) / total_weight;
+      while (element < last and
+             cost_so_far + 0.5 * costs[element] <= target_cost) {
+        cost_so_far += costs[element];
+        ++element;
+      }
+    }
+    piece_ends[piece] = element;
+  }
+  return piece_ends;
+}
+}  // namespace
+
+template <size_t Dim>
+size_t z_curve_index(const ElementId<Dim>& element_id) noexcept {
+  size_t max_refinement_level = 0;
+  for (const auto& segment_id : element_id.segment_ids()) {
+    max_refinement_level =
+        std::max(max_refinement_level, segment_id.refinement_level());
+  }
+  ASSERT(Dim * max_refinement_level <= 8 * sizeof(size_t),
+         "The refinement of element " << element_id
+                                      << " is too high for a Z-curve index.");
+  std::array<size_t, Dim> coords{};
+  for (size_t d = 0; d < Dim; ++d) {
+    const auto& segment_id = gsl::at(element_id.segment_ids(), d);
+    gsl::at(coords, d) = segment_id.index()
+                         << (max_refinement_level -
+                             segment_id.refinement_level());
+  }
+  size_t result = 0;
+  for (size_t bit = max_refinement_level; bit-- > 0;) {
+    for (size_t d = 0; d < Dim; ++d) {
+      result = (result << 1) | ((gsl::at(coords, d) >> bit) & 1);
+    }
+  }
+  return result;
+}
+
+template <size_t Dim>
+BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
+    const std::vector<size_t>& procs_per_node,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents) noexcept {
+  ASSERT(initial_refinement_levels.size() == initial_extents.size(),
+         "Got refinement levels for " << initial_refinement_levels.size()
+                                      << " blocks, but extents for "
+                                      << initial_extents.size() << " blocks.");
+  ASSERT(not procs_per_node.empty() and
+             std::find(procs_per_node.begin(), procs_per_node.end(), 0_st) ==
+                 procs_per_node.end(),
+         "Every node must have at least one processor.");
+  std::vector<double> costs{};
+  for (size_t block_id = 0; block_id < initial_refinement_levels.size();
+       ++block_id) {
+    auto element_ids =
+        initial_element_ids(block_id, initial_refinement_levels[block_id]);
+    std::sort(element_ids.begin(), element_ids.end(),
+              [](const ElementId<Dim>& lhs, const ElementId<Dim>& rhs) {
+                return z_curve_index(lhs) < z_curve_index(rhs);
+              });
+    const auto& extents = initial_extents[block_id];
+    const auto cost = static_cast<double>(std::accumulate(
+        extents.begin(), extents.end(), 1_st, std::multiplies<>{}));
+    for (auto& element_id : element_ids) {
+      element_procs_.emplace_back(std::move(element_id), 0);
+      costs.push_back(cost);
+    }
+  }
+
+  const size_t number_of_procs =
+      std::accumulate(procs_per_node.begin(), procs_per_node.end(), 0_st);
+  proc_costs_.assign(number_of_procs, 0.);
+  const auto node_ends =
+      cut_curve(costs, 0, element_procs_.size(), procs_per_node);
+  size_t first_element_on_node = 0;
+  size_t first_proc_on_node = 0;
+  for (size_t node = 0; node < procs_per_node.size(); ++node) {
+    const auto proc_ends =
+        cut_curve(costs, first_element_on_node, node_ends[node],
+                  std::vector<size_t>(procs_per_node[node], 1));
+    size_t element = first_element_on_node;
+    for (size_t local_proc = 0; local_proc < procs_per_node[node];
+         ++local_proc) {
+      const size_t proc = first_proc_on_node + local_proc;
+      for (; element < proc_ends[local_proc]; ++element) {
+        element_procs_[element].second = proc;
+        proc_costs_[proc] += costs[element];
+      }
+    }
+    first_element_on_node = node_ends[node];
+    first_proc_on_node += procs_per_node[node];
+  }
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                            \
+  template size_t z_curve_index(const ElementId<DIM(data)>& element_id) \
+      noexcept;                                                         \
+  template class BlockZCurveProcDistribution<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
+}  // namespace domain
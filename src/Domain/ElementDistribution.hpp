@@ -0,0 +1,71 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+
+namespace domain {
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief The position of the element along a Morton (Z-order) curve through
+ * its block.
+ *
+ * The segment indices of the element are rescaled to the finest refinement
+ * level of the element in any dimension and their bits are interleaved, so
+ * elements that are close in the block are mostly close along the curve.
+ */
+template <size_t Dim>
+size_t z_curve_index(const ElementId<Dim>& element_id) noexcept;
+
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief Distribution of the initial elements over processors that keeps
+ * neighboring elements together and balances their cost.
+ *
+ * The elements are ordered block by block, and within each block along the
+ * Z-order curve (see `domain::z_curve_index`). The cost of an element is
+ * estimated by its number of grid points. The curve is first cut into one
+ * contiguous piece per node, with a cost that is proportional to the number of
+ * processors on the node, and the piece of each node is then cut into one
+ * contiguous piece per processor of similar cost. Therefore, most neighboring
+ * elements are on the same processor or node, so most of their communication
+ * doesn't leave the node, and elements with more grid points count for more
+ * when balancing the load.
+ *
+ * Processors are numbered consecutively over the nodes in the order of
+ * `procs_per_node`, which matches the numbering of Charm++ processing elements.
+ */
+template <size_t Dim>
+class BlockZCurveProcDistribution {
+ public:
+  /// \param procs_per_node The number of processors on each node
+  /// \param initial_refinement_levels The refinement levels of each block
+  /// \param initial_extents The number of grid points per dimension of the
+  /// elements in each block
+  BlockZCurveProcDistribution(
+      const std::vector<size_t>& procs_per_node,
+      const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+      const std::vector<std::array<size_t, Dim>>& initial_extents) noexcept;
+
+  /// All elements in order along the curve and the processor each is placed on
+  const std::vector<std::pair<ElementId<Dim>, size_t>>& element_procs()
+      const noexcept {
+    return element_procs_;
+  }
+
+  /// The estimated cost of the elements on each processor
+  const std::vector<double>& proc_costs() const noexcept {
+    return proc_costs_;
+  }
+
+ private:
+  std::vector<std::pair<ElementId<Dim>, size_t>> element_procs_{};
+  std::vector<double> proc_costs_{};
+};
+}  // namespace domain
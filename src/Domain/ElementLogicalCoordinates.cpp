@@ -3,6 +3,7 @@
 
 #include "Domain/ElementLogicalCoordinates.hpp"
 
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <unordered_map>
@@ -14,10 +15,12 @@
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/Structure/BlockId.hpp"    // IWYU pragma: keep
 #include "Domain/Structure/ElementId.hpp"  // IWYU pragma: keep
+#include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Structure/Side.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
-#include "Utilities/MakeArray.hpp"
 
 namespace {
 // Define this alias so we don't need to keep typing this monster.
@@ -38,6 +41,30 @@ element_logical_coordinates(const std::vector<ElementId<Dim>>& element_ids,
       element_ids.size());
   std::vector<std::vector<size_t>> offsets(element_ids.size());
 
+  // Index the elements by their ids, and record the refinement levels and
+  // grid indices that occur in each block, so the elements that may contain
+  // a point are found from its block logical coordinates instead of by
+  // checking every element.
+  std::unordered_map<ElementId<Dim>, size_t> element_indices{};
+  std::unordered_map<size_t,
+                     std::vector<std::pair<std::array<size_t, Dim>, size_t>>>
+      refinements_in_blocks{};
+  for (size_t index = 0; index < element_ids.size(); ++index) {
+    const auto& element_id = element_ids[index];
+    element_indices.emplace(element_id, index);
+    std::pair<std::array<size_t, Dim>, size_t> refinement{
+        {}, element_id.grid_index()};
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(refinement.first, d) =
+          gsl::at(element_id.segment_ids(), d).refinement_level();
+    }
+    auto& refinements_in_block = refinements_in_blocks[element_id.block_id()];
+    if (std::find(refinements_in_block.begin(), refinements_in_block.end(),
+                  refinement) == refinements_in_block.end()) {
+      refinements_in_block.push_back(std::move(refinement));
+    }
+  }
+
   // Loop over points
   for (size_t offset = 0; offset < block_coord_holders.size(); ++offset) {
     // Skip points that are not in any block.
@@ -47,39 +74,87 @@ element_logical_coordinates(const std::vector<ElementId<Dim>>& element_ids,
 
     const auto& block_id = block_coord_holders[offset].value().id;
     const auto& x_block_logical = block_coord_holders[offset].value().data;
-    // Need to loop over elements, because the block doesn't know
-    // things like the refinement_level of each element.
-    for (size_t index = 0; index < element_ids.size(); ++index) {
-      const auto& element_id = element_ids[index];
-      if (element_id.block_id() == block_id.get_index()) {
-        // This element is in this block; now check if the point is in
-        // this element.
-        bool is_contained = true;
-        auto x_elem = make_array<Dim>(0.0);
+    const auto refinements_in_block =
+        refinements_in_blocks.find(block_id.get_index());
+    if (refinements_in_block == refinements_in_blocks.end()) {
+      continue;
+    }
+    // A point on a boundary between elements is in all of them, in which
+    // case choose the element that comes first in `element_ids`.
+    size_t element_index = element_ids.size();
+    for (const auto& [refinement_levels, grid_index] :
+         refinements_in_block->second) {
+      // The (at most two) segments at this refinement that contain the point
+      // in each dimension
+      std::array<std::array<SegmentId, 2>, Dim> segments{};
+      std::array<size_t, Dim> number_of_segments{};
+      for (size_t d = 0; d < Dim; ++d) {
+        const size_t level = gsl::at(refinement_levels, d);
+        const size_t segments_in_block = two_to_the(level);
+        const double x_block_log = x_block_logical.get(d);
+        const double position =
+            0.5 * (x_block_log + 1.0) * static_cast<double>(segments_in_block);
+        const size_t nearest_index =
+            position > 0.0
+                ? std::min(segments_in_block - 1, static_cast<size_t>(position))
+                : 0;
+        // Also check the neighbors, which contain the point if it is on
+        // their shared endpoint.
+        for (size_t index = nearest_index > 0 ? nearest_index - 1 : 0;
+             index <= nearest_index + 1 and index < segments_in_block;
+             ++index) {
+          const SegmentId segment{level, index};
+          if (x_block_log >= segment.endpoint(Side::Lower) and
+              x_block_log <= segment.endpoint(Side::Upper) and
+              gsl::at(number_of_segments, d) < 2) {
+            gsl::at(gsl::at(segments, d), gsl::at(number_of_segments, d)++) =
+                segment;
+          }
+        }
+      }
+      if (alg::any_of(number_of_segments,
+                      [](const size_t number) { return number == 0; })) {
+        continue;
+      }
+      std::array<size_t, Dim> choice{};
+      while (true) {
+        std::array<SegmentId, Dim> segment_ids{};
         for (size_t d = 0; d < Dim; ++d) {
-          const double up =
-              gsl::at(element_id.segment_ids(), d).endpoint(Side::Upper);
-          const double lo =
-              gsl::at(element_id.segment_ids(), d).endpoint(Side::Lower);
-          const double x_block_log = x_block_logical.get(d);
-          if (x_block_log < lo or x_block_log > up) {
-            is_contained = false;
+          gsl::at(segment_ids, d) =
+              gsl::at(gsl::at(segments, d), gsl::at(choice, d));
+        }
+        const auto element = element_indices.find(
+            ElementId<Dim>{block_id.get_index(), segment_ids, grid_index});
+        if (element != element_indices.end()) {
+          element_index = std::min(element_index, element->second);
+        }
+        size_t d = 0;
+        for (; d < Dim; ++d) {
+          if (++gsl::at(choice, d) < gsl::at(number_of_segments, d)) {
             break;
           }
-          // Map to element coords
-          gsl::at(x_elem, d) = (2.0 * x_block_log - up - lo) / (up - lo);
+          gsl::at(choice, d) = 0;
         }
-        if (is_contained) {
-          for (size_t d = 0; d < Dim; ++d) {
-            gsl::at(x_element_logical[index], d).push_back(gsl::at(x_elem, d));
-          }
-          offsets[index].push_back(offset);
-          // Found a matching element, so we don't need to check other
-          // elements.
+        if (d == Dim) {
           break;
         }
       }
     }
+    if (element_index == element_ids.size()) {
+      continue;
+    }
+
+    const auto& element_id = element_ids[element_index];
+    for (size_t d = 0; d < Dim; ++d) {
+      const double up =
+          gsl::at(element_id.segment_ids(), d).endpoint(Side::Upper);
+      const double lo =
+          gsl::at(element_id.segment_ids(), d).endpoint(Side::Lower);
+      // Map to element coords
+      gsl::at(x_element_logical[element_index], d)
+          .push_back((2.0 * x_block_logical.get(d) - up - lo) / (up - lo));
+    }
+    offsets[element_index].push_back(offset);
   }
 
   // Now we know how many points are in each element, so we can
@@ -17,7 +17,6 @@
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
-#include "Utilities/MakeArray.hpp"
 
 namespace domain::FunctionsOfTime {
 template <size_t MaxDeriv>
@@ -47,12 +46,15 @@ PiecewisePolynomial<MaxDeriv>::func_and_derivs(const double t) const noexcept {
   const double dt = t - deriv_info_at_t.time;
   const value_type& coefs = deriv_info_at_t.derivs_coefs;
 
-  // initialize result for the number of derivs requested
-  std::array<DataVector, MaxDerivReturned + 1> result =
-      make_array<MaxDerivReturned + 1>(DataVector(coefs.back().size(), 0.0));
+  // initialize result for the number of derivs requested, allocating each
+  // DataVector only once
+  std::array<DataVector, MaxDerivReturned + 1> result{};
+  result[0] = coefs[MaxDeriv];
+  for (size_t k = 1; k < MaxDerivReturned + 1; ++k) {
+    gsl::at(result, k) = DataVector(coefs.back().size(), 0.0);
+  }
 
   // evaluate the polynomial using ddpoly (Numerical Recipes sec 5.1)
-  result[0] = coefs[MaxDeriv];
   for (size_t j = MaxDeriv; j-- > 0;) {
     const size_t min_deriv = std::min(MaxDerivReturned, MaxDeriv - j);
     for (size_t k = min_deriv; k > 0; k--) {
@@ -170,10 +172,27 @@ PiecewisePolynomial<MaxDeriv>::deriv_info_from_upper_bound(
     const double t) const noexcept {
   // this function assumes that the times in deriv_info_at_update_times is
   // sorted, which is enforced by the update function.
-
-  const auto upper_bound_deriv_info = std::upper_bound(
-      deriv_info_at_update_times_.begin(), deriv_info_at_update_times_.end(), t,
-      [](double t0, const DerivInfo& d) { return d.time > t0; });
+  const auto compare = [](const double t0, const DerivInfo& d) noexcept {
+    return d.time > t0;
+  };
+  const auto begin = deriv_info_at_update_times_.begin();
+
+  // Check the most recent updates first, since the function is usually
+  // evaluated near its expiration time. Only bisect the rest of the history
+  // if `t` precedes them.
+  constexpr size_t number_of_recent_updates = 2;
+  auto upper_bound_deriv_info = deriv_info_at_update_times_.end();
+  for (size_t i = 0; i < number_of_recent_updates and
+                     upper_bound_deriv_info != begin and
+                     std::prev(upper_bound_deriv_info)->time > t;
+       ++i) {
+    --upper_bound_deriv_info;
+  }
+  if (upper_bound_deriv_info != begin and
+      std::prev(upper_bound_deriv_info)->time > t) {
+    upper_bound_deriv_info =
+        std::upper_bound(begin, upper_bound_deriv_info, t, compare);
+  }
 
   if (upper_bound_deriv_info == deriv_info_at_update_times_.begin()) {
     // all elements of times are greater than t
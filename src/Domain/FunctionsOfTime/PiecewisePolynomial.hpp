@@ -117,6 +117,12 @@ class PiecewisePolynomial : public FunctionOfTime {
   /// The function throws an error if `t` is less than all DerivInfo update
   /// times. (unless `t` is just less than the earliest update time by roundoff,
   /// in which case it returns the DerivInfo at the earliest update time.)
+  ///
+  /// Since functions of time are mostly evaluated at times shortly before
+  /// their expiration, the most recent updates are checked first and the
+  /// full history is only searched if `t` precedes them. Therefore, the
+  /// lookup takes constant time in the common case, independent of the length
+  /// of the history.
   const DerivInfo& deriv_info_from_upper_bound(double t) const noexcept;
 
   std::vector<DerivInfo> deriv_info_at_update_times_;
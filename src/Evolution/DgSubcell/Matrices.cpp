@@ -4,6 +4,7 @@
 #include "Evolution/DgSubcell/Matrices.hpp"
 
 #include <array>
+#include <functional>
 #include <ostream>
 #include <utility>
 
@@ -19,6 +20,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
 #include "Utilities/Numeric.hpp"  // IWYU pragma: keep
 
 namespace evolution::dg::subcell::fd {
@@ -115,6 +117,19 @@ const Matrix& projection_matrix(const Mesh<Dim>& dg_mesh,
   };
 }
 
+template <size_t Dim>
+std::array<std::reference_wrapper<const Matrix>, Dim> projection_matrices(
+    const Mesh<Dim>& dg_mesh, const Index<Dim>& subcell_extents) noexcept {
+  const auto dg_mesh_slices = dg_mesh.slices();
+  auto result = make_array<Dim>(std::cref(projection_matrix(
+      dg_mesh_slices[0], Index<1>{subcell_extents[0]})));
+  for (size_t d = 1; d < Dim; ++d) {
+    gsl::at(result, d) = projection_matrix(gsl::at(dg_mesh_slices, d),
+                                           Index<1>{subcell_extents[d]});
+  }
+  return result;
+}
+
 double get_sixth_order_integration_coefficient(const size_t num_pts,
                                                const size_t index) noexcept {
   if (num_pts == 3) {
@@ -347,13 +362,111 @@ const Matrix& reconstruction_matrix(
   };
 }
 
+template <Spectral::Quadrature QuadratureType, size_t NumDgGridPoints1d>
+ReconstructionFactors reconstruction_factors_cache_impl_helper(
+    const size_t num_subcells) noexcept {
+  const Matrix& proj_matrix =
+      projection_matrix_cache_impl<QuadratureType, NumDgGridPoints1d>(
+          Index<1>{num_subcells});
+  // The subcells outnumber the DG points, so P^T P is invertible
+  Matrix inv_normal_matrix = blaze::trans(proj_matrix) * proj_matrix;
+  blaze::invert(inv_normal_matrix);
+  const DataVector& weights =
+      Spectral::quadrature_weights<Spectral::Basis::Legendre, QuadratureType>(
+          NumDgGridPoints1d);
+
+  ReconstructionFactors result{};
+  result.least_squares = inv_normal_matrix * blaze::trans(proj_matrix);
+  result.dg_weights = Matrix(1, NumDgGridPoints1d);
+  result.conservation_correction = Matrix(NumDgGridPoints1d, 1, 0.);
+  double normalization = 0.;
+  for (size_t i = 0; i < NumDgGridPoints1d; ++i) {
+    result.dg_weights(0, i) = weights[i];
+    for (size_t j = 0; j < NumDgGridPoints1d; ++j) {
+      result.conservation_correction(i, 0) +=
+          inv_normal_matrix(i, j) * weights[j];
+    }
+    normalization += weights[i] * result.conservation_correction(i, 0);
+  }
+  result.conservation_correction /= normalization;
+  result.subcell_weights = Matrix(1, num_subcells);
+  for (size_t i = 0; i < num_subcells; ++i) {
+    result.subcell_weights(0, i) =
+        2.0 / num_subcells *
+        get_sixth_order_integration_coefficient(num_subcells, i);
+  }
+  return result;
+}
+
+template <Spectral::Quadrature QuadratureType, size_t NumDgGridPoints>
+const ReconstructionFactors& reconstruction_factors_cache_impl(
+    const size_t num_subcells) noexcept {
+  static const ReconstructionFactors result =
+      reconstruction_factors_cache_impl_helper<QuadratureType,
+                                               NumDgGridPoints>(num_subcells);
+  return result;
+}
+
+template <Spectral::Quadrature QuadratureType, size_t... Is>
+const ReconstructionFactors& reconstruction_factors_impl(
+    const size_t num_dg_grid_points, const size_t num_subcells,
+    std::index_sequence<Is...> /*num_dg_grid_points*/) noexcept {
+  static const std::array<const ReconstructionFactors& (*)(size_t),
+                          sizeof...(Is)>
+      cache{{&reconstruction_factors_cache_impl<QuadratureType, Is>...}};
+  return gsl::at(cache, num_dg_grid_points)(num_subcells);
+}
+
+const ReconstructionFactors& reconstruction_factors_1d(
+    const Mesh<1>& dg_mesh, const size_t num_subcells) noexcept {
+  ASSERT(dg_mesh.basis(0) == Spectral::Basis::Legendre,
+         "FD Subcell reconstruction only supports Legendre basis right now.");
+  switch (dg_mesh.quadrature(0)) {
+    case Spectral::Quadrature::GaussLobatto:
+      return reconstruction_factors_impl<Spectral::Quadrature::GaussLobatto>(
+          dg_mesh.extents(0), num_subcells,
+          std::make_index_sequence<
+              Spectral::maximum_number_of_points<Spectral::Basis::Legendre> +
+              1>{});
+    case Spectral::Quadrature::Gauss:
+      return reconstruction_factors_impl<Spectral::Quadrature::Gauss>(
+          dg_mesh.extents(0), num_subcells,
+          std::make_index_sequence<
+              Spectral::maximum_number_of_points<Spectral::Basis::Legendre> +
+              1>{});
+    default:
+      ERROR("Unsupported quadrature type in FD subcell reconstruction");
+  };
+}
+
+template <size_t Dim>
+std::array<std::reference_wrapper<const ReconstructionFactors>, Dim>
+reconstruction_factors(const Mesh<Dim>& dg_mesh,
+                       const Index<Dim>& subcell_extents) noexcept {
+  const auto dg_mesh_slices = dg_mesh.slices();
+  auto result = make_array<Dim>(std::cref(
+      reconstruction_factors_1d(dg_mesh_slices[0], subcell_extents[0])));
+  for (size_t d = 1; d < Dim; ++d) {
+    gsl::at(result, d) = reconstruction_factors_1d(gsl::at(dg_mesh_slices, d),
+                                                   subcell_extents[d]);
+  }
+  return result;
+}
+
 #define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATION(r, data)                                           \
-  template const Matrix& projection_matrix(                              \
-      const Mesh<GET_DIM(data)>&, const Index<GET_DIM(data)>&) noexcept; \
-  template const Matrix& reconstruction_matrix(                          \
-      const Mesh<GET_DIM(data)>&, const Index<GET_DIM(data)>&) noexcept;
+#define INSTANTIATION(r, data)                                             \
+  template const Matrix& projection_matrix(                                \
+      const Mesh<GET_DIM(data)>&, const Index<GET_DIM(data)>&) noexcept;   \
+  template std::array<std::reference_wrapper<const Matrix>, GET_DIM(data)> \
+  projection_matrices(const Mesh<GET_DIM(data)>&,                          \
+                      const Index<GET_DIM(data)>&) noexcept;               \
+  template const Matrix& reconstruction_matrix(                            \
+      const Mesh<GET_DIM(data)>&, const Index<GET_DIM(data)>&) noexcept;   \
+  template std::array<std::reference_wrapper<const ReconstructionFactors>, \
+                      GET_DIM(data)>                                       \
+  reconstruction_factors(const Mesh<GET_DIM(data)>&,                       \
+                         const Index<GET_DIM(data)>&) noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
@@ -2,13 +2,16 @@
 // See LICENSE.txt for details.
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <functional>
+
+#include "DataStructures/Matrix.hpp"
 
 /// \cond
 class DataVector;
 template <size_t Dim>
 class Index;
-class Matrix;
 template <size_t Dim>
 class Mesh;
 /// \endcond
@@ -18,11 +21,28 @@ namespace evolution::dg::subcell::fd {
  * \ingroup DgSubcellGroup
  * \brief Computes the projection matrix in `Dim` dimensions going from a DG
  * mesh to a conservative finite difference subcell mesh.
+ *
+ * \note The full-volume matrix has \f$\mathcal{O}(N^{2\mathrm{Dim}})\f$
+ * entries, so `evolution::dg::subcell::fd::project` applies the
+ * `projection_matrices` instead.
  */
 template <size_t Dim>
 const Matrix& projection_matrix(const Mesh<Dim>& dg_mesh,
                                 const Index<Dim>& subcell_extents) noexcept;
 
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief The 1D projection matrices in every dimension, whose tensor product
+ * is the `projection_matrix`.
+ *
+ * Applying these matrices with `apply_matrices` projects to the subcells in
+ * \f$\mathcal{O}(N^{\mathrm{Dim}+1})\f$ operations for \f$N\f$ DG grid
+ * points per dimension, without forming the full-volume projection matrix.
+ */
+template <size_t Dim>
+std::array<std::reference_wrapper<const Matrix>, Dim> projection_matrices(
+    const Mesh<Dim>& dg_mesh, const Index<Dim>& subcell_extents) noexcept;
+
 /*!
  * \ingroup DgSubcellGroup
  * \brief Computes the matrix needed for reconstructing the DG solution from
@@ -71,8 +91,58 @@ const Matrix& projection_matrix(const Mesh<Dim>& dg_mesh,
  * \f$\vec{\underline{w}}\f$ is the vector of integration weights over the
  * subcells. The integration weights \f$\vec{\underline{w}}\f$ on the subcells
  * are those for 6th-order integration on a uniform mesh.
+ *
+ * \note The full-volume matrix has \f$\mathcal{O}(N^{2\mathrm{Dim}})\f$
+ * entries, so `evolution::dg::subcell::fd::reconstruct` applies the
+ * `reconstruction_factors` instead.
  */
 template <size_t Dim>
 const Matrix& reconstruction_matrix(const Mesh<Dim>& dg_mesh,
                                     const Index<Dim>& subcell_extents) noexcept;
-}  // namespace evolution::dg::subcellfd
+
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief The 1D factors of the `reconstruction_matrix` in one dimension.
+ *
+ * Since the projection operator is a tensor product
+ * \f$\mathcal{P}=\bigotimes_d\mathcal{P}_d\f$, and so are the integration
+ * weights \f$\vec{w}\f$ and \f$\vec{\underline{w}}\f$, the reconstruction
+ * factors into a separable least-squares operator and a rank-one correction
+ * that restores conservation:
+ *
+ * \f{align*}{
+ *   u = L \underline{u} + \vec{c} \left(\vec{\underline{w}}^T \underline{u}
+ *   - \vec{w}^T L \underline{u}\right) \text{,}
+ * \f}
+ *
+ * with the least-squares operator
+ * \f$L=\bigotimes_d(\mathcal{P}_d^T\mathcal{P}_d)^{-1}\mathcal{P}_d^T\f$ and
+ * the correction \f$\vec{c}=\bigotimes_d\vec{c}_d\f$,
+ * \f$\vec{c}_d=(\mathcal{P}_d^T\mathcal{P}_d)^{-1}\vec{w}_d /
+ * \vec{w}_d^T(\mathcal{P}_d^T\mathcal{P}_d)^{-1}\vec{w}_d\f$. All factors are
+ * stored as matrices so they can be applied with `apply_matrices`, which
+ * reconstructs in \f$\mathcal{O}(N^{\mathrm{Dim}+1})\f$ operations without
+ * forming the full-volume reconstruction matrix.
+ */
+struct ReconstructionFactors {
+  /// The least-squares matrix
+  /// \f$(\mathcal{P}_d^T\mathcal{P}_d)^{-1}\mathcal{P}_d^T\f$
+  Matrix least_squares{};
+  /// A single row holding the DG integration weights \f$\vec{w}_d\f$
+  Matrix dg_weights{};
+  /// A single row holding the subcell integration weights
+  /// \f$\vec{\underline{w}}_d\f$, including the subcell width
+  Matrix subcell_weights{};
+  /// A single column holding the conservation correction \f$\vec{c}_d\f$
+  Matrix conservation_correction{};
+};
+
+/*!
+ * \ingroup DgSubcellGroup
+ * \brief The `ReconstructionFactors` in every dimension.
+ */
+template <size_t Dim>
+std::array<std::reference_wrapper<const ReconstructionFactors>, Dim>
+reconstruction_factors(const Mesh<Dim>& dg_mesh,
+                       const Index<Dim>& subcell_extents) noexcept;
+}  // namespace evolution::dg::subcell::fd
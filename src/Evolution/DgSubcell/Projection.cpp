@@ -5,11 +5,12 @@
 
 #include <cstddef>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "Evolution/DgSubcell/Matrices.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
-#include "Utilities/Blas.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
@@ -20,13 +21,13 @@ template <size_t Dim>
 void project_impl(gsl::span<double> subcell_u,
                   const gsl::span<const double> dg_u, const Mesh<Dim>& dg_mesh,
                   const Index<Dim>& subcell_extents) noexcept {
-  const size_t number_of_components =
-      dg_u.size() / dg_mesh.number_of_grid_points();
-  const Matrix& proj_matrix = projection_matrix(dg_mesh, subcell_extents);
-  dgemm_<true>('N', 'N', proj_matrix.rows(), number_of_components,
-               proj_matrix.columns(), 1.0, proj_matrix.data(),
-               proj_matrix.rows(), dg_u.data(), proj_matrix.columns(), 0.0,
-               subcell_u.data(), proj_matrix.rows());
+  // Non-owning views so the data can be passed to `apply_matrices`
+  DataVector subcell_view{subcell_u.data(), subcell_u.size()};
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  const DataVector dg_view{const_cast<double*>(dg_u.data()), dg_u.size()};
+  apply_matrices(make_not_null(&subcell_view),
+                 projection_matrices(dg_mesh, subcell_extents), dg_view,
+                 dg_mesh.extents());
 }
 }  // namespace detail
 
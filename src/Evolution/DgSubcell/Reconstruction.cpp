@@ -4,15 +4,18 @@
 #include "Evolution/DgSubcell/Reconstruction.hpp"
 
 #include <cstddef>
+#include <functional>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "Evolution/DgSubcell/Matrices.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
-#include "Utilities/Blas.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
 
 namespace evolution::dg::subcell::fd {
 namespace detail {
@@ -21,13 +24,38 @@ void reconstruct_impl(
     gsl::span<double> dg_u,
     const gsl::span<const double> subcell_u_times_projected_det_jac,
     const Mesh<Dim>& dg_mesh, const Index<Dim>& subcell_extents) noexcept {
-  const size_t number_of_components =
-      dg_u.size() / dg_mesh.number_of_grid_points();
-  const Matrix& recons_matrix = reconstruction_matrix(dg_mesh, subcell_extents);
-  dgemm_<true>('N', 'N', recons_matrix.rows(), number_of_components,
-               recons_matrix.columns(), 1.0, recons_matrix.data(),
-               recons_matrix.rows(), subcell_u_times_projected_det_jac.data(),
-               recons_matrix.columns(), 0.0, dg_u.data(), recons_matrix.rows());
+  const auto factors = reconstruction_factors(dg_mesh, subcell_extents);
+  auto least_squares =
+      make_array<Dim>(std::cref(factors[0].get().least_squares));
+  auto dg_weights = make_array<Dim>(std::cref(factors[0].get().dg_weights));
+  auto subcell_weights =
+      make_array<Dim>(std::cref(factors[0].get().subcell_weights));
+  auto conservation_corrections =
+      make_array<Dim>(std::cref(factors[0].get().conservation_correction));
+  for (size_t d = 1; d < Dim; ++d) {
+    const ReconstructionFactors& factors_d = gsl::at(factors, d);
+    gsl::at(least_squares, d) = factors_d.least_squares;
+    gsl::at(dg_weights, d) = factors_d.dg_weights;
+    gsl::at(subcell_weights, d) = factors_d.subcell_weights;
+    gsl::at(conservation_corrections, d) = factors_d.conservation_correction;
+  }
+
+  // Non-owning views so the data can be passed to `apply_matrices`
+  DataVector dg_view{dg_u.data(), dg_u.size()};
+  const DataVector subcell_view{
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      const_cast<double*>(subcell_u_times_projected_det_jac.data()),
+      subcell_u_times_projected_det_jac.size()};
+  apply_matrices(make_not_null(&dg_view), least_squares, subcell_view,
+                 subcell_extents);
+  // Correct the least-squares solution so the integral over the element
+  // matches the integral over the subcells. The integrals are computed for
+  // each component by applying the 1-row weight matrices.
+  const DataVector integral_mismatch =
+      apply_matrices(subcell_weights, subcell_view, subcell_extents) -
+      apply_matrices(dg_weights, dg_view, dg_mesh.extents());
+  dg_view += apply_matrices(conservation_corrections, integral_mismatch,
+                            Index<Dim>{1});
 }
 }  // namespace detail
 
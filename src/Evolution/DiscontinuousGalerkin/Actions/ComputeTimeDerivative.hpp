@@ -42,12 +42,14 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/MeasuredCosts.hpp"
 #include "ParallelAlgorithms/DiscontinuousGalerkin/FluxCommunication.hpp"
 #include "Time/Actions/SelfStartActions.hpp"
 #include "Time/Tags.hpp"
 #include "Time/TakeStep.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -517,8 +519,33 @@ ComputeTimeDerivative<Metavariables>::apply(
                                                      cache);
   }
 
-  send_data_for_fluxes<ParallelComponent>(make_not_null(&cache),
-                                          make_not_null(&box));
+  // Sending the data may run the actions of neighbors that live on this
+  // processor right away, because `receive_data` is an [inline] entry method.
+  // That work is not part of this element's cost.
+  if constexpr (db::tag_is_retrievable_v<Parallel::Tags::MeasuredCosts,
+                                         db::DataBox<DbTagsList>>) {
+    const bool measuring_cost =
+        db::get<Parallel::Tags::MeasuredCosts>(box).measuring();
+    if (measuring_cost) {
+      db::mutate<Parallel::Tags::MeasuredCosts>(
+          make_not_null(&box),
+          [](const gsl::not_null<Parallel::MeasuredCosts*> costs) noexcept {
+            costs->pause(sys::wall_time());
+          });
+    }
+    send_data_for_fluxes<ParallelComponent>(make_not_null(&cache),
+                                            make_not_null(&box));
+    if (measuring_cost) {
+      db::mutate<Parallel::Tags::MeasuredCosts>(
+          make_not_null(&box),
+          [](const gsl::not_null<Parallel::MeasuredCosts*> costs) noexcept {
+            costs->resume(sys::wall_time());
+          });
+    }
+  } else {
+    send_data_for_fluxes<ParallelComponent>(make_not_null(&cache),
+                                            make_not_null(&box));
+  }
   return {std::move(box)};
 }
 
@@ -640,27 +667,13 @@ void ComputeTimeDerivative<Metavariables>::send_data_for_fluxes(
       for (const auto& neighbor : neighbors) {
         const std::pair mortar_id{direction, neighbor};
 
-        std::pair<Mesh<volume_dim - 1>, std::vector<double>>
-            neighbor_boundary_data_on_mortar{};
-        ASSERT(time_step_id == all_mortar_data.at(mortar_id).time_step_id(),
+        const auto& mortar_data = all_mortar_data.at(mortar_id);
+        ASSERT(time_step_id == mortar_data.time_step_id(),
                "The current time step id of the volume is "
                    << time_step_id
                    << "but the time step id on the mortar with mortar id "
-                   << mortar_id << " is "
-                   << all_mortar_data.at(mortar_id).time_step_id());
-
-        // Reorient the data to the neighbor orientation if necessary
-        if (LIKELY(orientation.is_aligned())) {
-          neighbor_boundary_data_on_mortar =
-              *all_mortar_data.at(mortar_id).local_mortar_data();
-        } else {
-          const auto& slice_extents = mortar_meshes.at(mortar_id).extents();
-          neighbor_boundary_data_on_mortar.first =
-              all_mortar_data.at(mortar_id).local_mortar_data()->first;
-          neighbor_boundary_data_on_mortar.second = orient_variables_on_slice(
-              all_mortar_data.at(mortar_id).local_mortar_data()->second,
-              slice_extents, direction.dimension(), orientation);
-        }
+                   << mortar_id << " is " << mortar_data.time_step_id());
+        const auto& local_mortar_data = *mortar_data.local_mortar_data();
 
         const TimeStepId& next_time_step_id = [&box]() noexcept {
           if (Metavariables::local_time_stepping) {
@@ -670,12 +683,23 @@ void ComputeTimeDerivative<Metavariables>::send_data_for_fluxes(
           }
         }();
 
+        // The mortar data is written directly into the message that is sent
+        // to the neighbor, reorienting it to the neighbor orientation if
+        // necessary, and the message is then moved into `receive_data`. This
+        // is the only copy made on the sending side. Charm++ still marshals
+        // the arguments of the [inline] entry method, also for a receiver on
+        // the same processor, so the receiver unpacks a second copy into its
+        // inbox.
         std::tuple<Mesh<volume_dim - 1>, std::optional<std::vector<double>>,
                    std::optional<std::vector<double>>, ::TimeStepId>
-            data{neighbor_boundary_data_on_mortar.first,
-                 {},
-                 {std::move(neighbor_boundary_data_on_mortar.second)},
-                 next_time_step_id};
+            data{local_mortar_data.first, {}, {}, next_time_step_id};
+        if (LIKELY(orientation.is_aligned())) {
+          std::get<2>(data).emplace(local_mortar_data.second);
+        } else {
+          std::get<2>(data).emplace(orient_variables_on_slice(
+              local_mortar_data.second, mortar_meshes.at(mortar_id).extents(),
+              direction.dimension(), orientation));
+        }
 
         // Send mortar data (the `std::tuple` named `data`) to neighbor
         Parallel::receive_data<
@@ -683,7 +707,7 @@ void ComputeTimeDerivative<Metavariables>::send_data_for_fluxes(
                 volume_dim>>(
             receiver_proxy[neighbor], time_step_id,
             std::make_pair(std::pair{direction_from_neighbor, element.id()},
-                           data));
+                           std::move(data)));
       }
     }
 
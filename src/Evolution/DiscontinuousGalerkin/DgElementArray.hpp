@@ -9,9 +9,9 @@
 #include "Domain/Block.hpp"
 #include "Domain/Creators/DomainCreator.hpp"
 #include "Domain/Domain.hpp"
+#include "Domain/ElementDistribution.hpp"
 #include "Domain/OptionTags.hpp"
 #include "Domain/Structure/ElementId.hpp"
-#include "Domain/Structure/InitialElementIds.hpp"
 #include "Domain/Tags.hpp"
 #include "Parallel/Algorithms/AlgorithmArray.hpp"
 #include "Parallel/GlobalCache.hpp"
@@ -25,6 +25,10 @@
  *
  * This parallel component will perform the actions specified by the
  * `PhaseDepActionList`.
+ *
+ * The elements are distributed over the processors along a space-filling
+ * curve, weighted by their number of grid points (see
+ * `domain::BlockZCurveProcDistribution`).
  */
 template <class Metavariables, class PhaseDepActionList>
 struct DgElementArray {
@@ -38,7 +42,8 @@ struct DgElementArray {
   using const_global_cache_tags = tmpl::list<domain::Tags::Domain<volume_dim>>;
 
   using array_allocation_tags =
-      tmpl::list<domain::Tags::InitialRefinementLevels<volume_dim>>;
+      tmpl::list<domain::Tags::InitialRefinementLevels<volume_dim>,
+                 domain::Tags::InitialExtents<volume_dim>>;
 
   using initialization_tags = Parallel::get_initialization_tags<
       Parallel::get_initialization_actions_list<phase_dependent_action_list>,
@@ -66,22 +71,21 @@ void DgElementArray<Metavariables, PhaseDepActionList>::allocate_array(
   auto& local_cache = *(global_cache.ckLocalBranch());
   auto& dg_element_array =
       Parallel::get_parallel_component<DgElementArray>(local_cache);
-  const auto& domain =
-      Parallel::get<domain::Tags::Domain<volume_dim>>(local_cache);
-  const auto& initial_refinement_levels =
+  std::vector<size_t> procs_per_node(
+      static_cast<size_t>(sys::number_of_nodes()));
+  for (size_t node = 0; node < procs_per_node.size(); ++node) {
+    procs_per_node[node] =
+        static_cast<size_t>(sys::procs_on_node(static_cast<int>(node)));
+  }
+  const domain::BlockZCurveProcDistribution<volume_dim> element_distribution{
+      procs_per_node,
       get<domain::Tags::InitialRefinementLevels<volume_dim>>(
-          initialization_items);
-  int which_proc = 0;
-  for (const auto& block : domain.blocks()) {
-    const auto initial_ref_levs = initial_refinement_levels[block.id()];
-    const std::vector<ElementId<volume_dim>> element_ids =
-        initial_element_ids(block.id(), initial_ref_levs);
-    const int number_of_procs = sys::number_of_procs();
-    for (size_t i = 0; i < element_ids.size(); ++i) {
-      dg_element_array(ElementId<volume_dim>(element_ids[i]))
-          .insert(global_cache, initialization_items, which_proc);
-      which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
-    }
+          initialization_items),
+      get<domain::Tags::InitialExtents<volume_dim>>(initialization_items)};
+  for (const auto& [element_id, proc] :
+       element_distribution.element_procs()) {
+    dg_element_array(element_id)
+        .insert(global_cache, initialization_items, static_cast<int>(proc));
   }
   dg_element_array.doneInserting();
 }
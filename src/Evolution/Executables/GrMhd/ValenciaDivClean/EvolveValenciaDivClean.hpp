@@ -62,10 +62,12 @@
 #include "NumericalAlgorithms/Interpolation/Tags.hpp"
 #include "NumericalAlgorithms/Interpolation/TryToInterpolate.hpp"
 #include "Options/Options.hpp"
+#include "Parallel/Actions/MeasureCosts.hpp"
 #include "Parallel/Actions/SetupDataBox.hpp"
 #include "Parallel/Actions/TerminatePhase.hpp"
 #include "Parallel/Algorithms/AlgorithmSingleton.hpp"
 #include "Parallel/InitializationFunctions.hpp"
+#include "Parallel/MeasuredCosts.hpp"
 #include "Parallel/PhaseControl/ExecutePhaseChange.hpp"
 #include "Parallel/PhaseControl/PhaseControlTags.hpp"
 #include "Parallel/PhaseControl/VisitAndReturn.hpp"
@@ -79,6 +81,7 @@
 #include "ParallelAlgorithms/DiscontinuousGalerkin/InitializeMortars.hpp"
 #include "ParallelAlgorithms/Events/ObserveErrorNorms.hpp"
 #include "ParallelAlgorithms/Events/ObserveFields.hpp"
+#include "ParallelAlgorithms/Events/ObserveMeasuredCosts.hpp"
 #include "ParallelAlgorithms/Events/ObserveTimeStep.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Actions/RunEventsAndTriggers.hpp"  // IWYU pragma: keep
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
@@ -217,6 +220,7 @@ struct EvolutionMetavars {
           tmpl::conditional_t<evolution::is_analytic_solution_v<initial_data>,
                               analytic_variables_tags, tmpl::list<>>>,
       Events::Registrars::ObserveTimeStep<EvolutionMetavars>,
+      Events::Registrars::ObserveMeasuredCosts<Tags::Time>,
       Events::Registrars::ChangeSlabSize<slab_choosers>>>;
   using interpolation_events =
       tmpl::list<intrp::Events::Registrars::Interpolate<
@@ -225,9 +229,11 @@ struct EvolutionMetavars {
 
   using triggers = Triggers::time_triggers;
 
+  // PalenzuelaEtAl comes first because it recovers all points of an element
+  // at once. NewmanHamlin is only tried at the points where it fails.
   using ordered_list_of_primitive_recovery_schemes = tmpl::list<
-      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin,
-      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>;
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl,
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin>;
 
   using interpolation_target_tags = tmpl::list<InterpolationTargetTags...>;
 
@@ -237,7 +243,9 @@ struct EvolutionMetavars {
           typename InterpolationTargetTags::post_interpolation_callback...>>;
 
   using step_actions = tmpl::flatten<tmpl::list<
-      evolution::dg::Actions::ComputeTimeDerivative<EvolutionMetavars>,
+      Parallel::Actions::measure_cost<
+          Parallel::CostCategory::VolumeTerms,
+          evolution::dg::Actions::ComputeTimeDerivative<EvolutionMetavars>>,
       tmpl::conditional_t<
           evolution::is_analytic_solution_v<initial_data>,
           dg::Actions::ImposeDirichletBoundaryConditions<EvolutionMetavars>,
@@ -246,7 +254,9 @@ struct EvolutionMetavars {
           boundary_scheme,
           domain::Tags::BoundaryDirectionsInterior<volume_dim>>,
       dg::Actions::ReceiveDataForFluxes<boundary_scheme>,
-      Actions::MutateApply<boundary_scheme>,
+      Parallel::Actions::measure_cost<
+          Parallel::CostCategory::BoundaryCorrections,
+          Actions::MutateApply<boundary_scheme>>,
       tmpl::conditional_t<
           local_time_stepping, tmpl::list<>,
           tmpl::list<Actions::RecordTimeStepperData<>, Actions::UpdateU<>>>,
@@ -254,7 +264,8 @@ struct EvolutionMetavars {
       Limiters::Actions::Limit<EvolutionMetavars>,
       VariableFixing::Actions::FixVariables<
           grmhd::ValenciaDivClean::FixConservatives>,
-      Actions::UpdatePrimitives>>;
+      Parallel::Actions::measure_cost<Parallel::CostCategory::PrimitiveRecovery,
+                                      Actions::UpdatePrimitives>>>;
 
   enum class Phase {
     Initialization,
@@ -325,6 +336,7 @@ struct EvolutionMetavars {
       Initialization::Actions::Minmod<3>,
       intrp::Actions::ElementInitInterpPoints<
           intrp::Tags::InterpPointInfo<EvolutionMetavars>>,
+      Parallel::Actions::InitializeMeasuredCosts,
       Initialization::Actions::RemoveOptionsAndTerminatePhase>;
 
   using dg_element_array_component = DgElementArray<
@@ -349,7 +361,10 @@ struct EvolutionMetavars {
                   VariableFixing::Actions::FixVariables<
                       VariableFixing::FixToAtmosphere<volume_dim,
                                                       thermodynamic_dim>>,
-                  Actions::UpdateConservatives, Actions::RunEventsAndTriggers,
+                  Actions::UpdateConservatives,
+                  Parallel::Actions::measure_cost<
+                      Parallel::CostCategory::Observation,
+                      Actions::RunEventsAndTriggers>,
                   Actions::ChangeSlabSize, step_actions, Actions::AdvanceTime,
                   PhaseControl::Actions::ExecutePhaseChange<phase_changes,
                                                             triggers>>>>>;
@@ -121,6 +121,12 @@ struct EvolutionMetavars {
   using system = RadiationTransport::M1Grey::System<neutrino_species>;
   using temporal_id = Tags::TimeStepId;
   static constexpr bool local_time_stepping = false;
+  // The neutrino-matter coupling is the `implicit_sector` of the system, which
+  // only the IMEX time steppers integrate. None of them supports local time
+  // stepping.
+  static_assert(not local_time_stepping,
+                "The M1 system needs an IMEX time stepper, which can't do "
+                "local time stepping.");
   using initial_data_tag =
       tmpl::conditional_t<evolution::is_analytic_solution_v<initial_data>,
                           Tags::AnalyticSolution<initial_data>,
@@ -149,8 +155,7 @@ struct EvolutionMetavars {
       tmpl::append<step_choosers_common, step_choosers_for_step_only,
                    step_choosers_for_slab_only>>;
 
-  using time_stepper_tag = Tags::TimeStepper<
-      tmpl::conditional_t<local_time_stepping, LtsTimeStepper, TimeStepper>>;
+  using time_stepper_tag = Tags::TimeStepper<ImexTimeStepper>;
   using boundary_scheme = tmpl::conditional_t<
       local_time_stepping,
       dg::FirstOrderScheme::FirstOrderSchemeLts<
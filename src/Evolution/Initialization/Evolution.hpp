@@ -18,6 +18,7 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "Time/ImplicitSector.hpp"
 #include "Time/Slab.hpp"
 #include "Time/StepControllers/StepController.hpp"
 #include "Time/Tags.hpp"
@@ -180,6 +181,8 @@ struct TimeAndTimeStep {
 /// - Adds:
 ///   * `db::add_tag_prefix<Tags::dt, variables_tag>`
 ///   * `Tags::HistoryEvolvedVariables<variables_tag, dt_variables_tag>`
+///   * `Tags::HistoryImplicitSources<variables_tag>` (for systems with an
+///     `implicit_sector`, see `imex::has_implicit_sector`)
 ///   * Tags::ComputeDeriv  (for non-conservative systems)
 ///   * Tags::ComputeDiv (for conservative systems)
 /// - Removes: nothing
@@ -212,9 +215,16 @@ struct TimeStepperHistory {
     using type = db::AddComputeTags<>;
   };
 
-  using simple_tags =
+  static constexpr bool has_implicit_sector =
+      imex::has_implicit_sector_v<typename Metavariables::system>;
+
+  using simple_tags = tmpl::append<
       tmpl::list<dt_variables_tag,
-                 ::Tags::HistoryEvolvedVariables<variables_tag>>;
+                 ::Tags::HistoryEvolvedVariables<variables_tag>>,
+      tmpl::conditional_t<
+          has_implicit_sector,
+          tmpl::list<::Tags::HistoryImplicitSources<variables_tag>>,
+          tmpl::list<>>>;
 
   using compute_tags =
       typename ComputeTags<typename Metavariables::system>::type;
@@ -247,8 +257,16 @@ struct TimeStepperHistory {
     typename ::Tags::HistoryEvolvedVariables<variables_tag>::type history{
       starting_order};
 
-    Initialization::mutate_assign<simple_tags>(
-        make_not_null(&box), std::move(dt_vars), std::move(history));
+    if constexpr (has_implicit_sector) {
+      typename ::Tags::HistoryImplicitSources<variables_tag>::type
+          implicit_history{starting_order};
+      Initialization::mutate_assign<simple_tags>(
+          make_not_null(&box), std::move(dt_vars), std::move(history),
+          std::move(implicit_history));
+    } else {
+      Initialization::mutate_assign<simple_tags>(
+          make_not_null(&box), std::move(dt_vars), std::move(history));
+    }
 
     return std::make_tuple(std::move(box));
   }
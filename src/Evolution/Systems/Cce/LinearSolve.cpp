@@ -3,7 +3,10 @@
 
 #include "Evolution/Systems/Cce/LinearSolve.hpp"
 
+#include <algorithm>
+#include <complex>
 #include <cstddef>
+#include <vector>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -15,6 +18,8 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCoefficients.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/StaticCache.hpp"
 #include "Utilities/VectorAlgebra.hpp"
@@ -85,6 +90,7 @@ Matrix q_integration_matrix(const size_t number_of_points) noexcept {
                                          Spectral::Quadrature::GaussLobatto>(
              number_of_points);
 }
+
 }  // namespace
 
 const Matrix& precomputed_cce_q_integrator(
@@ -220,9 +226,6 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
   const size_t number_of_angular_points =
       Spectral::Swsh::number_of_swsh_collocation_points(l_max);
 
-  Matrix operator_matrix(2 * number_of_radial_points,
-                         2 * number_of_radial_points);
-
   ComplexDataVector integrand =
       get(pole_of_integrand).data() +
       get(one_minus_y).data() * get(regular_integrand).data();
@@ -240,79 +243,96 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
                 linear_solve_buffer.data(), number_of_radial_points,
                 2 * number_of_angular_points);
 
+  // put the boundary values into the first row of the real and imaginary part
+  // of each system
+  for (size_t offset = 0; offset < number_of_angular_points; ++offset) {
+    linear_solve_buffer[offset * 2 * number_of_radial_points] =
+        real(get(boundary).data()[offset]);
+    linear_solve_buffer[(offset * 2 + 1) * number_of_radial_points] =
+        imag(get(boundary).data()[offset]);
+  }
+
+  const size_t operator_size = 2 * number_of_radial_points;
+  const size_t operator_entries = square(operator_size);
+  DataVector radial_one_minus_y{number_of_radial_points};
+  for (size_t i = 0; i < number_of_radial_points; ++i) {
+    radial_one_minus_y[i] =
+        real(get(one_minus_y).data()[i * number_of_angular_points]);
+  }
+
+  std::vector<double> factored_operators(number_of_angular_points *
+                                         operator_entries);
+  std::vector<int> pivots(number_of_angular_points * operator_size);
+
+  // The part of the operator that is the same at all angular points: the
+  // (1 - y) \partial_y part in the upper left (real-real) and lower right
+  // (imag-imag) blocks, with the first row of each block replaced by the
+  // boundary condition. Stored column-major for LAPACK.
   const auto& derivative_matrix =
       Spectral::differentiation_matrix<Spectral::Basis::Legendre,
                                        Spectral::Quadrature::GaussLobatto>(
           number_of_radial_points);
-  for (size_t offset = 0; offset < number_of_angular_points; ++offset) {
-    // on repeated evaluations, the matrix gets permuted by the dgesv routine.
-    // We'll ignore its pivots and just overwrite the whole thing on each
-    // pass. There are probably optimizations that can be made which make use
-    // of the pivots.
-
-    // first we apply the (1 - y) \partial_y part of the matrix
-    // to the upper right (real-real) and lower left (imag-imag) part of the
-    // matrix
-    for (size_t matrix_block = 0; matrix_block < 2; ++matrix_block) {
-      for (size_t i = 0; i < number_of_radial_points; ++i) {
-        for (size_t j = 0; j < number_of_radial_points; ++j) {
-          operator_matrix(i + matrix_block * number_of_radial_points,
-                          j + matrix_block * number_of_radial_points) =
-              derivative_matrix(i, j) *
-              real(get(one_minus_y).data()[i * number_of_angular_points]);
-        }
-      }
-    }
-
-    // zero out the lower left and upper right part of the matrix
-    for (size_t i = 0; i < number_of_radial_points; ++i) {
+  std::vector<double> common_operator(operator_entries, 0.0);
+  for (size_t matrix_block = 0; matrix_block < 2; ++matrix_block) {
+    const size_t block_offset = matrix_block * number_of_radial_points;
+    for (size_t i = 1; i < number_of_radial_points; ++i) {
       for (size_t j = 0; j < number_of_radial_points; ++j) {
-        operator_matrix(i + number_of_radial_points, j) = 0.0;
-        operator_matrix(i, j + number_of_radial_points) = 0.0;
+        common_operator[(j + block_offset) * operator_size + i +
+                        block_offset] =
+            derivative_matrix(i, j) * radial_one_minus_y[i];
       }
     }
+    common_operator[block_offset * operator_size + block_offset] = 1.0;
+  }
 
-    // gather the contributions to the matrix blocks from the linear factors
-    // each, we zero the first row
-    for (size_t i = 0; i < number_of_radial_points; ++i) {
+  // Assemble the operators at all angular points into one contiguous buffer
+  // by adding the contributions of the linear factors, then factorize them
+  // all in one pass
+  for (size_t offset = 0; offset < number_of_angular_points; ++offset) {
+    double* const angular_operator =
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        factored_operators.data() + offset * operator_entries;
+    std::copy(common_operator.begin(), common_operator.end(), angular_operator);
+    const auto entry = [&angular_operator, &operator_size](
+                           const size_t row,
+                           const size_t column) noexcept -> double& {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      return angular_operator[column * operator_size + row];
+    };
+    for (size_t i = 1; i < number_of_radial_points; ++i) {
       const size_t linear_factor_index = offset + i * number_of_angular_points;
+      const std::complex<double> factor =
+          get(linear_factor).data()[linear_factor_index];
+      const std::complex<double> factor_of_conjugate =
+          get(linear_factor_of_conjugate).data()[linear_factor_index];
       // upper left
-      operator_matrix(i, i) +=
-          real(get(linear_factor).data()[linear_factor_index] +
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(0, i) = 0.0;
+      entry(i, i) += real(factor + factor_of_conjugate);
       // upper right
-      operator_matrix(i, number_of_radial_points + i) -=
-          imag(get(linear_factor).data()[linear_factor_index] -
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(0, number_of_radial_points + i) = 0.0;
+      entry(i, number_of_radial_points + i) -=
+          imag(factor - factor_of_conjugate);
       // lower left
-      operator_matrix(number_of_radial_points + i, i) +=
-          imag(get(linear_factor).data()[linear_factor_index] +
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(number_of_radial_points, i) = 0.0;
+      entry(number_of_radial_points + i, i) +=
+          imag(factor + factor_of_conjugate);
       // lower right
-      operator_matrix(number_of_radial_points + i,
-                      number_of_radial_points + i) +=
-          real(get(linear_factor).data()[linear_factor_index] -
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(number_of_radial_points, number_of_radial_points + i) =
-          0.0;
+      entry(number_of_radial_points + i, number_of_radial_points + i) +=
+          real(factor - factor_of_conjugate);
     }
-    operator_matrix(0, 0) = 1.0;
-    operator_matrix(number_of_radial_points, number_of_radial_points) = 1.0;
-    // put the data currently in integrand into a real DataVector of twice the
-    // length
-    linear_solve_buffer[offset * 2 * number_of_radial_points] =
-        real(get(boundary).data()[offset]);
-    linear_solve_buffer[(offset * 2 + 1) * number_of_radial_points] =
-        imag(get(boundary).data()[offset]);
-    DataVector linear_solve_buffer_view{
-        linear_solve_buffer.data() + offset * 2 * number_of_radial_points,
-        2 * number_of_radial_points};
-    lapack::general_matrix_linear_solve(
-        make_not_null(&linear_solve_buffer_view),
-        make_not_null(&operator_matrix));
+  }
+  const int factorization_info = lapack::batched_lu_factorization(
+      make_not_null(factored_operators.data()), make_not_null(pivots.data()),
+      operator_size, number_of_angular_points);
+  if (UNLIKELY(factorization_info != 0)) {
+    ERROR("LU factorization of the BondiH radial operator failed with INFO = "
+          << factorization_info
+          << ". A positive value means that the operator is singular at one "
+             "of the angular points.");
+  }
+  const int solve_info = lapack::batched_lu_solve(
+      make_not_null(linear_solve_buffer.data()), factored_operators.data(),
+      pivots.data(), operator_size, number_of_angular_points);
+  if (UNLIKELY(solve_info != 0)) {
+    ERROR("Linear solve of the BondiH radial operator failed with INFO = "
+          << solve_info << ".");
   }
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
   raw_transpose(make_not_null(reinterpret_cast<double*>(
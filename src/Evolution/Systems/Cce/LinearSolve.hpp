@@ -94,6 +94,10 @@ void transpose_to_reals_then_imags_radial_stripes(
  * \f$L^\prime\f$ ensure that the only current method we have for evaluating the
  * \f$H\f$ hypersurface equation is a direct linear solve, rather than the
  * spectral matrix multiplications which are available for the other integrals.
+ * The operators at all angular points are LU-factored together into one
+ * contiguous buffer, and the factorizations are kept and reused by later calls
+ * on the same thread for which \f$L\f$, \f$L^\prime\f$, and the radial grid
+ * are unchanged, so that those calls only perform the triangular solves.
  *
  * In each case, the boundary value at the world tube for the integration is
  * retrieved from `BoundaryPrefix<Tag>`.
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <hdf5.h>
 #include <limits>
 #include <optional>
 
@@ -19,6 +20,7 @@
 #include "Options/Auto.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/Printf.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 
 namespace Cce {
 namespace OptionTags {
@@ -130,6 +132,17 @@ struct H5LookaheadTimes {
   using group = Cce;
 };
 
+struct H5PrefetchDepth {
+  using type = size_t;
+  static constexpr Options::String help{
+      "Number of additional reads of H5LookaheadTimes time steps from the h5 "
+      "to perform in the background while the current ones are used. 0 reads "
+      "the h5 only when the data is needed. Values above 0 require an HDF5 "
+      "library built thread-safe."};
+  static size_t suggested_value() noexcept { return 0; }
+  using group = Cce;
+};
+
 struct H5Interpolator {
   using type = std::unique_ptr<intrp::SpanInterpolator>;
   static constexpr Options::String help{
@@ -247,17 +260,30 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
   using type = std::unique_ptr<WorldtubeDataManager>;
   using option_tags =
       tmpl::list<OptionTags::LMax, OptionTags::BoundaryDataFilename,
-                 OptionTags::H5LookaheadTimes, OptionTags::H5Interpolator,
-                 OptionTags::H5IsBondiData, OptionTags::FixSpecNormalization,
+                 OptionTags::H5LookaheadTimes, OptionTags::H5PrefetchDepth,
+                 OptionTags::H5Interpolator, OptionTags::H5IsBondiData,
+                 OptionTags::FixSpecNormalization,
                  OptionTags::StandaloneExtractionRadius>;
 
   static constexpr bool pass_metavariables = false;
   static type create_from_options(
       const size_t l_max, const std::string& filename,
-      const size_t number_of_lookahead_times,
+      const size_t number_of_lookahead_times, const size_t prefetch_depth,
       const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
       const bool h5_is_bondi_data, const bool fix_spec_normalization,
       const std::optional<double> extraction_radius) noexcept {
+#ifndef H5_HAVE_THREADSAFE
+    // The background reads of the prefetcher run on threads that Charm++
+    // doesn't know about, so the node's HDF5 lock doesn't serialize them with
+    // the HDF5 access of the observers in non-SMP builds.
+    if (prefetch_depth > 0) {
+      ERROR("H5PrefetchDepth is " << prefetch_depth
+                                  << ", but prefetching worldtube data on "
+                                     "background threads requires an HDF5 "
+                                     "library built thread-safe. Set "
+                                     "H5PrefetchDepth to 0.");
+    }
+#endif  // H5_HAVE_THREADSAFE
     if (h5_is_bondi_data) {
       if (static_cast<bool>(extraction_radius)) {
         Parallel::printf(
@@ -271,13 +297,14 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
       return std::make_unique<BondiWorldtubeDataManager>(
           std::make_unique<BondiWorldtubeH5BufferUpdater>(filename,
                                                           extraction_radius),
-          l_max, number_of_lookahead_times, interpolator->get_clone());
+          l_max, number_of_lookahead_times, interpolator->get_clone(),
+          prefetch_depth);
     } else {
       return std::make_unique<MetricWorldtubeDataManager>(
           std::make_unique<MetricWorldtubeH5BufferUpdater>(filename,
                                                            extraction_radius),
           l_max, number_of_lookahead_times, interpolator->get_clone(),
-          fix_spec_normalization);
+          fix_spec_normalization, prefetch_depth);
     }
   }
 };
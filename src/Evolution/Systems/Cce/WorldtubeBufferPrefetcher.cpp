@@ -0,0 +1,206 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Cce {
+namespace detail {
+namespace {
+// Whether the buffers spanning `time_span_start` to `time_span_end` can be
+// used without an update at `time`. This matches the criterion used in the
+// `update_buffers_for_time` functions of the H5 buffer updaters.
+bool span_covers_time(const size_t time_span_end, const double time,
+                      const size_t interpolator_length,
+                      const DataVector& time_buffer) noexcept {
+  return time_span_end > interpolator_length and
+         time_buffer[time_span_end - interpolator_length] > time;
+}
+
+// Serializes the file access of the background reads of all prefetchers in
+// this process. The node's HDF5 lock alone isn't enough because it is a no-op
+// in non-SMP builds, where Charm++ assumes only one thread per process.
+std::mutex& background_read_mutex() noexcept {
+  static std::mutex mutex{};
+  return mutex;
+}
+}  // namespace
+
+template <typename BufferTags>
+WorldtubeBufferPrefetcher<BufferTags>::WorldtubeBufferPrefetcher(
+    const size_t prefetch_depth) noexcept
+    : prefetch_depth_{prefetch_depth} {}
+
+template <typename BufferTags>
+WorldtubeBufferPrefetcher<BufferTags>&
+WorldtubeBufferPrefetcher<BufferTags>::operator=(
+    WorldtubeBufferPrefetcher&& rhs) noexcept {
+  if (this != &rhs) {
+    // the pending reads use `buffer_updater_`, so they must finish before it
+    // is replaced
+    clear();
+    prefetch_depth_ = rhs.prefetch_depth_;
+    buffer_updater_ = std::move(rhs.buffer_updater_);
+    pending_windows_ = std::move(rhs.pending_windows_);
+    spare_windows_ = std::move(rhs.spare_windows_);
+  }
+  return *this;
+}
+
+template <typename BufferTags>
+WorldtubeBufferPrefetcher<BufferTags>::~WorldtubeBufferPrefetcher() noexcept {
+  clear();
+}
+
+template <typename BufferTags>
+bool WorldtubeBufferPrefetcher<BufferTags>::retrieve_buffers_for_time(
+    const gsl::not_null<Variables<BufferTags>*> buffers,
+    const gsl::not_null<size_t*> time_span_start,
+    const gsl::not_null<size_t*> time_span_end, const double time,
+    const size_t interpolator_length, const DataVector& time_buffer) noexcept {
+  if (span_covers_time(*time_span_end, time, interpolator_length,
+                       time_buffer)) {
+    return true;
+  }
+  while (not pending_windows_.empty()) {
+    PendingWindow& next = pending_windows_.front();
+    // Windows are prefetched in time order. A window that ends before `time`
+    // has been skipped over by a large step and is recycled; a window that
+    // starts too late to center the interpolation stencil on `time` means
+    // that the requested time moved backward, so none of the windows are used.
+    if (next.window->time_span_start != 0 and
+        time_buffer[next.window->time_span_start + interpolator_length - 1] >=
+            time) {
+      break;
+    }
+    next.read.wait();
+    if (next.window->time_span_end >= time_buffer.size() or
+        span_covers_time(next.window->time_span_end, time, interpolator_length,
+                         time_buffer)) {
+      using std::swap;
+      swap(*buffers, next.window->buffers);
+      *time_span_start = next.window->time_span_start;
+      *time_span_end = next.window->time_span_end;
+      spare_windows_.push_back(std::move(next.window));
+      pending_windows_.pop_front();
+      return true;
+    }
+    spare_windows_.push_back(std::move(next.window));
+    pending_windows_.pop_front();
+  }
+  clear();
+  return false;
+}
+
+template <typename BufferTags>
+void WorldtubeBufferPrefetcher<BufferTags>::prefetch_after(
+    const WorldtubeBufferUpdater<BufferTags>& buffer_updater,
+    const size_t time_span_end, const size_t l_max,
+    const size_t interpolator_length, const size_t buffer_depth,
+    const size_t buffer_size,
+    const gsl::not_null<Parallel::NodeLock*> hdf5_lock) noexcept {
+  if (prefetch_depth_ == 0) {
+    return;
+  }
+  if (buffer_updater_ == nullptr) {
+    // constructing the clone opens the file
+    const std::lock_guard<std::mutex> read_lock(background_read_mutex());
+    hdf5_lock->lock();
+    buffer_updater_ = buffer_updater.get_clone();
+    hdf5_lock->unlock();
+  }
+  const DataVector& time_buffer = buffer_updater_->get_time_buffer();
+  size_t last_span_end = pending_windows_.empty()
+                             ? time_span_end
+                             : pending_windows_.back().window->time_span_end;
+  while (pending_windows_.size() < prefetch_depth_ and
+         last_span_end > interpolator_length and
+         last_span_end < time_buffer.size()) {
+    // the earliest time at which the window ending at `last_span_end` needs
+    // to be replaced, and the window the updater would load at that time
+    const double read_time = time_buffer[last_span_end - interpolator_length];
+    const auto span = create_span_for_time_value(
+        read_time, buffer_depth, interpolator_length, 0, time_buffer.size(),
+        time_buffer);
+    if (span.second <= last_span_end) {
+      // the window would not contain any new times
+      break;
+    }
+
+    std::unique_ptr<Window> window{};
+    if (spare_windows_.empty()) {
+      window = std::make_unique<Window>();
+    } else {
+      window = std::move(spare_windows_.back());
+      spare_windows_.pop_back();
+    }
+    if (window->buffers.number_of_grid_points() != buffer_size) {
+      window->buffers.initialize(buffer_size);
+    }
+    window->time_span_start = span.first;
+    window->time_span_end = span.second;
+
+    std::future<void> read = std::async(
+        std::launch::async,
+        [updater = buffer_updater_.get(), window_pointer = window.get(),
+         hdf5_lock, read_time, l_max, interpolator_length,
+         buffer_depth]() noexcept {
+          // a span end of zero forces the updater to load the data
+          size_t read_span_start = 0;
+          size_t read_span_end = 0;
+          {
+            const std::lock_guard<std::mutex> read_lock(
+                background_read_mutex());
+            hdf5_lock->lock();
+            updater->update_buffers_for_time(
+                make_not_null(&window_pointer->buffers),
+                make_not_null(&read_span_start),
+                make_not_null(&read_span_end), read_time, l_max,
+                interpolator_length, buffer_depth);
+            hdf5_lock->unlock();
+          }
+          ASSERT(read_span_start == window_pointer->time_span_start and
+                     read_span_end == window_pointer->time_span_end,
+                 "The buffer updater loaded the span ("
+                     << read_span_start << ", " << read_span_end
+                     << ") instead of the predicted span ("
+                     << window_pointer->time_span_start << ", "
+                     << window_pointer->time_span_end << ")");
+        });
+    last_span_end = span.second;
+    pending_windows_.push_back(
+        PendingWindow{std::move(window), std::move(read)});
+  }
+}
+
+template <typename BufferTags>
+void WorldtubeBufferPrefetcher<BufferTags>::clear() noexcept {
+  for (auto& pending_window : pending_windows_) {
+    pending_window.read.wait();
+    spare_windows_.push_back(std::move(pending_window.window));
+  }
+  pending_windows_.clear();
+}
+
+template <typename BufferTags>
+void WorldtubeBufferPrefetcher<BufferTags>::pup(PUP::er& p) noexcept {
+  p | prefetch_depth_;
+}
+
+template class WorldtubeBufferPrefetcher<cce_metric_input_tags>;
+template class WorldtubeBufferPrefetcher<cce_bondi_input_tags>;
+}  // namespace detail
+}  // namespace Cce
@@ -0,0 +1,124 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+class DataVector;
+namespace PUP {
+class er;
+}  // namespace PUP
+namespace Parallel {
+class NodeLock;
+}  // namespace Parallel
+/// \endcond
+
+namespace Cce {
+namespace detail {
+/*!
+ * \brief Reads the windows of worldtube data that follow the one currently
+ * used by a worldtube data manager on background threads, so that the
+ * evolution does not wait on the (often slow) file reads when the data manager
+ * moves on to the next window.
+ *
+ * \details At most `prefetch_depth` windows are read ahead. Each window is
+ * the same span of times that `WorldtubeBufferUpdater::update_buffers_for_time`
+ * would load when the previous window no longer covers the requested time, and
+ * is read by a clone of the data manager's buffer updater so that the
+ * background reads share no state with the data manager. The reads hold a
+ * process-wide `std::mutex`, so reads on different background threads never
+ * overlap, as well as the node's HDF5 lock, so they are serialized with the
+ * HDF5 access that other threads of an SMP build perform under that lock. The
+ * data manager's own synchronous reads never overlap with its background reads
+ * because `retrieve_buffers_for_time()` waits for all pending reads before it
+ * returns `false`. Note that in non-SMP builds the node's HDF5 lock is a no-op,
+ * so other HDF5 access on the Charm++ thread (e.g. by observers) is only
+ * serialized with the background reads if the HDF5 library is built
+ * thread-safe. `Cce::Tags::H5WorldtubeBoundaryDataManager` therefore refuses
+ * a nonzero `prefetch_depth` if it isn't.
+ *
+ * A `prefetch_depth` of zero disables the prefetching, in which case
+ * `retrieve_buffers_for_time()` only reports whether the current buffers
+ * already cover the requested time.
+ */
+template <typename BufferTags>
+class WorldtubeBufferPrefetcher {
+ public:
+  WorldtubeBufferPrefetcher() = default;
+  explicit WorldtubeBufferPrefetcher(size_t prefetch_depth) noexcept;
+
+  WorldtubeBufferPrefetcher(const WorldtubeBufferPrefetcher&) = delete;
+  WorldtubeBufferPrefetcher& operator=(const WorldtubeBufferPrefetcher&) =
+      delete;
+  WorldtubeBufferPrefetcher(WorldtubeBufferPrefetcher&&) = default;
+  WorldtubeBufferPrefetcher& operator=(
+      WorldtubeBufferPrefetcher&& rhs) noexcept;
+  ~WorldtubeBufferPrefetcher() noexcept;
+
+  /*!
+   * \brief Ensures that `buffers` covers `time` if that is possible without
+   * reading the file on the calling thread.
+   *
+   * \details Returns `true` if the buffers spanning `time_span_start` to
+   * `time_span_end` already cover `time`, or if a prefetched window that
+   * covers `time` was swapped into `buffers` (waiting for its read to finish,
+   * if necessary). Otherwise, all pending reads are waited for and discarded,
+   * so that the caller may safely update the buffers synchronously, and
+   * `false` is returned.
+   */
+  bool retrieve_buffers_for_time(gsl::not_null<Variables<BufferTags>*> buffers,
+                                 gsl::not_null<size_t*> time_span_start,
+                                 gsl::not_null<size_t*> time_span_end,
+                                 double time, size_t interpolator_length,
+                                 const DataVector& time_buffer) noexcept;
+
+  /// \brief Starts background reads of the windows that follow the one ending
+  /// at `time_span_end`, until `prefetch_depth` windows are pending or the end
+  /// of the data is reached.
+  void prefetch_after(const WorldtubeBufferUpdater<BufferTags>& buffer_updater,
+                      size_t time_span_end, size_t l_max,
+                      size_t interpolator_length, size_t buffer_depth,
+                      size_t buffer_size,
+                      gsl::not_null<Parallel::NodeLock*> hdf5_lock) noexcept;
+
+  /// Waits for and discards all pending reads.
+  void clear() noexcept;
+
+  size_t prefetch_depth() const noexcept { return prefetch_depth_; }
+
+  /// Serialization for Charm++. Only the depth is serialized; pending reads
+  /// are not.
+  void pup(PUP::er& p) noexcept;  // NOLINT
+
+ private:
+  struct Window {
+    Variables<BufferTags> buffers{};
+    size_t time_span_start = 0;
+    size_t time_span_end = 0;
+  };
+
+  struct PendingWindow {
+    std::unique_ptr<Window> window;
+    // declared after `window` so that destroying a `PendingWindow` waits for
+    // the read before freeing the buffers it writes to
+    std::future<void> read;
+  };
+
+  size_t prefetch_depth_ = 0;
+  // declared before `pending_windows_` so that it outlives the reads using it
+  std::unique_ptr<WorldtubeBufferUpdater<BufferTags>> buffer_updater_;
+  std::deque<PendingWindow> pending_windows_;
+  std::vector<std::unique_ptr<Window>> spare_windows_;
+};
+}  // namespace detail
+}  // namespace Cce
@@ -16,6 +16,7 @@
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "Evolution/Systems/Cce/SpecBoundaryData.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/Spectral/SwshTransform.hpp"
@@ -29,14 +30,15 @@ MetricWorldtubeDataManager::MetricWorldtubeDataManager(
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
     std::unique_ptr<intrp::SpanInterpolator> interpolator,
-    const bool fix_spec_normalization) noexcept
+    const bool fix_spec_normalization, const size_t prefetch_depth) noexcept
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       fix_spec_normalization_{fix_spec_normalization},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
       buffer_depth_{buffer_depth},
-      interpolator_{std::move(interpolator)} {
+      interpolator_{std::move(interpolator)},
+      prefetcher_{prefetch_depth} {
   if (UNLIKELY(
           buffer_updater_->get_time_buffer().size() <
           2 * interpolator_->required_number_of_points_before_and_after())) {
@@ -76,13 +78,23 @@ bool MetricWorldtubeDataManager::populate_hypersurface_boundary_data(
   if (buffer_updater_->time_is_outside_range(time)) {
     return false;
   }
-  hdf5_lock->lock();
-  buffer_updater_->update_buffers_for_time(
-      make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
-      make_not_null(&time_span_end_), time, l_max_,
+  if (not prefetcher_.retrieve_buffers_for_time(
+          make_not_null(&coefficients_buffers_),
+          make_not_null(&time_span_start_), make_not_null(&time_span_end_),
+          time, interpolator_->required_number_of_points_before_and_after(),
+          buffer_updater_->get_time_buffer())) {
+    hdf5_lock->lock();
+    buffer_updater_->update_buffers_for_time(
+        make_not_null(&coefficients_buffers_),
+        make_not_null(&time_span_start_), make_not_null(&time_span_end_), time,
+        l_max_, interpolator_->required_number_of_points_before_and_after(),
+        buffer_depth_);
+    hdf5_lock->unlock();
+  }
+  prefetcher_.prefetch_after(
+      *buffer_updater_, time_span_end_, l_max_,
       interpolator_->required_number_of_points_before_and_after(),
-      buffer_depth_);
-  hdf5_lock->unlock();
+      buffer_depth_, coefficients_buffers_.number_of_grid_points(), hdf5_lock);
   const auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator_->required_number_of_points_before_and_after(),
       time_span_start_, time_span_end_, buffer_updater_->get_time_buffer());
@@ -236,7 +248,8 @@ std::unique_ptr<WorldtubeDataManager> MetricWorldtubeDataManager::get_clone()
     const noexcept {
   return std::make_unique<MetricWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone(), fix_spec_normalization_);
+      interpolator_->get_clone(), fix_spec_normalization_,
+      prefetcher_.prefetch_depth());
 }
 
 std::pair<size_t, size_t> MetricWorldtubeDataManager::get_time_span()
@@ -252,6 +265,7 @@ void MetricWorldtubeDataManager::pup(PUP::er& p) noexcept {
   p | buffer_depth_;
   p | interpolator_;
   p | fix_spec_normalization_;
+  p | prefetcher_;
   if (p.isUnpacking()) {
     time_span_start_ = 0;
     time_span_end_ = 0;
@@ -269,13 +283,15 @@ BondiWorldtubeDataManager::BondiWorldtubeDataManager(
     std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>>
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
-    std::unique_ptr<intrp::SpanInterpolator> interpolator) noexcept
+    std::unique_ptr<intrp::SpanInterpolator> interpolator,
+    const size_t prefetch_depth) noexcept
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
       buffer_depth_{buffer_depth},
-      interpolator_{std::move(interpolator)} {
+      interpolator_{std::move(interpolator)},
+      prefetcher_{prefetch_depth} {
   if (UNLIKELY(
           buffer_updater_->get_time_buffer().size() <
           2 * interpolator_->required_number_of_points_before_and_after())) {
@@ -313,13 +329,23 @@ bool BondiWorldtubeDataManager::populate_hypersurface_boundary_data(
   if (buffer_updater_->time_is_outside_range(time)) {
     return false;
   }
-  hdf5_lock->lock();
-  buffer_updater_->update_buffers_for_time(
-      make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
-      make_not_null(&time_span_end_), time, l_max_,
+  if (not prefetcher_.retrieve_buffers_for_time(
+          make_not_null(&coefficients_buffers_),
+          make_not_null(&time_span_start_), make_not_null(&time_span_end_),
+          time, interpolator_->required_number_of_points_before_and_after(),
+          buffer_updater_->get_time_buffer())) {
+    hdf5_lock->lock();
+    buffer_updater_->update_buffers_for_time(
+        make_not_null(&coefficients_buffers_),
+        make_not_null(&time_span_start_), make_not_null(&time_span_end_), time,
+        l_max_, interpolator_->required_number_of_points_before_and_after(),
+        buffer_depth_);
+    hdf5_lock->unlock();
+  }
+  prefetcher_.prefetch_after(
+      *buffer_updater_, time_span_end_, l_max_,
       interpolator_->required_number_of_points_before_and_after(),
-      buffer_depth_);
-  hdf5_lock->unlock();
+      buffer_depth_, coefficients_buffers_.number_of_grid_points(), hdf5_lock);
   auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator_->required_number_of_points_before_and_after(),
       time_span_start_, time_span_end_, buffer_updater_->get_time_buffer());
@@ -421,7 +447,7 @@ std::unique_ptr<WorldtubeDataManager> BondiWorldtubeDataManager::get_clone()
     const noexcept {
   return std::make_unique<BondiWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone());
+      interpolator_->get_clone(), prefetcher_.prefetch_depth());
 }
 
 std::pair<size_t, size_t> BondiWorldtubeDataManager::get_time_span()
@@ -436,6 +462,7 @@ void BondiWorldtubeDataManager::pup(PUP::er& p) noexcept {
   p | l_max_;
   p | buffer_depth_;
   p | interpolator_;
+  p | prefetcher_;
   if (p.isUnpacking()) {
     time_span_start_ = 0;
     time_span_end_ = 0;
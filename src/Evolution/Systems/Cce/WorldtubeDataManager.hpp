@@ -11,6 +11,7 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
 #include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "Parallel/CharmPupable.hpp"
@@ -78,6 +79,10 @@ class WorldtubeDataManager : public PUP::able {
  * the `Interpolator` and the `buffer_depth` also passed to the constructor. A
  * longer depth will ensure that the buffer updater is called less frequently,
  * which is useful for slow updaters (e.g. those that perform file access).
+ * If `prefetch_depth` is nonzero, up to that many of the following buffers are
+ * read on background threads while the current one is used (see
+ * `detail::WorldtubeBufferPrefetcher`), so that the evolution rarely has to
+ * wait for the file.
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation.
@@ -92,7 +97,7 @@ class MetricWorldtubeDataManager : public WorldtubeDataManager {
           buffer_updater,
       size_t l_max, size_t buffer_depth,
       std::unique_ptr<intrp::SpanInterpolator> interpolator,
-      bool fix_spec_normalization) noexcept;
+      bool fix_spec_normalization, size_t prefetch_depth = 0) noexcept;
 
   WRAPPED_PUPable_decl_template(MetricWorldtubeDataManager);  // NOLINT
 
@@ -153,6 +158,10 @@ class MetricWorldtubeDataManager : public WorldtubeDataManager {
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+
+  // declared last so that pending reads finish before the other members are
+  // destroyed
+  mutable detail::WorldtubeBufferPrefetcher<cce_metric_input_tags> prefetcher_;
 };
 
 /*!
@@ -164,6 +173,10 @@ class MetricWorldtubeDataManager : public WorldtubeDataManager {
  * the `Interpolator` and the `buffer_depth` also passed to the constructor. A
  * longer depth will ensure that the buffer updater is called less frequently,
  * which is useful for slow updaters (e.g. those that perform file access).
+ * If `prefetch_depth` is nonzero, up to that many of the following buffers are
+ * read on background threads while the current one is used (see
+ * `detail::WorldtubeBufferPrefetcher`), so that the evolution rarely has to
+ * wait for the file.
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation. This version
@@ -181,7 +194,8 @@ class BondiWorldtubeDataManager : public WorldtubeDataManager {
       std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>>
           buffer_updater,
       size_t l_max, size_t buffer_depth,
-      std::unique_ptr<intrp::SpanInterpolator> interpolator) noexcept;
+      std::unique_ptr<intrp::SpanInterpolator> interpolator,
+      size_t prefetch_depth = 0) noexcept;
 
   WRAPPED_PUPable_decl_template(BondiWorldtubeDataManager);  // NOLINT
 
@@ -239,5 +253,9 @@ class BondiWorldtubeDataManager : public WorldtubeDataManager {
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+
+  // declared last so that pending reads finish before the other members are
+  // destroyed
+  mutable detail::WorldtubeBufferPrefetcher<cce_bondi_input_tags> prefetcher_;
 };
 }  // namespace Cce
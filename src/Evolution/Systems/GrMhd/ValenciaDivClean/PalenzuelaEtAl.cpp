@@ -3,15 +3,20 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <exception>
 #include <limits>
+#include <utility>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
 
@@ -91,6 +96,105 @@ class FunctionOfX {
   const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
       equation_of_state_;
 };
+
+// Replaces `data` by its elements at the (increasing) indices `kept`.
+void retain_elements(const gsl::not_null<DataVector*> data,
+                     const std::vector<size_t>& kept) noexcept {
+  DataVector result(kept.size());
+  for (size_t i = 0; i < kept.size(); ++i) {
+    result[i] = (*data)[kept[i]];
+  }
+  *data = std::move(result);
+}
+
+// The same function as FunctionOfX, evaluated on a set of points at once.  The
+// set of points can be reduced with `retain` as points converge.
+template <size_t ThermodynamicDim>
+class BatchedFunctionOfX {
+ public:
+  BatchedFunctionOfX(const DataVector& total_energy_density,
+                     const DataVector& momentum_density_squared,
+                     const DataVector& momentum_density_dot_magnetic_field,
+                     const DataVector& magnetic_field_squared,
+                     const DataVector& rest_mass_density_times_lorentz_factor,
+                     const EquationsOfState::EquationOfState<
+                         true, ThermodynamicDim>& equation_of_state) noexcept
+      : q_(total_energy_density / rest_mass_density_times_lorentz_factor - 1.0),
+        r_(momentum_density_squared /
+           square(rest_mass_density_times_lorentz_factor)),
+        s_(magnetic_field_squared / rest_mass_density_times_lorentz_factor),
+        t_squared_(square(momentum_density_dot_magnetic_field) /
+                   cube(rest_mass_density_times_lorentz_factor)),
+        rest_mass_density_times_lorentz_factor_(
+            rest_mass_density_times_lorentz_factor),
+        equation_of_state_(equation_of_state) {}
+
+  void retain(const std::vector<size_t>& kept) noexcept {
+    retain_elements(make_not_null(&q_), kept);
+    retain_elements(make_not_null(&r_), kept);
+    retain_elements(make_not_null(&s_), kept);
+    retain_elements(make_not_null(&t_squared_), kept);
+    retain_elements(
+        make_not_null(&rest_mass_density_times_lorentz_factor_), kept);
+  }
+
+  const DataVector& rest_mass_density_times_lorentz_factor() const noexcept {
+    return rest_mass_density_times_lorentz_factor_;
+  }
+
+  DataVector lorentz_factor(const DataVector& x) const noexcept {
+    static constexpr double v_maximum = 1.0 - 1.e-12;
+    // See FunctionOfX::lorentz_factor for why v^2 is clamped.
+    return 1.0 /
+           sqrt(1.0 - clamp((square(x) * r_ + (2.0 * x + s_) * t_squared_) /
+                                square(x * (x + s_)),
+                            0.0, square(v_maximum)));
+  }
+
+  DataVector specific_internal_energy(
+      const DataVector& x, const DataVector& lorentz_factor) const noexcept {
+    return lorentz_factor - 1.0 +
+           x * (1.0 - square(lorentz_factor)) / lorentz_factor +
+           lorentz_factor * (q_ - s_ + 0.5 * t_squared_ / square(x) +
+                             0.5 * s_ / square(lorentz_factor));
+  }
+
+  DataVector pressure(const DataVector& rest_mass_density,
+                      const DataVector& specific_internal_energy) const
+      noexcept {
+    if constexpr (ThermodynamicDim == 1) {
+      (void)specific_internal_energy;
+      return get(equation_of_state_.pressure_from_density(
+          Scalar<DataVector>{rest_mass_density}));
+    } else if constexpr (ThermodynamicDim == 2) {
+      return get(equation_of_state_.pressure_from_density_and_energy(
+          Scalar<DataVector>{rest_mass_density},
+          Scalar<DataVector>{specific_internal_energy}));
+    }
+  }
+
+  DataVector operator()(const DataVector& x) const noexcept {
+    const DataVector current_lorentz_factor = lorentz_factor(x);
+    const DataVector current_rest_mass_density =
+        rest_mass_density_times_lorentz_factor_ / current_lorentz_factor;
+    const DataVector current_specific_internal_energy =
+        specific_internal_energy(x, current_lorentz_factor);
+    return x - (1.0 + current_specific_internal_energy +
+                pressure(current_rest_mass_density,
+                         current_specific_internal_energy) /
+                    current_rest_mass_density) *
+                   current_lorentz_factor;
+  }
+
+ private:
+  DataVector q_;
+  DataVector r_;
+  DataVector s_;
+  DataVector t_squared_;
+  DataVector rest_mass_density_times_lorentz_factor_;
+  const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+      equation_of_state_;
+};
 }  // namespace
 
 template <size_t ThermodynamicDim>
@@ -145,6 +249,190 @@ std::optional<PrimitiveRecoveryData> PalenzuelaEtAl::apply(
                                specific_enthalpy_times_lorentz_factor *
                                    rest_mass_density_times_lorentz_factor};
 }
+
+template <size_t ThermodynamicDim>
+std::vector<size_t> PalenzuelaEtAl::apply(
+    const gsl::not_null<DataVector*> rest_mass_density,
+    const gsl::not_null<DataVector*> lorentz_factor,
+    const gsl::not_null<DataVector*> pressure,
+    const gsl::not_null<DataVector*> rho_h_w_squared,
+    const DataVector& total_energy_density,
+    const DataVector& momentum_density_squared,
+    const DataVector& momentum_density_dot_magnetic_field,
+    const DataVector& magnetic_field_squared,
+    const DataVector& rest_mass_density_times_lorentz_factor,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) noexcept {
+  const size_t number_of_points = total_energy_density.size();
+  std::vector<size_t> failed_points{};
+  BatchedFunctionOfX<ThermodynamicDim> f_of_x{
+      total_energy_density,
+      momentum_density_squared,
+      momentum_density_dot_magnetic_field,
+      magnetic_field_squared,
+      rest_mass_density_times_lorentz_factor,
+      equation_of_state};
+
+  // The bracket [a, b] of each unconverged point, the function values at its
+  // ends, and the index of the point in the input.
+  DataVector a = (total_energy_density - magnetic_field_squared) /
+                 rest_mass_density_times_lorentz_factor;
+  DataVector b = (2.0 * total_energy_density - magnetic_field_squared) /
+                 rest_mass_density_times_lorentz_factor;
+  std::vector<size_t> active_points{};
+  active_points.reserve(number_of_points);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    // RootFinder::toms748 rejects inverted brackets, so do the same here.
+    if (a[s] < b[s]) {
+      active_points.push_back(s);
+    } else {
+      failed_points.push_back(s);
+    }
+  }
+  if (active_points.size() != number_of_points) {
+    retain_elements(make_not_null(&a), active_points);
+    retain_elements(make_not_null(&b), active_points);
+    f_of_x.retain(active_points);
+  }
+  DataVector f_a = f_of_x(a);
+  DataVector f_b = f_of_x(b);
+
+  // The root of each converged point, stored at its index in the input.
+  DataVector root(number_of_points, 0.0);
+  std::vector<size_t> converged_points{};
+  converged_points.reserve(number_of_points);
+  std::vector<size_t> kept{};
+  kept.reserve(active_points.size());
+  for (size_t i = 0; i < active_points.size(); ++i) {
+    if (f_a[i] == 0.0) {
+      root[active_points[i]] = a[i];
+      converged_points.push_back(active_points[i]);
+    } else if (f_b[i] == 0.0) {
+      root[active_points[i]] = b[i];
+      converged_points.push_back(active_points[i]);
+    } else if (f_a[i] * f_b[i] < 0.0) {
+      kept.push_back(i);
+    } else {
+      // Either the root is not bracketed or the function is not finite.
+      failed_points.push_back(active_points[i]);
+    }
+  }
+  if (kept.size() != active_points.size()) {
+    retain_elements(make_not_null(&a), kept);
+    retain_elements(make_not_null(&b), kept);
+    retain_elements(make_not_null(&f_a), kept);
+    retain_elements(make_not_null(&f_b), kept);
+    f_of_x.retain(kept);
+    for (size_t i = 0; i < kept.size(); ++i) {
+      active_points[i] = active_points[kept[i]];
+    }
+    active_points.resize(kept.size());
+  }
+
+  // The end of the bracket that was replaced in the previous iteration, used
+  // by the Illinois modification: -1 for a, +1 for b, 0 for neither.
+  std::vector<int> last_replaced(active_points.size(), 0);
+  for (size_t iteration = 0;
+       iteration < max_iterations_ and not active_points.empty(); ++iteration) {
+    DataVector x = (a * f_b - b * f_a) / (f_b - f_a);
+    for (size_t i = 0; i < x.size(); ++i) {
+      // Fall back to bisection if round-off moves x out of the bracket.
+      if (not(x[i] > a[i] and x[i] < b[i])) {
+        x[i] = a[i] + 0.5 * (b[i] - a[i]);
+      }
+    }
+    const DataVector f_x = f_of_x(x);
+
+    kept.clear();
+    for (size_t i = 0; i < x.size(); ++i) {
+      if (f_x[i] == 0.0) {
+        root[active_points[i]] = x[i];
+        converged_points.push_back(active_points[i]);
+        continue;
+      }
+      if (f_x[i] * f_b[i] > 0.0) {
+        b[i] = x[i];
+        f_b[i] = f_x[i];
+        if (last_replaced[i] == 1) {
+          f_a[i] *= 0.5;
+        }
+        last_replaced[i] = 1;
+      } else if (f_x[i] * f_a[i] > 0.0) {
+        a[i] = x[i];
+        f_a[i] = f_x[i];
+        if (last_replaced[i] == -1) {
+          f_b[i] *= 0.5;
+        }
+        last_replaced[i] = -1;
+      } else {
+        failed_points.push_back(active_points[i]);
+        continue;
+      }
+      // Same termination criterion as RootFinder::toms748
+      if (std::abs(b[i] - a[i]) <=
+          absolute_tolerance_ +
+              relative_tolerance_ * std::min(std::abs(a[i]), std::abs(b[i]))) {
+        root[active_points[i]] = a[i] + 0.5 * (b[i] - a[i]);
+        converged_points.push_back(active_points[i]);
+        continue;
+      }
+      kept.push_back(i);
+    }
+
+    if (kept.size() != active_points.size()) {
+      retain_elements(make_not_null(&a), kept);
+      retain_elements(make_not_null(&b), kept);
+      retain_elements(make_not_null(&f_a), kept);
+      retain_elements(make_not_null(&f_b), kept);
+      f_of_x.retain(kept);
+      for (size_t i = 0; i < kept.size(); ++i) {
+        active_points[i] = active_points[kept[i]];
+        last_replaced[i] = last_replaced[kept[i]];
+      }
+      active_points.resize(kept.size());
+      last_replaced.resize(kept.size());
+    }
+  }
+  // Points that did not converge within max_iterations_
+  failed_points.insert(failed_points.end(), active_points.begin(),
+                       active_points.end());
+  std::sort(failed_points.begin(), failed_points.end());
+
+  if (converged_points.empty()) {
+    return failed_points;
+  }
+  // Evaluate the primitives at the roots of all converged points at once.
+  std::sort(converged_points.begin(), converged_points.end());
+  BatchedFunctionOfX<ThermodynamicDim> converged_f_of_x{
+      total_energy_density,
+      momentum_density_squared,
+      momentum_density_dot_magnetic_field,
+      magnetic_field_squared,
+      rest_mass_density_times_lorentz_factor,
+      equation_of_state};
+  if (converged_points.size() != number_of_points) {
+    retain_elements(make_not_null(&root), converged_points);
+    converged_f_of_x.retain(converged_points);
+  }
+  const DataVector converged_lorentz_factor =
+      converged_f_of_x.lorentz_factor(root);
+  const DataVector converged_rest_mass_density =
+      converged_f_of_x.rest_mass_density_times_lorentz_factor() /
+      converged_lorentz_factor;
+  const DataVector converged_pressure = converged_f_of_x.pressure(
+      converged_rest_mass_density,
+      converged_f_of_x.specific_internal_energy(root,
+                                                converged_lorentz_factor));
+  for (size_t i = 0; i < converged_points.size(); ++i) {
+    const size_t s = converged_points[i];
+    (*rest_mass_density)[s] = converged_rest_mass_density[i];
+    (*lorentz_factor)[s] = converged_lorentz_factor[i];
+    (*pressure)[s] = converged_pressure[i];
+    (*rho_h_w_squared)[s] =
+        root[i] * rest_mass_density_times_lorentz_factor[s];
+  }
+  return failed_points;
+}
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
 
 #define THERMODIM(data) BOOST_PP_TUPLE_ELEM(0, data)
@@ -159,6 +447,20 @@ std::optional<PrimitiveRecoveryData> PalenzuelaEtAl::apply(
       const double momentum_density_dot_magnetic_field,                      \
       const double magnetic_field_squared,                                   \
       const double rest_mass_density_times_lorentz_factor,                   \
+      const EquationsOfState::EquationOfState<true, THERMODIM(data)>&        \
+          equation_of_state) noexcept;                                     \
+  template std::vector<size_t>                                               \
+  grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl::apply<  \
+      THERMODIM(data)>(                                                      \
+      const gsl::not_null<DataVector*> rest_mass_density,                    \
+      const gsl::not_null<DataVector*> lorentz_factor,                       \
+      const gsl::not_null<DataVector*> pressure,                             \
+      const gsl::not_null<DataVector*> rho_h_w_squared,                      \
+      const DataVector& total_energy_density,                                \
+      const DataVector& momentum_density_squared,                            \
+      const DataVector& momentum_density_dot_magnetic_field,                 \
+      const DataVector& magnetic_field_squared,                              \
+      const DataVector& rest_mass_density_times_lorentz_factor,              \
       const EquationsOfState::EquationOfState<true, THERMODIM(data)>&        \
           equation_of_state) noexcept;
 
@@ -7,11 +7,20 @@
 #include <limits>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
 
+/// \cond
+class DataVector;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
 namespace grmhd {
 namespace ValenciaDivClean {
 namespace PrimitiveRecoverySchemes {
@@ -47,6 +56,18 @@ struct PrimitiveRecoveryData;
  * density, momentum density, specific internal energy density, and magnetic
  * field, and \f$\gamma\f$ and \f$\gamma^{mn}\f$ are the determinant and inverse
  * of the spatial metric \f$\gamma_{mn}\f$.
+ *
+ * In addition to the pointwise `apply`, which finds the root with
+ * `RootFinder::toms748`, there is a batched `apply` that recovers the
+ * primitives at all points of a `DataVector` at once.  The batched version
+ * brackets the root in the same way but iterates the Illinois variant of the
+ * regula falsi method on all unconverged points simultaneously, so that each
+ * iteration is a handful of vectorized `DataVector` operations and a single
+ * call to the equation of state instead of one virtual call per point.
+ * Points are removed from the iteration as soon as they converge.  The
+ * indices of the points at which the recovery failed are returned, and the
+ * outputs at those points are left untouched so that the caller can retry
+ * them with a pointwise scheme.
  */
 class PalenzuelaEtAl {
  public:
@@ -59,6 +80,20 @@ class PalenzuelaEtAl {
       const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
           equation_of_state) noexcept;
 
+  template <size_t ThermodynamicDim>
+  static std::vector<size_t> apply(
+      gsl::not_null<DataVector*> rest_mass_density,
+      gsl::not_null<DataVector*> lorentz_factor,
+      gsl::not_null<DataVector*> pressure,
+      gsl::not_null<DataVector*> rho_h_w_squared,
+      const DataVector& total_energy_density,
+      const DataVector& momentum_density_squared,
+      const DataVector& momentum_density_dot_magnetic_field,
+      const DataVector& magnetic_field_squared,
+      const DataVector& rest_mass_density_times_lorentz_factor,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state) noexcept;
+
   static const std::string name() noexcept { return "PalenzuelaEtAl"; }
 
  private:
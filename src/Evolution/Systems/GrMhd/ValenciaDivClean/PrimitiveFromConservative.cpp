@@ -7,6 +7,9 @@
 #include <limits>
 #include <optional>
 #include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
@@ -34,6 +37,30 @@
 
 namespace grmhd::ValenciaDivClean {
 
+namespace {
+// Detects whether a primitive recovery scheme provides a batched `apply` that
+// recovers the primitives on whole `DataVector`s and returns the indices of
+// the points at which it failed.
+template <typename PrimitiveRecoveryScheme, size_t ThermodynamicDim,
+          typename = std::void_t<>>
+struct has_batched_apply : std::false_type {};
+
+template <typename PrimitiveRecoveryScheme, size_t ThermodynamicDim>
+struct has_batched_apply<
+    PrimitiveRecoveryScheme, ThermodynamicDim,
+    std::void_t<decltype(PrimitiveRecoveryScheme::template apply<
+                         ThermodynamicDim>(
+        std::declval<gsl::not_null<DataVector*>>(),
+        std::declval<gsl::not_null<DataVector*>>(),
+        std::declval<gsl::not_null<DataVector*>>(),
+        std::declval<gsl::not_null<DataVector*>>(),
+        std::declval<const DataVector&>(), std::declval<const DataVector&>(),
+        std::declval<const DataVector&>(), std::declval<const DataVector&>(),
+        std::declval<const DataVector&>(),
+        std::declval<const EquationsOfState::EquationOfState<
+            true, ThermodynamicDim>&>()))>> : std::true_type {};
+}  // namespace
+
 template <typename OrderedListOfPrimitiveRecoverySchemes,
           size_t ThermodynamicDim>
 void PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
@@ -64,10 +91,10 @@ void PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
     magnetic_field->get(i) = tilde_b.get(i) / get(sqrt_det_spatial_metric);
   }
   const size_t size = get<0>(tilde_b).size();
-  Variables<
-      tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
-                 ::Tags::TempScalar<2>, ::Tags::TempScalar<3>,
-                 ::Tags::TempScalar<4>, ::Tags::TempI<5, 3, Frame::Inertial>>>
+  Variables<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
+                       ::Tags::TempScalar<2>, ::Tags::TempScalar<3>,
+                       ::Tags::TempScalar<4>, ::Tags::TempScalar<5>,
+                       ::Tags::TempI<6, 3, Frame::Inertial>>>
       temp_buffer(size);
 
   DataVector& total_energy_density =
@@ -76,7 +103,7 @@ void PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
       (get(tilde_tau) + get(tilde_d)) / get(sqrt_det_spatial_metric);
 
   tnsr::I<DataVector, 3, Frame::Inertial>& tilde_s_upper =
-      get<::Tags::TempI<5, 3, Frame::Inertial>>(temp_buffer);
+      get<::Tags::TempI<6, 3, Frame::Inertial>>(temp_buffer);
   raise_or_lower_index(make_not_null(&tilde_s_upper), tilde_s,
                        inv_spatial_metric);
 
@@ -101,7 +128,14 @@ void PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
   rest_mass_density_times_lorentz_factor =
       get(tilde_d) / get(sqrt_det_spatial_metric);
 
-  for (size_t s = 0; s < total_energy_density.size(); ++s) {
+  DataVector& rho_h_w_squared = get(get<::Tags::TempScalar<5>>(temp_buffer));
+
+  const auto recover_at_point = [
+    &rest_mass_density, &lorentz_factor, &pressure, &rho_h_w_squared,
+    &total_energy_density, &momentum_density_squared,
+    &momentum_density_dot_magnetic_field, &magnetic_field_squared,
+    &rest_mass_density_times_lorentz_factor, &equation_of_state
+  ](const size_t s) noexcept {
     std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>
         primitive_data = std::nullopt;
     tmpl::for_each<OrderedListOfPrimitiveRecoverySchemes>([
@@ -124,22 +158,9 @@ void PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
 
     if (primitive_data.has_value()) {
       get(*rest_mass_density)[s] = primitive_data.value().rest_mass_density;
-      const double coefficient_of_b =
-          get(momentum_density_dot_magnetic_field)[s] /
-          (primitive_data.value().rho_h_w_squared *
-           (primitive_data.value().rho_h_w_squared +
-            get(magnetic_field_squared)[s]));
-      const double coefficient_of_s =
-          1.0 / (get(sqrt_det_spatial_metric)[s] *
-                 (primitive_data.value().rho_h_w_squared +
-                  get(magnetic_field_squared)[s]));
-      for (size_t i = 0; i < 3; ++i) {
-        spatial_velocity->get(i)[s] =
-            coefficient_of_b * magnetic_field->get(i)[s] +
-            coefficient_of_s * tilde_s_upper.get(i)[s];
-      }
       get(*lorentz_factor)[s] = primitive_data.value().lorentz_factor;
       get(*pressure)[s] = primitive_data.value().pressure;
+      rho_h_w_squared[s] = primitive_data.value().rho_h_w_squared;
     } else {
       ERROR("All primitive inversion schemes failed at s = "
             << s << ".\n"
@@ -158,6 +179,46 @@ void PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
             << "previous_pressure = " << get(*pressure)[s] << "\n"
             << "previous_lorentz_factor = " << get(*lorentz_factor)[s] << "\n");
     }
+  };
+
+  // If the first scheme can recover all points at once, use it and only retry
+  // the points at which it failed with the full list of pointwise schemes.
+  // The batched iteration is not the same root finder as the pointwise one, so
+  // the first scheme is retried as well.
+  using first_scheme = tmpl::front<OrderedListOfPrimitiveRecoverySchemes>;
+  if constexpr (has_batched_apply<first_scheme, ThermodynamicDim>::value) {
+    const std::vector<size_t> failed_points =
+        first_scheme::template apply<ThermodynamicDim>(
+            make_not_null(&get(*rest_mass_density)),
+            make_not_null(&get(*lorentz_factor)),
+            make_not_null(&get(*pressure)), make_not_null(&rho_h_w_squared),
+            total_energy_density, get(momentum_density_squared),
+            get(momentum_density_dot_magnetic_field),
+            get(magnetic_field_squared), rest_mass_density_times_lorentz_factor,
+            equation_of_state);
+    for (const size_t s : failed_points) {
+      recover_at_point(s);
+    }
+  } else {
+    for (size_t s = 0; s < size; ++s) {
+      recover_at_point(s);
+    }
+  }
+
+  // With rho h W^2 known at every point, the velocity is computed for all
+  // points at once.  `total_energy_density` and
+  // `rest_mass_density_times_lorentz_factor` are no longer needed and are
+  // reused as buffers.
+  DataVector& coefficient_of_b = total_energy_density;
+  coefficient_of_b =
+      get(momentum_density_dot_magnetic_field) /
+      (rho_h_w_squared * (rho_h_w_squared + get(magnetic_field_squared)));
+  DataVector& coefficient_of_s = rest_mass_density_times_lorentz_factor;
+  coefficient_of_s = 1.0 / (get(sqrt_det_spatial_metric) *
+                            (rho_h_w_squared + get(magnetic_field_squared)));
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_velocity->get(i) = coefficient_of_b * magnetic_field->get(i) +
+                               coefficient_of_s * tilde_s_upper.get(i);
   }
   if constexpr (ThermodynamicDim == 1) {
     *specific_internal_energy =
@@ -183,6 +244,9 @@ void PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
 using NewmanHamlinThenPalenzuelaEtAl = tmpl::list<
     grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin,
     grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>;
+using PalenzuelaEtAlThenNewmanHamlin = tmpl::list<
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl,
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin>;
 
 GENERATE_INSTANTIATIONS(
     INSTANTIATION,
@@ -190,7 +254,7 @@ GENERATE_INSTANTIATIONS(
          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin>,
      tmpl::list<
          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>,
-     NewmanHamlinThenPalenzuelaEtAl),
+     NewmanHamlinThenPalenzuelaEtAl, PalenzuelaEtAlThenNewmanHamlin),
     (1, 2))
 
 #undef INSTANTIATION
@@ -40,6 +40,13 @@ namespace ValenciaDivClean {
  * [Siegel {\em et al}, The Astrophysical Journal 859:71(2018)]
  * (http://iopscience.iop.org/article/10.3847/1538-4357/aabcc5/meta)
  * compares several inversion methods.
+ *
+ * The schemes in `OrderedListOfPrimitiveRecoverySchemes` are tried in order at
+ * each point until one succeeds.  If the first scheme provides a batched
+ * `apply` operating on `DataVector`s (e.g.
+ * `PrimitiveRecoverySchemes::PalenzuelaEtAl`), it is used to recover all points
+ * at once, and only the points at which it fails are passed through the
+ * pointwise schemes.
  */
 template <typename OrderedListOfPrimitiveRecoverySchemes,
           size_t ThermodynamicDim>
@@ -29,6 +29,35 @@ struct densitized_eta_minus_kappaJ {
 struct kappaT_lapse {
   using type = Scalar<DataVector>;
 };
+
+// P^{ij} v_j, the pressure tensor contracted with the fluid velocity
+struct PressureDotVelocity {
+  using type = tnsr::I<DataVector, 3>;
+};
+
+struct PressureDotVelocityOneForm {
+  using type = tnsr::i<DataVector, 3>;
+};
+
+struct ComovingEnergyDensity {
+  using type = Scalar<DataVector>;
+};
+
+struct ComovingMomentumDensityNormal {
+  using type = Scalar<DataVector>;
+};
+
+struct ComovingMomentumDensitySpatial {
+  using type = tnsr::i<DataVector, 3>;
+};
+
+struct VelocityDotMomentum {
+  using type = Scalar<DataVector>;
+};
+
+struct VelocityDotPressureDotVelocity {
+  using type = Scalar<DataVector>;
+};
 }  // namespace
 
 namespace RadiationTransport::M1Grey::detail {
@@ -74,4 +103,143 @@ void compute_m1_hydro_coupling_impl(
   }
 }
 
+void compute_implicit_m1_hydro_coupling_impl(
+    const gsl::not_null<Scalar<DataVector>*> source_n,
+    const gsl::not_null<tnsr::i<DataVector, 3>*> source_i,
+    const Scalar<DataVector>& tilde_e, const tnsr::i<DataVector, 3>& tilde_s,
+    const Scalar<DataVector>& emissivity,
+    const Scalar<DataVector>& absorption_opacity,
+    const Scalar<DataVector>& scattering_opacity,
+    const tnsr::II<DataVector, 3>& tilde_p,
+    const tnsr::I<DataVector, 3>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const Scalar<DataVector>& lapse,
+    const tnsr::ii<DataVector, 3>& spatial_metric,
+    const Scalar<DataVector>& sqrt_det_spatial_metric) noexcept {
+  Variables<tmpl::list<hydro::Tags::SpatialVelocityOneForm<DataVector, 3>,
+                       PressureDotVelocity, ComovingEnergyDensity,
+                       ComovingMomentumDensityNormal,
+                       ComovingMomentumDensitySpatial>>
+      temp_tensors(get(lapse).size());
+  constexpr size_t spatial_dim = 3;
+
+  auto& fluid_velocity_i =
+      get<hydro::Tags::SpatialVelocityOneForm<DataVector, 3>>(temp_tensors);
+  raise_or_lower_index(make_not_null(&fluid_velocity_i), fluid_velocity,
+                       spatial_metric);
+  auto& p_dot_v = get<PressureDotVelocity>(temp_tensors);
+  raise_or_lower_index(make_not_null(&p_dot_v), fluid_velocity_i, tilde_p);
+
+  // The comoving moments with the pressure tensor held fixed
+  auto& tilde_j = get<ComovingEnergyDensity>(temp_tensors);
+  get(tilde_j) = get(tilde_e);
+  for (size_t i = 0; i < spatial_dim; ++i) {
+    get(tilde_j) += fluid_velocity_i.get(i) * p_dot_v.get(i) -
+                    2. * fluid_velocity.get(i) * tilde_s.get(i);
+  }
+  get(tilde_j) *= square(get(fluid_lorentz_factor));
+  auto& tilde_hn = get<ComovingMomentumDensityNormal>(temp_tensors);
+  get(tilde_hn) = get(tilde_j) - get(tilde_e);
+  for (size_t i = 0; i < spatial_dim; ++i) {
+    get(tilde_hn) += fluid_velocity.get(i) * tilde_s.get(i);
+  }
+  get(tilde_hn) *= get(fluid_lorentz_factor);
+  auto& tilde_hi = get<ComovingMomentumDensitySpatial>(temp_tensors);
+  for (size_t i = 0; i < spatial_dim; ++i) {
+    tilde_hi.get(i) = tilde_s.get(i) - get(tilde_j) * fluid_velocity_i.get(i);
+    for (size_t j = 0; j < spatial_dim; ++j) {
+      tilde_hi.get(i) -= spatial_metric.get(i, j) * p_dot_v.get(j);
+    }
+    tilde_hi.get(i) *= get(fluid_lorentz_factor);
+  }
+
+  compute_m1_hydro_coupling_impl(
+      source_n, source_i, emissivity, absorption_opacity, scattering_opacity,
+      tilde_j, tilde_hn, tilde_hi, fluid_velocity, fluid_lorentz_factor, lapse,
+      spatial_metric, sqrt_det_spatial_metric);
+}
+
+void solve_implicit_m1_hydro_coupling_impl(
+    const gsl::not_null<Scalar<DataVector>*> tilde_e,
+    const gsl::not_null<tnsr::i<DataVector, 3>*> tilde_s,
+    const double implicit_weight, const Scalar<DataVector>& emissivity,
+    const Scalar<DataVector>& absorption_opacity,
+    const Scalar<DataVector>& scattering_opacity,
+    const tnsr::II<DataVector, 3>& tilde_p,
+    const tnsr::I<DataVector, 3>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const Scalar<DataVector>& lapse,
+    const tnsr::ii<DataVector, 3>& spatial_metric,
+    const Scalar<DataVector>& sqrt_det_spatial_metric) noexcept {
+  Variables<tmpl::list<hydro::Tags::SpatialVelocityOneForm<DataVector, 3>,
+                       PressureDotVelocity, PressureDotVelocityOneForm,
+                       VelocityDotMomentum, VelocityDotPressureDotVelocity,
+                       hydro::Tags::SpatialVelocitySquared<DataVector>>>
+      temp_tensors(get(lapse).size());
+  constexpr size_t spatial_dim = 3;
+
+  auto& fluid_velocity_i =
+      get<hydro::Tags::SpatialVelocityOneForm<DataVector, 3>>(temp_tensors);
+  raise_or_lower_index(make_not_null(&fluid_velocity_i), fluid_velocity,
+                       spatial_metric);
+  auto& p_dot_v = get<PressureDotVelocity>(temp_tensors);
+  raise_or_lower_index(make_not_null(&p_dot_v), fluid_velocity_i, tilde_p);
+  auto& p_dot_v_i = get<PressureDotVelocityOneForm>(temp_tensors);
+  raise_or_lower_index(make_not_null(&p_dot_v_i), p_dot_v, spatial_metric);
+  auto& v_sqr =
+      get<hydro::Tags::SpatialVelocitySquared<DataVector>>(temp_tensors);
+  dot_product(make_not_null(&v_sqr), fluid_velocity, fluid_velocity_i);
+  auto& v_dot_p_dot_v = get<VelocityDotPressureDotVelocity>(temp_tensors);
+  dot_product(make_not_null(&v_dot_p_dot_v), fluid_velocity_i, p_dot_v);
+  auto& v_dot_s = get<VelocityDotMomentum>(temp_tensors);
+  dot_product(make_not_null(&v_dot_s), fluid_velocity, *tilde_s);
+
+  // With the weight w, the Lorentz factor W, the lapse alpha and the
+  // opacities kT = ka + ks, the implicit equations are
+  //   E   = (E* + w alpha W (sqrt(g) eta + ks J + kT v^k S_k)) / D
+  //   S_i = (S*_i + w alpha W (kT P_ij v^j + v_i (sqrt(g) eta + ks J))) / D
+  // with D = 1 + w alpha W kT. Contracting the second equation with v^i
+  // gives v^k S_k = s0 + s1 J, the first equation then gives
+  // E = e0 + e1 J + e2 v^k S_k, and inserting both into
+  // J = W^2 (E - 2 v^k S_k + v_i v_j P^ij) leaves a linear equation for J.
+  for (size_t s = 0; s < get(lapse).size(); ++s) {
+    const double weighted_lorentz_factor =
+        implicit_weight * get(lapse)[s] * get(fluid_lorentz_factor)[s];
+    const double w_sqr = square(get(fluid_lorentz_factor)[s]);
+    const double kappa_s = get(scattering_opacity)[s];
+    const double kappa_t = get(absorption_opacity)[s] + kappa_s;
+    const double densitized_eta =
+        get(sqrt_det_spatial_metric)[s] * get(emissivity)[s];
+    const double one_over_denom =
+        1. / (1. + weighted_lorentz_factor * kappa_t);
+
+    const double s_0 =
+        (get(v_dot_s)[s] +
+         weighted_lorentz_factor * (get(v_sqr)[s] * densitized_eta +
+                                    kappa_t * get(v_dot_p_dot_v)[s])) *
+        one_over_denom;
+    const double s_1 =
+        weighted_lorentz_factor * get(v_sqr)[s] * kappa_s * one_over_denom;
+    const double e_0 =
+        (get(*tilde_e)[s] + weighted_lorentz_factor * densitized_eta) *
+        one_over_denom;
+    const double e_1 = weighted_lorentz_factor * kappa_s * one_over_denom;
+    const double e_2 = weighted_lorentz_factor * kappa_t * one_over_denom;
+
+    const double tilde_j =
+        w_sqr * (e_0 + (e_2 - 2.) * s_0 + get(v_dot_p_dot_v)[s]) /
+        (1. - w_sqr * (e_1 + (e_2 - 2.) * s_1));
+    get(*tilde_e)[s] = e_0 + e_1 * tilde_j + e_2 * (s_0 + s_1 * tilde_j);
+    for (size_t i = 0; i < spatial_dim; ++i) {
+      tilde_s->get(i)[s] =
+          (tilde_s->get(i)[s] +
+           weighted_lorentz_factor *
+               (kappa_t * p_dot_v_i.get(i)[s] +
+                fluid_velocity_i.get(i)[s] *
+                    (densitized_eta + kappa_s * tilde_j))) *
+          one_over_denom;
+    }
+  }
+}
+
 }  // namespace RadiationTransport::M1Grey::detail
@@ -10,7 +10,10 @@
 #include <tuple>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"  // IWYU pragma: keep
+#include "DataStructures/Variables.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Tags.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "PointwiseFunctions/Hydro/Tags.hpp"
@@ -49,6 +52,33 @@ void compute_m1_hydro_coupling_impl(
     const Scalar<DataVector>& lapse,
     const tnsr::ii<DataVector, 3>& spatial_metric,
     const Scalar<DataVector>& sqrt_det_spatial_metric) noexcept;
+
+void compute_implicit_m1_hydro_coupling_impl(
+    gsl::not_null<Scalar<DataVector>*> source_n,
+    gsl::not_null<tnsr::i<DataVector, 3>*> source_i,
+    const Scalar<DataVector>& tilde_e, const tnsr::i<DataVector, 3>& tilde_s,
+    const Scalar<DataVector>& emissivity,
+    const Scalar<DataVector>& absorption_opacity,
+    const Scalar<DataVector>& scattering_opacity,
+    const tnsr::II<DataVector, 3>& tilde_p,
+    const tnsr::I<DataVector, 3>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const Scalar<DataVector>& lapse,
+    const tnsr::ii<DataVector, 3>& spatial_metric,
+    const Scalar<DataVector>& sqrt_det_spatial_metric) noexcept;
+
+void solve_implicit_m1_hydro_coupling_impl(
+    gsl::not_null<Scalar<DataVector>*> tilde_e,
+    gsl::not_null<tnsr::i<DataVector, 3>*> tilde_s, double implicit_weight,
+    const Scalar<DataVector>& emissivity,
+    const Scalar<DataVector>& absorption_opacity,
+    const Scalar<DataVector>& scattering_opacity,
+    const tnsr::II<DataVector, 3>& tilde_p,
+    const tnsr::I<DataVector, 3>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const Scalar<DataVector>& lapse,
+    const tnsr::ii<DataVector, 3>& spatial_metric,
+    const Scalar<DataVector>& sqrt_det_spatial_metric) noexcept;
 }  // namespace detail
 
 template <typename NeutrinoSpeciesList>
@@ -73,9 +103,10 @@ struct ComputeM1HydroCoupling;
  *
  * The function returns in `source_n` the energy source and in
  * `source_i` the momentum source. We write a separate action for these
- * sources to make it easier to switch between implicit / explicit time
- * stepping, as well as to add the source terms to both the fluid and M1
- * evolutions.
+ * sources to make it easier to add the source terms to both the fluid and M1
+ * evolutions. The M1 evolution integrates them implicitly (see
+ * `RadiationTransport::M1Grey::ImplicitM1HydroCoupling`), so the values
+ * computed here are not used to evolve the M1 variables.
  */
 template <typename... NeutrinoSpecies>
 struct ComputeM1HydroCoupling<tmpl::list<NeutrinoSpecies...>> {
@@ -119,5 +150,106 @@ struct ComputeM1HydroCoupling<tmpl::list<NeutrinoSpecies...>> {
   }
 };
 
+template <typename NeutrinoSpeciesList>
+struct ImplicitM1HydroCoupling;
+/*!
+ * \brief The neutrino-matter coupling as the `implicit_sector` of the M1
+ * system
+ *
+ * The coupling terms listed in `ComputeM1HydroCoupling` become stiff where the
+ * opacities are large, so the M1 system integrates them implicitly with an
+ * `ImexTimeStepper` (see `imex::has_implicit_sector`). Here the comoving
+ * moments are computed from the evolved variables with the pressure tensor
+ * \f$\tilde P^{ij}\f$ held fixed:
+ *
+ * \f{align}{
+ * \tilde J &= W^2 \left(\tilde E - 2 v^i \tilde S_i
+ * + v_i v_j \tilde P^{ij}\right) \\
+ * \tilde H_n &= W \left(\tilde J - \tilde E + v^i \tilde S_i\right) \\
+ * \tilde H_i &= W \left(\tilde S_i - \gamma_{ij} \tilde P^{jk} v_k\right)
+ * - W \tilde J v_i
+ * \f}
+ *
+ * The coupling terms are then linear in \f$\tilde E\f$ and
+ * \f$\tilde S_i\f$. Therefore, the implicit equation
+ * \f$u - w S(u) = u^\ast\f$ at each grid point is a linear system, which
+ * `solve` eliminates in closed form: the equations for \f$\tilde S_i\f$ give
+ * \f$v^i \tilde S_i\f$ in terms of \f$\tilde J\f$, and inserting both
+ * into the definition of \f$\tilde J\f$ gives a scalar equation for
+ * \f$\tilde J\f$. Its coefficient is positive for any \f$w \geq 0\f$, so
+ * the solve never fails.
+ *
+ * The pressure tensor is the one computed by the M1 closure at the start of
+ * the substep, i.e. the closure lags behind the implicit update by one substep.
+ * This keeps the solve linear, at the cost of treating the closure explicitly.
+ */
+template <typename... NeutrinoSpecies>
+struct ImplicitM1HydroCoupling<tmpl::list<NeutrinoSpecies...>> {
+  using vars_tags =
+      tmpl::list<Tags::TildeE<Frame::Inertial, NeutrinoSpecies>...,
+                 Tags::TildeS<Frame::Inertial, NeutrinoSpecies>...>;
+
+  using argument_tags =
+      tmpl::list<Tags::GreyEmissivity<NeutrinoSpecies>...,
+                 Tags::GreyAbsorptionOpacity<NeutrinoSpecies>...,
+                 Tags::GreyScatteringOpacity<NeutrinoSpecies>...,
+                 Tags::TildeP<Frame::Inertial, NeutrinoSpecies>...,
+                 hydro::Tags::SpatialVelocity<DataVector, 3>,
+                 hydro::Tags::LorentzFactor<DataVector>, gr::Tags::Lapse<>,
+                 gr::Tags::SpatialMetric<3>, gr::Tags::SqrtDetSpatialMetric<>>;
+
+  static void source(
+      const gsl::not_null<Variables<db::wrap_tags_in<::Tags::dt, vars_tags>>*>
+          sources,
+      const Variables<vars_tags>& vars,
+      const typename Tags::GreyEmissivity<NeutrinoSpecies>::type&... emissivity,
+      const typename Tags::GreyAbsorptionOpacity<
+          NeutrinoSpecies>::type&... absorption_opacity,
+      const typename Tags::GreyScatteringOpacity<
+          NeutrinoSpecies>::type&... scattering_opacity,
+      const typename Tags::TildeP<Frame::Inertial,
+                                  NeutrinoSpecies>::type&... tilde_p,
+      const tnsr::I<DataVector, 3>& spatial_velocity,
+      const Scalar<DataVector>& lorentz_factor, const Scalar<DataVector>& lapse,
+      const tnsr::ii<DataVector, 3>& spatial_metric,
+      const Scalar<DataVector>& sqrt_det_spatial_metric) noexcept {
+    EXPAND_PACK_LEFT_TO_RIGHT(detail::compute_implicit_m1_hydro_coupling_impl(
+        make_not_null(&get<::Tags::dt<
+                          Tags::TildeE<Frame::Inertial, NeutrinoSpecies>>>(
+            *sources)),
+        make_not_null(&get<::Tags::dt<
+                          Tags::TildeS<Frame::Inertial, NeutrinoSpecies>>>(
+            *sources)),
+        get<Tags::TildeE<Frame::Inertial, NeutrinoSpecies>>(vars),
+        get<Tags::TildeS<Frame::Inertial, NeutrinoSpecies>>(vars), emissivity,
+        absorption_opacity, scattering_opacity, tilde_p, spatial_velocity,
+        lorentz_factor, lapse, spatial_metric, sqrt_det_spatial_metric));
+  }
+
+  static void solve(
+      const gsl::not_null<Variables<vars_tags>*> vars,
+      const double implicit_weight,
+      const typename Tags::GreyEmissivity<NeutrinoSpecies>::type&... emissivity,
+      const typename Tags::GreyAbsorptionOpacity<
+          NeutrinoSpecies>::type&... absorption_opacity,
+      const typename Tags::GreyScatteringOpacity<
+          NeutrinoSpecies>::type&... scattering_opacity,
+      const typename Tags::TildeP<Frame::Inertial,
+                                  NeutrinoSpecies>::type&... tilde_p,
+      const tnsr::I<DataVector, 3>& spatial_velocity,
+      const Scalar<DataVector>& lorentz_factor, const Scalar<DataVector>& lapse,
+      const tnsr::ii<DataVector, 3>& spatial_metric,
+      const Scalar<DataVector>& sqrt_det_spatial_metric) noexcept {
+    EXPAND_PACK_LEFT_TO_RIGHT(detail::solve_implicit_m1_hydro_coupling_impl(
+        make_not_null(
+            &get<Tags::TildeE<Frame::Inertial, NeutrinoSpecies>>(*vars)),
+        make_not_null(
+            &get<Tags::TildeS<Frame::Inertial, NeutrinoSpecies>>(*vars)),
+        implicit_weight, emissivity, absorption_opacity, scattering_opacity,
+        tilde_p, spatial_velocity, lorentz_factor, lapse, spatial_metric,
+        sqrt_det_spatial_metric));
+  }
+};
+
 }  // namespace M1Grey
 }  // namespace RadiationTransport
@@ -28,8 +28,7 @@ void compute_sources_impl(
     const gsl::not_null<Scalar<DataVector>*> source_tilde_e,
     const gsl::not_null<tnsr::i<DataVector, 3>*> source_tilde_s,
     const Scalar<DataVector>& tilde_e, const tnsr::i<DataVector, 3>& tilde_s,
-    const tnsr::II<DataVector, 3>& tilde_p, const Scalar<DataVector>& source_n,
-    const tnsr::i<DataVector, 3>& source_i, const Scalar<DataVector>& lapse,
+    const tnsr::II<DataVector, 3>& tilde_p, const Scalar<DataVector>& lapse,
     const tnsr::i<DataVector, 3>& d_lapse,
     const tnsr::iJ<DataVector, 3>& d_shift,
     const tnsr::ijj<DataVector, 3>& d_spatial_metric,
@@ -53,7 +52,7 @@ void compute_sources_impl(
   // source terms to zero
   get(*source_tilde_e) =
       get<0, 0>(extrinsic_curvature) * get<0, 0>(alpha_tilde_p) -
-      get<0>(tilde_s_M) * get<0>(d_lapse) + get(source_n);
+      get<0>(tilde_s_M) * get<0>(d_lapse);
   for (size_t m = 1; m < spatial_dim; ++m) {
     get(*source_tilde_e) +=
         extrinsic_curvature.get(0, m) * alpha_tilde_p.get(0, m) +
@@ -68,8 +67,7 @@ void compute_sources_impl(
   for (size_t i = 0; i < spatial_dim; ++i) {
     source_tilde_s->get(i) =
         -get(tilde_e) * d_lapse.get(i) + get<0>(tilde_s) * d_shift.get(i, 0) +
-        0.5 * get<0, 0>(alpha_tilde_p) * d_spatial_metric.get(i, 0, 0) +
-        source_i.get(i);
+        0.5 * get<0, 0>(alpha_tilde_p) * d_spatial_metric.get(i, 0, 0);
     for (size_t m = 1; m < spatial_dim; ++m) {
       source_tilde_s->get(i) +=
           tilde_s.get(m) * d_shift.get(i, m) +
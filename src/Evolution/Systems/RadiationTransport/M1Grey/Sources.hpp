@@ -30,8 +30,7 @@ void compute_sources_impl(
     gsl::not_null<Scalar<DataVector>*> source_tilde_e,
     gsl::not_null<tnsr::i<DataVector, 3>*> source_tilde_s,
     const Scalar<DataVector>& tilde_e, const tnsr::i<DataVector, 3>& tilde_s,
-    const tnsr::II<DataVector, 3>& tilde_p, const Scalar<DataVector>& source_n,
-    const tnsr::i<DataVector, 3>& source_i, const Scalar<DataVector>& lapse,
+    const tnsr::II<DataVector, 3>& tilde_p, const Scalar<DataVector>& lapse,
     const tnsr::i<DataVector, 3>& d_lapse,
     const tnsr::iJ<DataVector, 3>& d_shift,
     const tnsr::ijj<DataVector, 3>& d_spatial_metric,
@@ -52,7 +51,9 @@ void compute_sources_impl(
  * where \f$F^a()\f$ denotes the flux of a conserved variable \f$U_i\f$ and
  * \f$S()\f$ denotes the source term for the conserved variable.
  *
- * For the grey M1 formalism (neglecting coupling to the fluid):
+ * For the grey M1 formalism (without the coupling to the fluid, which is
+ * integrated implicitly, see
+ * `RadiationTransport::M1Grey::ImplicitM1HydroCoupling`):
  * \f{align*}
  * S({\tilde E}) &= \alpha \tilde P^{ij} K_{ij} - \tilde S^i \partial_i
  * \alpha,\\ S({\tilde S_i}) &= -\tilde E \partial_i \alpha + \tilde S_k
@@ -77,10 +78,7 @@ struct ComputeSources {
   using argument_tags = tmpl::list<
       Tags::TildeE<Frame::Inertial, NeutrinoSpecies>...,
       Tags::TildeS<Frame::Inertial, NeutrinoSpecies>...,
-      Tags::TildeP<Frame::Inertial, NeutrinoSpecies>...,
-      Tags::M1HydroCouplingNormal<NeutrinoSpecies>...,
-      Tags::M1HydroCouplingSpatial<Frame::Inertial, NeutrinoSpecies>...,
-      gr::Tags::Lapse<>,
+      Tags::TildeP<Frame::Inertial, NeutrinoSpecies>..., gr::Tags::Lapse<>,
       ::Tags::deriv<gr::Tags::Lapse<DataVector>, tmpl::size_t<3>,
                     Frame::Inertial>,
       ::Tags::deriv<gr::Tags::Shift<3, Frame::Inertial, DataVector>,
@@ -101,18 +99,14 @@ struct ComputeSources {
                                   NeutrinoSpecies>::type&... tilde_s,
       const typename Tags::TildeP<Frame::Inertial,
                                   NeutrinoSpecies>::type&... tilde_p,
-      const typename Tags::M1HydroCouplingNormal<
-          NeutrinoSpecies>::type&... source_n,
-      const typename Tags::M1HydroCouplingSpatial<
-          Frame::Inertial, NeutrinoSpecies>::type&... source_i,
       const Scalar<DataVector>& lapse, const tnsr::i<DataVector, 3>& d_lapse,
       const tnsr::iJ<DataVector, 3>& d_shift,
       const tnsr::ijj<DataVector, 3>& d_spatial_metric,
       const tnsr::II<DataVector, 3>& inv_spatial_metric,
       const tnsr::ii<DataVector, 3>& extrinsic_curvature) noexcept {
     EXPAND_PACK_LEFT_TO_RIGHT(detail::compute_sources_impl(
-        sources_tilde_e, sources_tilde_s, tilde_e, tilde_s, tilde_p, source_n,
-        source_i, lapse, d_lapse, d_shift, d_spatial_metric, inv_spatial_metric,
+        sources_tilde_e, sources_tilde_s, tilde_e, tilde_s, tilde_p, lapse,
+        d_lapse, d_shift, d_spatial_metric, inv_spatial_metric,
         extrinsic_curvature));
   }
 };
@@ -9,6 +9,7 @@
 #include "DataStructures/VariablesTag.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Characteristics.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Fluxes.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/M1HydroCoupling.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Sources.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Tags.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/TimeDerivativeTerms.hpp"
@@ -83,6 +84,10 @@ struct System<tmpl::list<NeutrinoSpecies...>> {
       TimeDerivativeTerms<NeutrinoSpecies...>;
   using volume_fluxes = ComputeFluxes<NeutrinoSpecies...>;
   using volume_sources = ComputeSources<NeutrinoSpecies...>;
+  // The neutrino-matter coupling is stiff, so it is not part of the sources
+  // above but integrated implicitly by an `ImexTimeStepper`
+  using implicit_sector =
+      ImplicitM1HydroCoupling<tmpl::list<NeutrinoSpecies...>>;
 
   using char_speeds_compute_tag = Tags::CharacteristicSpeedsCompute;
   using char_speeds_tag = Tags::CharacteristicSpeeds;
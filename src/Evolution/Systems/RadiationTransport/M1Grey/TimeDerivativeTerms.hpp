@@ -32,8 +32,6 @@ struct TimeDerivativeTerms {
       gr::Tags::Shift<3>, gr::Tags::SpatialMetric<3>,
       gr::Tags::InverseSpatialMetric<3>,
 
-      Tags::M1HydroCouplingNormal<NeutrinoSpecies>...,
-      Tags::M1HydroCouplingSpatial<Frame::Inertial, NeutrinoSpecies>...,
       ::Tags::deriv<gr::Tags::Lapse<DataVector>, tmpl::size_t<3>,
                     Frame::Inertial>,
       ::Tags::deriv<gr::Tags::Shift<3, Frame::Inertial, DataVector>,
@@ -70,10 +68,6 @@ struct TimeDerivativeTerms {
       const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
       const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
 
-      const typename Tags::M1HydroCouplingNormal<
-          NeutrinoSpecies>::type&... source_n,
-      const typename Tags::M1HydroCouplingSpatial<
-          Frame::Inertial, NeutrinoSpecies>::type&... source_i,
       const tnsr::i<DataVector, 3>& d_lapse,
       const tnsr::iJ<DataVector, 3>& d_shift,
       const tnsr::ijj<DataVector, 3>& d_spatial_metric,
@@ -83,8 +77,8 @@ struct TimeDerivativeTerms {
         shift, spatial_metric, inv_spatial_metric));
     EXPAND_PACK_LEFT_TO_RIGHT(detail::compute_sources_impl(
         non_flux_terms_dt_tilde_e, non_flux_terms_dt_tilde_s, tilde_e, tilde_s,
-        tilde_p, source_n, source_i, lapse, d_lapse, d_shift, d_spatial_metric,
-        inv_spatial_metric, extrinsic_curvature));
+        tilde_p, lapse, d_lapse, d_shift, d_spatial_metric, inv_spatial_metric,
+        extrinsic_curvature));
   }
 };
 }  // namespace RadiationTransport::M1Grey
@@ -17,6 +17,7 @@
 #include "Evolution/DiscontinuousGalerkin/DgElementArray.hpp"
 #include "Evolution/Initialization/DgDomain.hpp"
 #include "Evolution/Initialization/Evolution.hpp"
+#include "IO/H5/ComponentStorage.hpp"
 #include "IO/Observer/Actions/RegisterWithObservers.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/Helpers.hpp"
@@ -130,7 +131,8 @@ struct ExportCoordinates {
         observers::ArrayComponentId(
             std::add_pointer_t<ParallelComponent>{nullptr},
             Parallel::ArrayIndex<ElementId<Dim>>(array_index)),
-        std::move(components), mesh.extents(), mesh.basis(), mesh.quadrature());
+        std::move(components), mesh.extents(), mesh.basis(), mesh.quadrature(),
+        h5::ComponentStorage{});
     return std::forward_as_tuple(std::move(box));
   }
 };
@@ -0,0 +1,42 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/ComponentStorage.hpp"
+
+#include <optional>
+#include <pup.h>
+
+#include "Parallel/PupStlCpp17.hpp"
+
+namespace h5 {
+ComponentStorage::ComponentStorage(const bool single_precision_in,
+                                   const size_t deflate_level_in,
+                                   std::optional<double> absolute_error_in,
+                                   const Options::Context& context)
+    : single_precision(single_precision_in),
+      deflate_level(deflate_level_in),
+      absolute_error(absolute_error_in) {
+  if (absolute_error.has_value() and not(*absolute_error > 0.0)) {
+    PARSE_ERROR(context, "The AbsoluteError must be positive, not "
+                             << *absolute_error);
+  }
+}
+
+void ComponentStorage::pup(PUP::er& p) noexcept {
+  p | single_precision;
+  p | deflate_level;
+  p | absolute_error;
+}
+
+bool operator==(const ComponentStorage& lhs,
+                const ComponentStorage& rhs) noexcept {
+  return lhs.single_precision == rhs.single_precision and
+         lhs.deflate_level == rhs.deflate_level and
+         lhs.absolute_error == rhs.absolute_error;
+}
+
+bool operator!=(const ComponentStorage& lhs,
+                const ComponentStorage& rhs) noexcept {
+  return not(lhs == rhs);
+}
+}  // namespace h5
@@ -0,0 +1,86 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "Options/Auto.hpp"
+#include "Options/Options.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief How the tensor components written by
+ * `h5::VolumeData::write_volume_data` are stored in the file.
+ *
+ * \details The following options are available, and may be combined:
+ *
+ * - SinglePrecision: Store the components as 32-bit instead of 64-bit floats.
+ * - DeflateLevel: If nonzero, the components are compressed losslessly with
+ *   the HDF5 shuffle and deflate filters at this level (1 is fastest, 9
+ *   compresses most).
+ * - AbsoluteError: If given, the components are quantized to a uniform grid
+ *   of spacing twice this value, so each value is stored with at most this
+ *   absolute error, and the grid indices are stored as the smallest unsigned
+ *   integer type that holds them. A component that contains non-finite
+ *   values, or that spans too many grid points to be stored in 32 bits, is
+ *   stored unquantized instead.
+ *
+ * The default stores the components as uncompressed 64-bit floats.
+ * `h5::VolumeData::get_tensor_component` undoes all of these transformations
+ * (except for the loss of precision), so readers of the data need not know how
+ * it was stored.
+ */
+struct ComponentStorage {
+  static constexpr Options::String help =
+      "How tensor components are stored in the volume data file.";
+
+  struct SinglePrecision {
+    using type = bool;
+    static constexpr Options::String help = {
+        "Store the components as 32-bit floats."};
+  };
+
+  struct DeflateLevel {
+    using type = size_t;
+    static constexpr Options::String help = {
+        "Compress the components losslessly with shuffle and deflate at this "
+        "level. Zero disables the compression."};
+    static type upper_bound() noexcept { return 9; }
+  };
+
+  struct AbsoluteError {
+    using type = Options::Auto<double, Options::AutoLabel::None>;
+    static constexpr Options::String help = {
+        "Quantize the components so that each value is stored with at most "
+        "this absolute error, or 'None' to store the values exactly."};
+  };
+
+  using options = tmpl::list<SinglePrecision, DeflateLevel, AbsoluteError>;
+
+  ComponentStorage() = default;
+  ComponentStorage(bool single_precision_in, size_t deflate_level_in,
+                   std::optional<double> absolute_error_in,
+                   const Options::Context& context = {});
+
+  void pup(PUP::er& p) noexcept;  // NOLINT
+
+  bool single_precision = false;
+  size_t deflate_level = 0;
+  std::optional<double> absolute_error{};
+};
+
+bool operator==(const ComponentStorage& lhs,
+                const ComponentStorage& rhs) noexcept;
+bool operator!=(const ComponentStorage& lhs,
+                const ComponentStorage& rhs) noexcept;
+}  // namespace h5
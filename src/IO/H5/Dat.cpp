@@ -4,6 +4,7 @@
 #include "IO/H5/Dat.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <hdf5.h>
 #include <iosfwd>
 #include <memory>
@@ -83,8 +84,15 @@ Dat::Dat(const bool exists, detail::OpenGroup&& group, const hid_t location,
     legend_ = read_rank1_attribute<std::string>(dataset_id_, "Legend"s);
     size_[1] = legend_.size();
   } else {  // file does not exist
+    // Rows are appended to the dataset over the whole run, so chunks of
+    // about 64 KiB keep the number of chunks (and so the size of the chunk
+    // index and the number of writes) small.
+    const auto rows_per_chunk = std::max(
+        static_cast<hsize_t>(4),
+        static_cast<hsize_t>(8192 / std::max(legend_.size(), size_t{1})));
     dataset_id_ = h5::detail::create_extensible_dataset(
-        location, name_, size_, std::array<hsize_t, 2>{{4, legend_.size()}},
+        location, name_, size_,
+        std::array<hsize_t, 2>{{rows_per_chunk, legend_.size()}},
         {{h5s_unlimited(), legend_.size()}});
     CHECK_H5(dataset_id_, "Failed to create dataset");
 
@@ -166,16 +174,15 @@ void Dat::append(const std::vector<std::vector<double>>& data) {
   }
   const std::vector<double> contiguous_data =
       [](const std::vector<std::vector<double>>& ldata) {
-        std::vector<double> result(ldata.size() * ldata[0].size());
-        for (size_t i = 0; i < ldata.size(); ++i) {
-          if (ldata[i].size() != ldata[0].size()) {
+        std::vector<double> result{};
+        result.reserve(ldata.size() * ldata[0].size());
+        for (const auto& row : ldata) {
+          if (row.size() != ldata[0].size()) {
             ERROR(
                 "Each member of the vector<vector<double>> must be of the same "
                 "size, ie the number of columns must be the same.");
           }
-          result.insert(
-              result.begin() + static_cast<std::ptrdiff_t>(i * ldata[i].size()),
-              ldata[i].begin(), ldata[i].end());
+          result.insert(result.end(), row.begin(), row.end());
         }
         return result;
       }(data);
@@ -37,7 +37,9 @@ namespace h5 {
  * different dat files being stored as individual files is solved.
  *
  * \note This class does not do any caching of data so all data is written as
- * soon as append() is called.
+ * soon as append() is called. Appending many rows at once is much cheaper than
+ * appending them one at a time, so writers of frequent small rows should
+ * buffer them (see `observers::ReductionDataBuffer`).
  */
 class Dat : public h5::Object {
  public:
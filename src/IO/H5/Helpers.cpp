@@ -130,6 +130,50 @@ void write_data(const hid_t group_id, const std::vector<T>& data,
   CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
 }
 
+template <typename T>
+void write_data(const hid_t group_id, const std::vector<T>& data,
+                const std::vector<size_t>& extents, const std::string& name,
+                const hid_t file_type, const size_t deflate_level) noexcept {
+  const std::vector<hsize_t> dims(extents.begin(), extents.end());
+  const hid_t space_id = H5Screate_simple(dims.size(), dims.data(), nullptr);
+  CHECK_H5(space_id, "Failed to create dataspace");
+  const hid_t property_list = H5Pcreate(H5P_DATASET_CREATE);
+  CHECK_H5(property_list, "Failed to create property list");
+  // Filters require a chunked dataset, and chunks may not be empty
+  if (deflate_level > 0 and not data.empty()) {
+    if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0) {
+      ERROR("The deflate filter is not available in this HDF5 installation");
+    }
+    // Chunks of about 64k points keep the (de)compression buffers small while
+    // amortizing the per-chunk overhead. Only the slowest-varying dimension
+    // is split.
+    std::vector<hsize_t> chunk_dims = dims;
+    const hsize_t points_per_slice = std::accumulate(
+        dims.begin() + 1, dims.end(), static_cast<hsize_t>(1),
+        std::multiplies<>());
+    chunk_dims[0] = std::clamp(static_cast<hsize_t>(65536) / points_per_slice,
+                               static_cast<hsize_t>(1), dims[0]);
+    CHECK_H5(H5Pset_chunk(property_list, static_cast<int>(chunk_dims.size()),
+                          chunk_dims.data()),
+             "Failed to set chunk size");
+    CHECK_H5(H5Pset_shuffle(property_list), "Failed to set shuffle filter");
+    CHECK_H5(H5Pset_deflate(property_list,
+                            static_cast<unsigned int>(deflate_level)),
+             "Failed to set deflate filter");
+  }
+  const hid_t contained_type = h5::h5_type<tt::get_fundamental_type_t<T>>();
+  const hid_t dataset_id =
+      H5Dcreate2(group_id, name.c_str(), file_type, space_id, h5::h5p_default(),
+                 property_list, h5::h5p_default());
+  CHECK_H5(dataset_id, "Failed to create dataset");
+  CHECK_H5(H5Dwrite(dataset_id, contained_type, h5::h5s_all(), h5::h5s_all(),
+                    h5::h5p_default(), static_cast<const void*>(data.data())),
+           "Failed to write data to dataset");
+  CHECK_H5(H5Pclose(property_list), "Failed to close property list");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+}
+
 void write_data(const hid_t group_id, const DataVector& data,
                 const std::string& name) noexcept {
   const auto number_of_points = static_cast<hsize_t>(data.size());
@@ -531,6 +575,14 @@ GENERATE_INSTANTIATIONS(INSTANTIATE_WRITE_DATA,
                         (double, int, unsigned int, long, unsigned long,
                          long long, unsigned long long, char))
 
+#define INSTANTIATE_WRITE_STORED_DATA(_, DATA)                     \
+  template void write_data<TYPE(DATA)>(                            \
+      const hid_t group_id, const std::vector<TYPE(DATA)>& data,   \
+      const std::vector<size_t>& extents, const std::string& name, \
+      const hid_t file_type, const size_t deflate_level) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE_WRITE_STORED_DATA, (double, unsigned int))
+
 #define INSTANTIATE_ATTRIBUTE(_, DATA)                                 \
   template void write_to_attribute<TYPE(DATA)>(                        \
       const hid_t group_id, const std::string& name,                   \
@@ -583,6 +635,7 @@ GENERATE_INSTANTIATIONS(INSTANTIATE_READ_DATAVECTOR, (DataVector), (1, 2, 3))
 
 #undef INSTANTIATE_ATTRIBUTE
 #undef INSTANTIATE_WRITE_DATA
+#undef INSTANTIATE_WRITE_STORED_DATA
 #undef INSTANTIATE_READ_SCALAR
 #undef INSTANTIATE_READ_VECTOR
 #undef INSTANTIATE_READ_MULTIARRAY
@@ -28,6 +28,21 @@ void write_data(hid_t group_id, const std::vector<T>& data,
                 const std::vector<size_t>& extents,
                 const std::string& name = "scalar") noexcept;
 
+/*!
+ * \ingroup HDF5Group
+ * \brief Write a std::vector named `name` to the group `group_id`, storing it
+ * in the file as the HDF5 type `file_type`
+ *
+ * \details HDF5 converts the data to `file_type` when writing it, and to the
+ * type requested by the reader when reading it. If `deflate_level` is nonzero
+ * the dataset is chunked and compressed with the shuffle and deflate filters
+ * at that level, which is also transparent to the reader.
+ */
+template <typename T>
+void write_data(hid_t group_id, const std::vector<T>& data,
+                const std::vector<size_t>& extents, const std::string& name,
+                hid_t file_type, size_t deflate_level) noexcept;
+
 /*!
  * \ingroup HDF5Group
  * \brief Write a DataVector named `name` to the group `group_id`
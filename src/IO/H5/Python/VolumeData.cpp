@@ -4,6 +4,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <string>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
@@ -19,7 +20,13 @@ void bind_h5vol(py::module& m) {  // NOLINT
       .def("get_header", &h5::VolumeData::get_header)
       .def("get_version", &h5::VolumeData::get_version)
       .def("get_dimension", &h5::VolumeData::get_dimension)
-      .def("write_volume_data", &h5::VolumeData::write_volume_data)
+      .def("write_volume_data",
+           [](h5::VolumeData& volume_file, const size_t observation_id,
+              const double observation_value,
+              const std::vector<ElementVolumeData>& elements) {
+             volume_file.write_volume_data(observation_id, observation_value,
+                                           elements);
+           })
       .def("list_observation_ids", &h5::VolumeData::list_observation_ids)
       .def("get_observation_value", &h5::VolumeData::get_observation_value,
            py::arg("observation_id"))
@@ -6,7 +6,11 @@
 #include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/iterator/transform_iterator.hpp>
+#include <cmath>
+#include <cstdint>
+#include <functional>
 #include <hdf5.h>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -16,9 +20,11 @@
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/ComponentStorage.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
 #include "IO/H5/SpectralIo.hpp"
+#include "IO/H5/Type.hpp"
 #include "IO/H5/Version.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -29,6 +35,7 @@
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/Numeric.hpp"
+#include "Utilities/StdHelpers.hpp"
 
 namespace h5 {
 namespace {
@@ -38,9 +45,8 @@ void append_element_extents_and_connectivity(
     const gsl::not_null<std::vector<size_t>*> total_extents,
     const gsl::not_null<std::vector<int>*> total_connectivity,
     const gsl::not_null<int*> total_points_so_far, const size_t dim,
-    const ExtentsAndTensorVolumeData& element) noexcept {
+    const std::vector<size_t>& extents) noexcept {
   // Process the element extents
-  const auto& extents = element.extents;
   if (extents.size() != dim) {
     ERROR("Trying to write data of dimensionality"
           << extents.size() << "but the VolumeData file has dimensionality"
@@ -69,65 +75,77 @@ void append_element_extents_and_connectivity(
                              connectivity.end());
 }
 
-// Append the name of an element to the string of grid names
-void append_element_name(const gsl::not_null<std::string*> grid_names,
-                         const ExtentsAndTensorVolumeData& element) noexcept {
-  // Get the name of the element
+// Get the name of the element from the name of its first tensor component
+std::string element_name(const ExtentsAndTensorVolumeData& element) noexcept {
   const auto& first_tensor_name = element.tensor_components.front().name;
   ASSERT(first_tensor_name.find_last_of('/') != std::string::npos,
          "The expected format of the tensor component names is "
          "'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in '"
              << first_tensor_name << "'.");
-
-  const auto spatial_name =
-      first_tensor_name.substr(0, first_tensor_name.find_last_of('/'));
-  *grid_names += spatial_name + VolumeData::separator();
+  return first_tensor_name.substr(0, first_tensor_name.find_last_of('/'));
 }
 
-}  // namespace
-
-VolumeData::VolumeData(const bool subfile_exists, detail::OpenGroup&& group,
-                       const hid_t /*location*/, const std::string& name,
-                       const uint32_t version) noexcept
-    : group_(std::move(group)),
-      name_(name.size() > extension().size()
-                ? (extension() == name.substr(name.size() - extension().size())
-                       ? name
-                       : name + extension())
-                : name + extension()),
-      version_(version),
-      volume_data_group_(group_.id(), name_, h5::AccessType::ReadWrite) {
-  if (subfile_exists) {
-    // We treat this as an internal version for now. We'll need to deal with
-    // proper versioning later.
-    const Version open_version(true, detail::OpenGroup{},
-                               volume_data_group_.id(), "version");
-    version_ = open_version.get_version();
-    const Header header(true, detail::OpenGroup{}, volume_data_group_.id(),
-                        "header");
-    header_ = header.get_header();
-  } else {  // file does not exist
-    // Subfiles are closed as they go out of scope, so we have the extra
-    // braces here to add the necessary scope
-    {
-      Version open_version(false, detail::OpenGroup{}, volume_data_group_.id(),
-                           "version", version_);
-    }
-    {
-      Header header(false, detail::OpenGroup{}, volume_data_group_.id(),
-                    "header");
-      header_ = header.get_header();
+// Write the data of a tensor component to the dataset `name` in the way
+// specified by `storage`. The quantized values are stored as offsets from the
+// smallest value in units of the quantization step, so that they fit into
+// fewer bits (and compress better) than the values themselves.
+void write_tensor_component(
+    const hid_t group_id, const std::vector<double>& data,
+    const std::string& name, const ComponentStorage& storage,
+    const gsl::not_null<std::vector<unsigned int>*> quantized_data) noexcept {
+  if (storage.absolute_error.has_value() and not data.empty() and
+      alg::all_of(data, [](const double value) noexcept {
+        return std::isfinite(value);
+      })) {
+    const auto [min_value, max_value] =
+        std::minmax_element(data.begin(), data.end());
+    const double offset = *min_value;
+    const double step = 2.0 * *storage.absolute_error;
+    const double max_index = std::round((*max_value - offset) / step);
+    if (max_index <= std::numeric_limits<unsigned int>::max()) {
+      quantized_data->resize(data.size());
+      std::transform(data.begin(), data.end(), quantized_data->begin(),
+                     [offset, step](const double value) noexcept {
+                       return static_cast<unsigned int>(
+                           std::round((value - offset) / step));
+                     });
+      const hid_t file_type =
+          max_index <= std::numeric_limits<uint8_t>::max()
+              ? H5T_STD_U8LE
+              : (max_index <= std::numeric_limits<uint16_t>::max()
+                     ? H5T_STD_U16LE
+                     : H5T_STD_U32LE);
+      h5::write_data(group_id, *quantized_data, {quantized_data->size()}, name,
+                     file_type, storage.deflate_level);
+      const hid_t dataset_id = h5::open_dataset(group_id, name);
+      h5::write_to_attribute(dataset_id, "quantization_offset", offset);
+      h5::write_to_attribute(dataset_id, "quantization_step", step);
+      h5::close_dataset(dataset_id);
+      return;
     }
   }
+  h5::write_data(group_id, data, {data.size()}, name,
+                 storage.single_precision ? H5T_NATIVE_FLOAT
+                                          : h5::h5_type<double>(),
+                 storage.deflate_level);
 }
 
-// Write Volume Data stored in a vector of `ExtentsAndTensorVolumeData` to
-// an `observation_group` in a `VolumeData` file.
-void VolumeData::write_volume_data(
-    const size_t observation_id, const double observation_value,
-    const std::vector<ElementVolumeData>& elements) noexcept {
+// Write the `elements` to the group of the observation `observation_id`.
+// `get_grid_name(element)` returns the name of the grid of an element, and
+// `get_component(element, i)` returns the data of its tensor component `i`,
+// which is named `component_names[i]`.
+template <typename Element, typename GetGridName, typename GetComponent>
+void write_elements(const hid_t volume_data_group_id,
+                    const std::string& subfile_name,
+                    const size_t observation_id,
+                    const double observation_value,
+                    const std::vector<std::string>& component_names,
+                    const std::vector<Element>& elements,
+                    const ComponentStorage& storage,
+                    const GetGridName& get_grid_name,
+                    const GetComponent& get_component) noexcept {
   const std::string path = "ObservationId" + std::to_string(observation_id);
-  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+  detail::OpenGroup observation_group(volume_data_group_id, path,
                                       AccessType::ReadWrite);
   if (contains_attribute(observation_group.id(), "", "observation_value")) {
     ERROR("Trying to write ObservationId "
@@ -137,30 +155,19 @@ void VolumeData::write_volume_data(
   }
   h5::write_to_attribute(observation_group.id(), "observation_value",
                          observation_value);
-  // Get first element to extract the component names and dimension
-  const auto get_component_name = [](const auto& component) noexcept {
-    ASSERT(component.name.find_last_of('/') != std::string::npos,
-           "The expected format of the tensor component names is "
-           "'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in '"
-               << component.name << "'.");
-    return component.name.substr(component.name.find_last_of('/') + 1);
-  };
-  const std::vector<std::string> component_names(
-      boost::make_transform_iterator(elements.front().tensor_components.begin(),
-                                     get_component_name),
-      boost::make_transform_iterator(elements.front().tensor_components.end(),
-                                     get_component_name));
   // The dimension of the grid is the number of extents per element. I.e., if
   // the extents are [8,5,7] for any element, the dimension of the grid is 3.
   // Only written once per VolumeData file (All volume data in a single file
   // should have the same dimensionality)
-  if (not contains_attribute(volume_data_group_.id(), "", "dimension")) {
-    h5::write_to_attribute(volume_data_group_.id(), "dimension",
+  if (not contains_attribute(volume_data_group_id, "", "dimension")) {
+    h5::write_to_attribute(volume_data_group_id, "dimension",
                            elements.front().extents.size());
   }
   const auto dim =
-      h5::read_value_attribute<size_t>(volume_data_group_.id(), "dimension");
-  // Extract Tensor Data one component at a time
+      h5::read_value_attribute<size_t>(volume_data_group_id, "dimension");
+  // Collect the grid information of all elements, and count the total number
+  // of grid points so the data of each tensor component can be gathered into
+  // a single buffer that is reused for all components
   std::vector<size_t> total_extents;
   std::string grid_names;
   std::vector<int> total_connectivity;
@@ -169,44 +176,56 @@ void VolumeData::write_volume_data(
   // Keep a running count of the number of points so far to use as a global
   // index for the connectivity
   int total_points_so_far = 0;
-  // Loop over tensor componenents
+  for (const auto& element : elements) {
+    grid_names += get_grid_name(element);
+    grid_names += VolumeData::separator();
+    // append element basis
+    alg::transform(element.basis, std::back_inserter(bases),
+                   [](const Spectral::Basis t) noexcept {
+                     return static_cast<int>(t);
+                   });
+    // append element quadraature
+    alg::transform(element.quadrature, std::back_inserter(quadratures),
+                   [](const Spectral::Quadrature t) noexcept {
+                     return static_cast<int>(t);
+                   });
+    append_element_extents_and_connectivity(&total_extents,
+                                            &total_connectivity,
+                                            &total_points_so_far, dim,
+                                            element.extents);
+  }
+  std::vector<double> contiguous_tensor_data(
+      static_cast<size_t>(total_points_so_far));
+  std::vector<unsigned int> quantized_tensor_data{};
+  // Extract Tensor Data one component at a time
   for (size_t i = 0; i < component_names.size(); i++) {
-    std::string component_name = component_names[i];
+    const std::string& component_name = component_names[i];
     // Write the data for the tensor component
     if (h5::contains_dataset_or_group(observation_group.id(), "",
                                       component_name)) {
       ERROR("Trying to write tensor component '"
             << component_name
-            << "' which already exists in HDF5 file in group '" << name_ << '/'
-            << "ObservationId" << std::to_string(observation_id) << "'");
+            << "' which already exists in HDF5 file in group '"
+            << subfile_name << '/' << "ObservationId"
+            << std::to_string(observation_id) << "'");
     }
-    std::vector<double> contiguous_tensor_data{};
+    auto next_point = contiguous_tensor_data.begin();
     for (const auto& element : elements) {
-      if (UNLIKELY(i == 0)) {  // True if first tensor component being accessed
-        append_element_name(&grid_names, element);
-        // append element basis
-        alg::transform(element.basis, std::back_inserter(bases),
-                       [](const Spectral::Basis t) noexcept {
-                         return static_cast<int>(t);
-                       });
-        // append element quadraature
-        alg::transform(element.quadrature, std::back_inserter(quadratures),
-                       [](const Spectral::Quadrature t) noexcept {
-                         return static_cast<int>(t);
-                       });
-
-        append_element_extents_and_connectivity(
-            &total_extents, &total_connectivity, &total_points_so_far, dim,
-            element);
-      }
-      const DataVector& tensor_data_on_grid = element.tensor_components[i].data;
-      contiguous_tensor_data.insert(contiguous_tensor_data.end(),
-                                    tensor_data_on_grid.begin(),
-                                    tensor_data_on_grid.end());
-
+      const gsl::span<const double> tensor_data_on_grid =
+          get_component(element, i);
+      ASSERT(tensor_data_on_grid.size() ==
+                 alg::accumulate(element.extents, 1_st, std::multiplies<>{}),
+             "The tensor component '"
+                 << component_name << "' of the grid '"
+                 << get_grid_name(element) << "' has "
+                 << tensor_data_on_grid.size()
+                 << " points, which does not match the extents "
+                 << element.extents << " of its element");
+      next_point = std::copy(tensor_data_on_grid.begin(),
+                             tensor_data_on_grid.end(), next_point);
     }  // for each element
-    h5::write_data(observation_group.id(), contiguous_tensor_data,
-                   {contiguous_tensor_data.size()}, component_name);
+    write_tensor_component(observation_group.id(), contiguous_tensor_data,
+                           component_name, storage, &quantized_tensor_data);
   }  // for each component
 
   // Write the grid extents contiguously, the first `dim` belong to the
@@ -239,6 +258,100 @@ void VolumeData::write_volume_data(
   h5::write_data(observation_group.id(), total_connectivity,
                  {total_connectivity.size()}, "connectivity");
 }
+}  // namespace
+
+VolumeData::VolumeData(const bool subfile_exists, detail::OpenGroup&& group,
+                       const hid_t /*location*/, const std::string& name,
+                       const uint32_t version) noexcept
+    : group_(std::move(group)),
+      name_(name.size() > extension().size()
+                ? (extension() == name.substr(name.size() - extension().size())
+                       ? name
+                       : name + extension())
+                : name + extension()),
+      version_(version),
+      volume_data_group_(group_.id(), name_, h5::AccessType::ReadWrite) {
+  if (subfile_exists) {
+    // We treat this as an internal version for now. We'll need to deal with
+    // proper versioning later.
+    const Version open_version(true, detail::OpenGroup{},
+                               volume_data_group_.id(), "version");
+    version_ = open_version.get_version();
+    const Header header(true, detail::OpenGroup{}, volume_data_group_.id(),
+                        "header");
+    header_ = header.get_header();
+  } else {  // file does not exist
+    // Subfiles are closed as they go out of scope, so we have the extra
+    // braces here to add the necessary scope
+    {
+      Version open_version(false, detail::OpenGroup{}, volume_data_group_.id(),
+                           "version", version_);
+    }
+    {
+      Header header(false, detail::OpenGroup{}, volume_data_group_.id(),
+                    "header");
+      header_ = header.get_header();
+    }
+  }
+}
+
+// Write Volume Data stored in a vector of `ElementVolumeData` to an
+// `observation_group` in a `VolumeData` file.
+void VolumeData::write_volume_data(
+    const size_t observation_id, const double observation_value,
+    const std::vector<ElementVolumeData>& elements,
+    const ComponentStorage& storage) noexcept {
+  // Get first element to extract the component names
+  const auto get_component_name = [](const auto& component) noexcept {
+    ASSERT(component.name.find_last_of('/') != std::string::npos,
+           "The expected format of the tensor component names is "
+           "'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in '"
+               << component.name << "'.");
+    return component.name.substr(component.name.find_last_of('/') + 1);
+  };
+  const std::vector<std::string> component_names(
+      boost::make_transform_iterator(elements.front().tensor_components.begin(),
+                                     get_component_name),
+      boost::make_transform_iterator(elements.front().tensor_components.end(),
+                                     get_component_name));
+  write_elements(
+      volume_data_group_.id(), name_, observation_id, observation_value,
+      component_names, elements, storage,
+      [](const ElementVolumeData& element) noexcept {
+        return element_name(element);
+      },
+      [](const ElementVolumeData& element, const size_t i) noexcept {
+        const DataVector& data = element.tensor_components[i].data;
+        return gsl::span<const double>(data.data(), data.size());
+      });
+}
+
+void VolumeData::write_volume_data(
+    const size_t observation_id, const double observation_value,
+    const std::vector<std::string>& component_names,
+    const std::vector<ContiguousElementVolumeData>& elements,
+    const ComponentStorage& storage) noexcept {
+  write_elements(
+      volume_data_group_.id(), name_, observation_id, observation_value,
+      component_names, elements, storage,
+      [](const ContiguousElementVolumeData& element) noexcept
+      -> const std::string& { return element.grid_name; },
+      [&component_names](const ContiguousElementVolumeData& element,
+                         const size_t i) noexcept {
+        const size_t number_of_grid_points = element.number_of_grid_points();
+        ASSERT(element.components.size() ==
+                   component_names.size() * number_of_grid_points,
+               "The grid '" << element.grid_name << "' has "
+                            << element.components.size()
+                            << " values, but expected "
+                            << component_names.size()
+                            << " tensor components with "
+                            << number_of_grid_points << " points each.");
+        return gsl::span<const double>(
+            element.components.data() + i * number_of_grid_points,
+            number_of_grid_points);
+      });
+}
 
 std::vector<size_t> VolumeData::list_observation_ids() const noexcept {
   const auto names = get_group_names(volume_data_group_.id(), "");
@@ -310,20 +423,40 @@ DataVector VolumeData::get_tensor_component(
   const auto rank =
       static_cast<size_t>(H5Sget_simple_extent_ndims(dataspace_id));
   h5::close_dataspace(dataspace_id);
+  // See `write_tensor_component` for the encoding of quantized data
+  const bool is_quantized = H5Aexists(dataset_id, "quantization_step") > 0;
+  const double quantization_offset =
+      is_quantized ? h5::read_value_attribute<double>(dataset_id,
+                                                      "quantization_offset")
+                   : 0.0;
+  const double quantization_step =
+      is_quantized
+          ? h5::read_value_attribute<double>(dataset_id, "quantization_step")
+          : 1.0;
   h5::close_dataset(dataset_id);
+  // HDF5 converts single precision and integer data to double when reading,
+  // and decompresses the data, so only the quantization needs to be undone
+  DataVector tensor_data{};
   switch (rank) {
     case 1:
-      return h5::read_data<1, DataVector>(observation_group.id(),
-                                          tensor_component);
+      tensor_data = h5::read_data<1, DataVector>(observation_group.id(),
+                                                 tensor_component);
+      break;
     case 2:
-      return h5::read_data<2, DataVector>(observation_group.id(),
-                                          tensor_component);
+      tensor_data = h5::read_data<2, DataVector>(observation_group.id(),
+                                                 tensor_component);
+      break;
     case 3:
-      return h5::read_data<3, DataVector>(observation_group.id(),
-                                          tensor_component);
+      tensor_data = h5::read_data<3, DataVector>(observation_group.id(),
+                                                 tensor_component);
+      break;
     default:
       ERROR("Rank must be 1, 2, or 3. Received data with Rank = " << rank);
   }
+  if (is_quantized) {
+    tensor_data = quantization_offset + quantization_step * tensor_data;
+  }
+  return tensor_data;
 }
 
 std::vector<std::vector<size_t>> VolumeData::get_extents(
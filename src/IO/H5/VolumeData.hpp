@@ -12,12 +12,14 @@
 #include <unordered_map>
 #include <vector>
 
+#include "IO/H5/ComponentStorage.hpp"
 #include "IO/H5/Object.hpp"
 #include "IO/H5/OpenGroup.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 
 /// \cond
 class DataVector;
+struct ContiguousElementVolumeData;
 class ElementVolumeData;
 class ExtentsAndTensorVolumeData;
 /// \endcond
@@ -95,11 +97,27 @@ class VolumeData : public h5::Object {
   /// Insert tensor components at `observation_id` with floating point value
   /// `observation_value`
   ///
+  /// The tensor components are stored as specified by `storage`, see
+  /// `h5::ComponentStorage`.
+  ///
   /// \requires The names of the tensor components is of the form
   /// `GRID_NAME/TENSOR_NAME_COMPONENT`, e.g. `Element0/T_xx`
+  void write_volume_data(size_t observation_id, double observation_value,
+                         const std::vector<ElementVolumeData>& elements,
+                         const ComponentStorage& storage = {}) noexcept;
+
+  /// Insert tensor components at `observation_id` with floating point value
+  /// `observation_value`, where all `elements` hold the tensor components
+  /// named `component_names` in the same order
+  ///
+  /// This avoids storing the names of the tensor components with the data of
+  /// every element. The tensor components are stored as specified by
+  /// `storage`, see `h5::ComponentStorage`.
   void write_volume_data(
       size_t observation_id, double observation_value,
-      const std::vector<ElementVolumeData>& elements) noexcept;
+      const std::vector<std::string>& component_names,
+      const std::vector<ContiguousElementVolumeData>& elements,
+      const ComponentStorage& storage = {}) noexcept;
 
   /// List all the integral observation ids in the subfile
   std::vector<size_t> list_observation_ids() const noexcept;
@@ -127,7 +145,9 @@ class VolumeData : public h5::Object {
   std::vector<std::string> get_grid_names(size_t observation_id) const noexcept;
 
   /// Read a tensor component with name `tensor_component` at observation id
-  /// `observation_id` from all grids in the file
+  /// `observation_id` from all grids in the file. Components that were
+  /// stored in reduced precision, compressed, or quantized are converted back
+  /// to double precision.
   DataVector get_tensor_component(
       size_t observation_id,
       const std::string& tensor_component) const noexcept;
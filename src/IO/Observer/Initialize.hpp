@@ -73,8 +73,10 @@ struct InitializeWriter {
       tmpl::list<Tags::ExpectedContributorsForObservations,
                  Tags::ContributorsOfReductionData, Tags::ReductionDataLock,
                  Tags::ContributorsOfTensorData, Tags::VolumeDataLock,
-                 Tags::TensorData, Tags::NodesExpectedToContributeReductions,
-                 Tags::NodesThatContributedReductions, Tags::H5FileLock>,
+                 Tags::TensorData, Tags::VolumeDataSchemas,
+                 Tags::NodesExpectedToContributeReductions,
+                 Tags::NodesThatContributedReductions, Tags::H5FileLock,
+                 Tags::ReductionDataBuffer>,
       typename Metavariables::observed_reduction_data_tags,
       tmpl::transform<
           typename Metavariables::observed_reduction_data_tags,
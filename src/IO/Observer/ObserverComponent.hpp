@@ -5,11 +5,13 @@
 
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/Initialize.hpp"
+#include "IO/Observer/ReductionActions.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/Actions/SetupDataBox.hpp"
 #include "Parallel/Algorithms/AlgorithmGroup.hpp"
 #include "Parallel/Algorithms/AlgorithmNodegroup.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "ParallelAlgorithms/Initialization/Actions/RemoveOptionsAndTerminatePhase.hpp"
@@ -46,6 +48,10 @@ struct Observer {
  * \ingroup ObserversGroup
  * \brief The nodegroup parallel component that is responsible for writing data
  * to disk.
+ *
+ * Reduction data is buffered in memory and written in large chunks (see
+ * `observers::ReductionDataBuffer`). The buffer is flushed at every phase
+ * change and before the executable exits.
  */
 template <class Metavariables>
 struct ObserverWriter {
@@ -63,7 +69,24 @@ struct ObserverWriter {
 
   static void execute_next_phase(
       const typename Metavariables::Phase /*next_phase*/,
-      Parallel::CProxy_GlobalCache<
-          Metavariables>& /*global_cache*/) noexcept {}
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) noexcept {
+    flush_reduction_data(global_cache);
+  }
+
+  static void execute_before_exit(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) noexcept {
+    flush_reduction_data(global_cache);
+  }
+
+ private:
+  // Reduction data is only written on node 0, which is also the node the
+  // phases are changed on
+  static void flush_reduction_data(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) noexcept {
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    Parallel::local_synchronous_action<Actions::FlushReductionData>(
+        Parallel::get_parallel_component<ObserverWriter>(local_cache),
+        Parallel::get<Tags::ReductionFileName>(local_cache));
+  }
 };
 }  // namespace observers
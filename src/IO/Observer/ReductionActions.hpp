@@ -12,12 +12,10 @@
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
-#include "IO/H5/AccessType.hpp"
-#include "IO/H5/Dat.hpp"
-#include "IO/H5/File.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/Protocols/ReductionDataFormatter.hpp"
+#include "IO/Observer/ReductionDataBuffer.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/ArrayIndex.hpp"
 #include "Parallel/GlobalCache.hpp"
@@ -35,6 +33,7 @@
 #include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/StdHelpers.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -387,6 +386,9 @@ struct CollectReductionDataOnNode {
 /*!
  * \ingroup ObserversGroup
  * \brief Write reduction data to disk from node 0.
+ *
+ * The rows are buffered in the `Tags::ReductionDataBuffer` and written in
+ * large chunks (see `observers::ReductionDataBuffer`).
  */
 struct WriteReductionData {
  private:
@@ -403,22 +405,23 @@ struct WriteReductionData {
   }
 
   template <typename... Ts, size_t... Is>
-  static void write_data(const std::string& subfile_name,
-                         std::vector<std::string>&& legend,
-                         std::tuple<Ts...>&& data,
-                         const std::string& file_prefix,
-                         std::index_sequence<Is...> /*meta*/) noexcept {
+  static void write_data(
+      const gsl::not_null<ReductionDataBuffer*> reduction_data_buffer,
+      const std::string& subfile_name, const std::vector<std::string>& legend,
+      std::tuple<Ts...>&& data, const std::string& file_prefix,
+      std::index_sequence<Is...> /*meta*/) noexcept {
     static_assert(sizeof...(Ts) > 0,
                   "Must be reducing at least one piece of data");
     std::vector<double> data_to_append{};
     EXPAND_PACK_LEFT_TO_RIGHT(
         append_to_reduction_data(&data_to_append, std::get<Is>(data)));
 
-    h5::H5File<h5::AccessType::ReadWrite> h5file(file_prefix + ".h5", true);
-    constexpr size_t version_number = 0;
-    auto& time_series_file = h5file.try_insert<h5::Dat>(
-        subfile_name, std::move(legend), version_number);
-    time_series_file.append(data_to_append);
+    reduction_data_buffer->append(subfile_name, legend,
+                                  std::move(data_to_append));
+    if (const double wall_time = sys::wall_time();
+        reduction_data_buffer->needs_flush(wall_time)) {
+      reduction_data_buffer->flush(file_prefix, wall_time);
+    }
   }
 
  public:
@@ -451,7 +454,9 @@ struct WriteReductionData {
                   tmpl::list_contains_v<
                       DbTagsList, Tags::NodesThatContributedReductions> and
                   tmpl::list_contains_v<DbTagsList, Tags::ReductionDataLock> and
-                  tmpl::list_contains_v<DbTagsList, Tags::H5FileLock>) {
+                  tmpl::list_contains_v<DbTagsList, Tags::H5FileLock> and
+                  tmpl::list_contains_v<DbTagsList,
+                                        Tags::ReductionDataBuffer>) {
       // The below gymnastics with pointers is done in order to minimize the
       // time spent locking the entire node, which is necessary because the
       // DataBox does not allow any functions calls, both get and mutate, during
@@ -470,6 +475,7 @@ struct WriteReductionData {
           nodes_contributed = nullptr;
       Parallel::NodeLock* reduction_data_lock = nullptr;
       Parallel::NodeLock* reduction_file_lock = nullptr;
+      ReductionDataBuffer* reduction_data_buffer = nullptr;
       size_t observations_registered_with_id =
           std::numeric_limits<size_t>::max();
 
@@ -477,12 +483,13 @@ struct WriteReductionData {
       db::mutate<Tags::ReductionData<ReductionDatums...>,
                  Tags::ReductionDataNames<ReductionDatums...>,
                  Tags::NodesThatContributedReductions, Tags::ReductionDataLock,
-                 Tags::H5FileLock>(
+                 Tags::H5FileLock, Tags::ReductionDataBuffer>(
           make_not_null(&box),
           [
             &nodes_contributed, &reduction_data, &reduction_names_map,
-            &reduction_data_lock, &reduction_file_lock, &observation_id,
-            &observations_registered_with_id, &sender_node_number
+            &reduction_data_lock, &reduction_file_lock, &reduction_data_buffer,
+            &observation_id, &observations_registered_with_id,
+            &sender_node_number
           ](const gsl::not_null<
                 typename Tags::ReductionData<ReductionDatums...>::type*>
                 reduction_data_ptr,
@@ -494,6 +501,8 @@ struct WriteReductionData {
                 nodes_contributed_ptr,
             const gsl::not_null<Parallel::NodeLock*> reduction_data_lock_ptr,
             const gsl::not_null<Parallel::NodeLock*> reduction_file_lock_ptr,
+            const gsl::not_null<ReductionDataBuffer*>
+                reduction_data_buffer_ptr,
             const std::unordered_map<ObservationKey, std::set<size_t>>&
                 nodes_registered_for_reductions) noexcept {
             const ObservationKey& key{observation_id.observation_key()};
@@ -516,6 +525,7 @@ struct WriteReductionData {
             nodes_contributed = &*nodes_contributed_ptr;
             reduction_data_lock = &*reduction_data_lock_ptr;
             reduction_file_lock = &*reduction_file_lock_ptr;
+            reduction_data_buffer = &*reduction_data_buffer_ptr;
             observations_registered_with_id =
                 nodes_registered_for_reductions.at(key).size();
           },
@@ -599,9 +609,9 @@ struct WriteReductionData {
           }
         }
         WriteReductionData::write_data(
-            subfile_name,
+            make_not_null(reduction_data_buffer), subfile_name,
             // NOLINTNEXTLINE(bugprone-use-after-move)
-            std::move(reduction_names),
+            reduction_names,
             std::move(received_reduction_data.data()),
             Parallel::get<Tags::ReductionFileName>(cache),
             std::make_index_sequence<sizeof...(ReductionDatums)>{});
@@ -620,9 +630,59 @@ struct WriteReductionData {
             << pretty_type::get_name<
                    Tags::ReductionDataNames<ReductionDatums...>>()
             << ", Tags::NodesThatContributedReductions, "
-               "Tags::ReductionDataLock, or Tags::H5FileLock.");
+               "Tags::ReductionDataLock, Tags::H5FileLock, or "
+               "Tags::ReductionDataBuffer.");
     }
   }
 };
 }  // namespace ThreadedActions
+
+namespace Actions {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Write the buffered reduction data of the
+ * `observers::ObserverWriter` to the file `reduction_file_name` (see
+ * `observers::ReductionDataBuffer`).
+ *
+ * This is a local synchronous action, so it is done when the call returns. It
+ * is invoked at every phase change and before the executable exits, so no
+ * buffered rows are lost.
+ */
+struct FlushReductionData {
+  using return_type = void;
+
+  template <typename ParallelComponent, typename DbTagList>
+  static void apply(db::DataBox<DbTagList>& box,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const std::string& reduction_file_name) noexcept {
+    if constexpr (tmpl::list_contains_v<DbTagList, Tags::H5FileLock> and
+                  tmpl::list_contains_v<DbTagList,
+                                        Tags::ReductionDataBuffer>) {
+      Parallel::NodeLock* reduction_file_lock = nullptr;
+      ReductionDataBuffer* reduction_data_buffer = nullptr;
+      node_lock->lock();
+      db::mutate<Tags::H5FileLock, Tags::ReductionDataBuffer>(
+          make_not_null(&box),
+          [&reduction_file_lock, &reduction_data_buffer](
+              const gsl::not_null<Parallel::NodeLock*> reduction_file_lock_ptr,
+              const gsl::not_null<ReductionDataBuffer*>
+                  reduction_data_buffer_ptr) noexcept {
+            reduction_file_lock = &*reduction_file_lock_ptr;
+            reduction_data_buffer = &*reduction_data_buffer_ptr;
+          });
+      node_lock->unlock();
+
+      reduction_file_lock->lock();
+      reduction_data_buffer->flush(reduction_file_name, sys::wall_time());
+      reduction_file_lock->unlock();
+    } else {
+      (void)node_lock;
+      (void)reduction_file_name;
+      ERROR(
+          "Could not find one of the tags Tags::H5FileLock or "
+          "Tags::ReductionDataBuffer in the DataBox.");
+    }
+  }
+};
+}  // namespace Actions
 }  // namespace observers
@@ -0,0 +1,95 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/ReductionDataBuffer.hpp"
+
+#include <cstddef>
+#include <map>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/StdHelpers.hpp"
+
+namespace observers {
+ReductionDataBuffer::ReductionDataBuffer(
+    const size_t max_buffered_rows,
+    const double max_seconds_between_flushes) noexcept
+    : max_buffered_rows_(max_buffered_rows),
+      max_seconds_between_flushes_(max_seconds_between_flushes) {
+  ASSERT(max_buffered_rows_ > 0,
+         "The maximum number of buffered rows must be positive.");
+}
+
+void ReductionDataBuffer::append(const std::string& subfile_name,
+                                 const std::vector<std::string>& legend,
+                                 std::vector<double> row) noexcept {
+  ASSERT(row.size() == legend.size(),
+         "The row of subfile " << subfile_name << " has " << row.size()
+                               << " columns, but the legend has "
+                               << legend.size() << " columns.");
+  auto [subfile, inserted] = subfiles_.try_emplace(subfile_name);
+  if (inserted) {
+    subfile->second.legend = legend;
+  } else if (UNLIKELY(subfile->second.legend != legend)) {
+    using ::operator<<;
+    ERROR("The legend " << legend << " of the subfile " << subfile_name
+                        << " differs from the legend "
+                        << subfile->second.legend
+                        << " of the rows that were written before.");
+  }
+  subfile->second.rows.push_back(std::move(row));
+  ++number_of_buffered_rows_;
+}
+
+bool ReductionDataBuffer::needs_flush(const double wall_time) const noexcept {
+  return number_of_buffered_rows_ > 0 and
+         (number_of_buffered_rows_ >= max_buffered_rows_ or
+          wall_time - time_of_last_flush_ >= max_seconds_between_flushes_);
+}
+
+void ReductionDataBuffer::flush(const std::string& file_name,
+                                const double wall_time) noexcept {
+  time_of_last_flush_ = wall_time;
+  if (number_of_buffered_rows_ == 0) {
+    return;
+  }
+  h5::H5File<h5::AccessType::ReadWrite> h5file(file_name + ".h5", true);
+  constexpr size_t version_number = 0;
+  for (auto& [subfile_name, subfile] : subfiles_) {
+    if (subfile.rows.empty()) {
+      continue;
+    }
+    auto& time_series_file =
+        h5file.try_insert<h5::Dat>(subfile_name, subfile.legend,
+                                   version_number);
+    time_series_file.append(subfile.rows);
+    h5file.close_current_object();
+    subfile.rows.clear();
+  }
+  number_of_buffered_rows_ = 0;
+}
+
+void ReductionDataBuffer::pup(PUP::er& p) noexcept {
+  p | max_buffered_rows_;
+  p | max_seconds_between_flushes_;
+  p | subfiles_;
+  p | number_of_buffered_rows_;
+  if (p.isUnpacking()) {
+    time_of_last_flush_ = 0.0;
+  }
+}
+
+void ReductionDataBuffer::Subfile::pup(PUP::er& p) noexcept {
+  p | legend;
+  p | rows;
+}
+}  // namespace observers
@@ -0,0 +1,80 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Rows of reduction data that are held in memory until they are
+ * written to the `h5::Dat` subfiles of the reduction file.
+ *
+ * Writing a single row to an `h5::Dat` opens the file, resizes the dataset and
+ * closes the file again, which is expensive compared to the small amount of
+ * data written by each reduction observation. Instead, the
+ * `observers::ObserverWriter` appends the rows to this buffer and writes all
+ * buffered rows of all subfiles with a single opening of the file once
+ * `needs_flush()` is true, i.e. once `max_buffered_rows` rows are buffered or
+ * `max_seconds_between_flushes` seconds of wall time have passed since the
+ * last flush. The buffer is also flushed at every phase change and before the
+ * executable exits (see `observers::Actions::FlushReductionData`). Buffered
+ * rows are serialized, so they survive a checkpoint.
+ */
+class ReductionDataBuffer {
+ public:
+  ReductionDataBuffer() = default;
+
+  ReductionDataBuffer(size_t max_buffered_rows,
+                      double max_seconds_between_flushes) noexcept;
+
+  /// Buffer a `row` of the subfile `subfile_name` with the column names
+  /// `legend`. The legend must be the same for all rows of a subfile.
+  void append(const std::string& subfile_name,
+              const std::vector<std::string>& legend,
+              std::vector<double> row) noexcept;
+
+  /// Whether the buffered rows should be written at the wall time
+  /// `wall_time`.
+  bool needs_flush(double wall_time) const noexcept;
+
+  /// Write all buffered rows to the file `file_name` and clear the buffer.
+  ///
+  /// The file is only opened if there are rows to write.
+  void flush(const std::string& file_name, double wall_time) noexcept;
+
+  size_t number_of_buffered_rows() const noexcept {
+    return number_of_buffered_rows_;
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+
+ private:
+  struct Subfile {
+    std::vector<std::string> legend{};
+    std::vector<std::vector<double>> rows{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p) noexcept;
+  };
+
+  size_t max_buffered_rows_{1000};
+  double max_seconds_between_flushes_{60.0};
+  // Ordered so the subfiles are written in the same order on every flush
+  std::map<std::string, Subfile> subfiles_{};
+  size_t number_of_buffered_rows_{0};
+  // The wall time restarts with the executable, so this is not serialized
+  double time_of_last_flush_{0.0};
+};
+}  // namespace observers
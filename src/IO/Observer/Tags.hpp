@@ -18,6 +18,8 @@
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ReductionDataBuffer.hpp"
+#include "IO/Observer/VolumeDataSchema.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/Reduction.hpp"
@@ -98,11 +100,23 @@ struct VolumeDataLock : db::SimpleTag {
 };
 
 /// Volume tensor data to be written to disk.
+///
+/// The names of the tensor components are not stored with the data of each
+/// element, but once per subfile in `observers::Tags::VolumeDataSchemas`.
 struct TensorData : db::SimpleTag {
   using type =
       std::unordered_map<observers::ObservationId,
                          std::unordered_map<observers::ArrayComponentId,
-                                            ElementVolumeData>>;
+                                            ContiguousElementVolumeData>>;
+};
+
+/// \brief The names and the order of the tensor components of the volume data
+/// written to each subfile.
+///
+/// Used on the `ObserverWriter` component, see
+/// `observers::Actions::RegisterVolumeDataSchema`.
+struct VolumeDataSchemas : db::SimpleTag {
+  using type = std::unordered_map<ObservationKey, VolumeDataSchema>;
 };
 
 /// \cond
@@ -139,6 +153,13 @@ struct ReductionDataNames : db::SimpleTag {
 struct H5FileLock : db::SimpleTag {
   using type = Parallel::NodeLock;
 };
+
+/// \brief Rows of reduction data that have not been written to disk yet.
+///
+/// Only accessed while holding the `Tags::H5FileLock`.
+struct ReductionDataBuffer : db::SimpleTag {
+  using type = observers::ReductionDataBuffer;
+};
 }  // namespace Tags
 
 /// \ingroup ObserversGroup
@@ -3,14 +3,21 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <iterator>
+#include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/ComponentStorage.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/VolumeData.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
@@ -18,10 +25,12 @@
 #include "IO/Observer/ObserverComponent.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "IO/Observer/TypeOfObservation.hpp"
+#include "IO/Observer/VolumeDataSchema.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
@@ -35,6 +44,63 @@ struct ContributeVolumeDataToWriter;
 }  // namespace ThreadedActions
 /// \endcond
 namespace Actions {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Register the names and the order of the tensor components written to
+ * a subfile with the `observers::ObserverWriter`.
+ *
+ * This local synchronous action is invoked on the local branch of the
+ * `ObserverWriter` nodegroup by the components contributing volume data with
+ * `observers::Actions::ContributeVolumeData`, before they send their data. The
+ * `observation_key` identifies the subfile. Registering a schema that is
+ * already registered only compares the `observers::VolumeDataSchema::id()`,
+ * so the contributors can invoke this action before each of their
+ * contributions without sending the names of the tensor components. It is an
+ * error to register a schema with different tensor components for the same
+ * subfile.
+ *
+ * DataBox changes:
+ * - Adds: nothing
+ * - Removes: nothing
+ * - Modifies:
+ *   - `Tags::VolumeDataSchemas`
+ */
+struct RegisterVolumeDataSchema {
+  using return_type = void;
+
+  template <typename ParallelComponent, typename DbTagList>
+  static void apply(db::DataBox<DbTagList>& box,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const ObservationKey& observation_key,
+                    const VolumeDataSchema& schema) noexcept {
+    if constexpr (tmpl::list_contains_v<DbTagList, Tags::VolumeDataSchemas>) {
+      node_lock->lock();
+      db::mutate<Tags::VolumeDataSchemas>(
+          make_not_null(&box),
+          [&observation_key, &schema](
+              const gsl::not_null<
+                  std::unordered_map<ObservationKey, VolumeDataSchema>*>
+                  schemas) noexcept {
+            const auto [registered_schema, inserted] =
+                schemas->try_emplace(observation_key, schema);
+            if (UNLIKELY(not inserted and
+                         registered_schema->second.id() != schema.id())) {
+              ERROR("The tensor components "
+                    << schema << " of the volume observation "
+                    << observation_key
+                    << " differ from the registered tensor components "
+                    << registered_schema->second);
+            }
+          });
+      node_lock->unlock();
+    } else {
+      (void)node_lock;
+      (void)observation_key;
+      (void)schema;
+      ERROR("Could not find the tag VolumeDataSchemas in the DataBox.");
+    }
+  }
+};
 
 /*!
  * \ingroup ObserversGroup
@@ -44,10 +110,51 @@ namespace Actions {
  * component) must pass in an `observation_id` used to uniquely identify the
  * observation in time, the name of the `h5::VolumeData` subfile in the HDF5
  * file (e.g. `/element_data`, where the slash is important), the contributing
- * parallel component element's component id, a vector of the `TensorComponent`s
- * to be written to disk, and an `Index<Dim>` of the extents of the volume.
+ * parallel component element's component id, the tensor data, an `Index<Dim>`
+ * of the extents of the volume, the basis and quadrature of each dimension,
+ * and the `h5::ComponentStorage` with which the tensor components are written.
+ *
+ * The tensor data is passed in one of two ways:
+ * - The name of the grid, e.g. the output of the stream operator of the
+ *   `ElementId`, and a `DataVector` holding all tensor components one after
+ *   the other, in the order of the `observers::VolumeDataSchema` that the
+ *   caller registered for the subfile with
+ *   `observers::Actions::RegisterVolumeDataSchema`. This avoids constructing
+ *   and sending the names of the tensor components for every element.
+ * - A vector of `TensorComponent`s named `GRID_NAME/COMPONENT_NAME`. This
+ *   action splits the names into the name of the grid and the schema, which it
+ *   registers with the `observers::ObserverWriter`, and copies the data into
+ *   a single `DataVector`.
  */
 struct ContributeVolumeData {
+  template <
+      typename ParallelComponent, typename DbTagsList, typename Metavariables,
+      typename ArrayIndex, size_t Dim,
+      Requires<tmpl::list_contains_v<DbTagsList, Tags::TensorData>> = nullptr>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index,
+                    const observers::ObservationId& observation_id,
+                    const std::string& subfile_name,
+                    const observers::ArrayComponentId& sender_array_id,
+                    std::string&& grid_name, DataVector&& received_components,
+                    const Index<Dim>& received_extents,
+                    const std::array<Spectral::Basis, Dim>& received_basis,
+                    const std::array<Spectral::Quadrature, Dim>&
+                        received_quadrature,
+                    const h5::ComponentStorage& storage) noexcept {
+    contribute<ParallelComponent>(
+        make_not_null(&box), cache, array_index, observation_id, subfile_name,
+        sender_array_id,
+        ContiguousElementVolumeData(
+            std::move(grid_name),
+            {received_extents.begin(), received_extents.end()},
+            std::move(received_components),
+            {received_basis.begin(), received_basis.end()},
+            {received_quadrature.begin(), received_quadrature.end()}),
+        storage);
+  }
+
   template <
       typename ParallelComponent, typename DbTagsList, typename Metavariables,
       typename ArrayIndex, size_t Dim,
@@ -62,16 +169,68 @@ struct ContributeVolumeData {
                     const Index<Dim>& received_extents,
                     const std::array<Spectral::Basis, Dim>& received_basis,
                     const std::array<Spectral::Quadrature, Dim>&
-                        received_quadrature) noexcept {
+                        received_quadrature,
+                    const h5::ComponentStorage& storage) noexcept {
+    ASSERT(not received_tensor_data.empty(),
+           "Received no tensor components for the volume observation "
+               << observation_id << " from array component id "
+               << sender_array_id);
+    const std::string& first_name = received_tensor_data.front().name;
+    if (UNLIKELY(first_name.find_last_of('/') == std::string::npos)) {
+      ERROR(
+          "The expected format of the tensor component names is "
+          "'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in '"
+          << first_name << "'.");
+    }
+    std::string grid_name = first_name.substr(0, first_name.find_last_of('/'));
+    const size_t number_of_grid_points = received_extents.product();
+    std::vector<std::string> component_names(received_tensor_data.size());
+    DataVector components(received_tensor_data.size() *
+                          number_of_grid_points);
+    for (size_t i = 0; i < received_tensor_data.size(); ++i) {
+      const auto& [name, data] = received_tensor_data[i];
+      if (UNLIKELY(data.size() != number_of_grid_points)) {
+        ERROR("The tensor component '"
+              << name << "' has " << data.size()
+              << " points, which does not match the extents "
+              << received_extents << " of its element");
+      }
+      component_names[i] = name.substr(name.find_last_of('/') + 1);
+      std::copy(data.begin(), data.end(),
+                components.begin() +
+                    static_cast<std::ptrdiff_t>(i * number_of_grid_points));
+    }
+    Parallel::local_synchronous_action<RegisterVolumeDataSchema>(
+        Parallel::get_parallel_component<ObserverWriter<Metavariables>>(cache),
+        observation_id.observation_key(),
+        VolumeDataSchema{std::move(component_names)});
+    apply<ParallelComponent>(box, cache, array_index, observation_id,
+                             subfile_name, sender_array_id,
+                             std::move(grid_name), std::move(components),
+                             received_extents, received_basis,
+                             received_quadrature, storage);
+  }
+
+ private:
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void contribute(
+      const gsl::not_null<db::DataBox<DbTagsList>*> box,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index,
+      const observers::ObservationId& observation_id,
+      const std::string& subfile_name,
+      const observers::ArrayComponentId& sender_array_id,
+      ContiguousElementVolumeData&& received_volume_data,
+      const h5::ComponentStorage& storage) noexcept {
     db::mutate<Tags::TensorData, Tags::ContributorsOfTensorData>(
-        make_not_null(&box),
-        [&array_index, &cache, &observation_id, &sender_array_id,
-         &received_basis, &received_extents, &received_quadrature,
-         &received_tensor_data, &subfile_name](
+        box,
+        [&array_index, &cache, &observation_id, &received_volume_data,
+         &sender_array_id, &storage, &subfile_name](
             const gsl::not_null<std::unordered_map<
                 observers::ObservationId,
                 std::unordered_map<observers::ArrayComponentId,
-                                   ElementVolumeData>>*>
+                                   ContiguousElementVolumeData>>*>
                 volume_data,
             const gsl::not_null<std::unordered_map<
                 ObservationId, std::unordered_set<ArrayComponentId>>*>
@@ -101,40 +260,8 @@ struct ContributeVolumeData {
                   << sender_array_id);
           }
           contributed_array_ids.insert(sender_array_id);
-
-          if (volume_data->count(observation_id) == 0 or
-              volume_data->at(observation_id).count(sender_array_id) == 0) {
-            std::vector<size_t> extents(received_extents.begin(),
-                                        received_extents.end());
-            std::vector<Spectral::Basis> bases(received_basis.begin(),
-                                               received_basis.end());
-            std::vector<Spectral::Quadrature> quadratures(
-                received_quadrature.begin(), received_quadrature.end());
-
-            volume_data->operator[](observation_id)
-                .emplace(sender_array_id,
-                         ElementVolumeData(
-                             {received_extents.begin(), received_extents.end()},
-                             std::move(received_tensor_data),
-                             {received_basis.begin(), received_basis.end()},
-                             {received_quadrature.begin(),
-                              received_quadrature.end()}));
-          } else {
-            auto& current_data =
-                volume_data->at(observation_id).at(sender_array_id);
-            if (UNLIKELY(
-                    not alg::equal(current_data.extents, received_extents))) {
-              ERROR(
-                  "The extents from the same volume component at a specific "
-                  "observation should always be the same. For example, the "
-                  "extents of a dG element should be the same for all calls to "
-                  "ContributeVolumeData that occur at the same time.");
-            }
-            current_data.tensor_components.insert(
-                current_data.tensor_components.end(),
-                std::make_move_iterator(received_tensor_data.begin()),
-                std::make_move_iterator(received_tensor_data.end()));
-          }
+          (*volume_data)[observation_id].emplace(
+              sender_array_id, std::move(received_volume_data));
 
           // Check if we have received all "volume" data from the registered
           // elements. If so we copy it to the nodegroup volume writer.
@@ -147,11 +274,12 @@ struct ContributeVolumeData {
                 local_writer, observation_id,
                 ArrayComponentId{std::add_pointer_t<ParallelComponent>{nullptr},
                                  Parallel::ArrayIndex<ArrayIndex>(array_index)},
-                subfile_name, std::move((*volume_data)[observation_id]));
+                subfile_name, std::move((*volume_data)[observation_id]),
+                storage);
             volume_data->erase(observation_id);
           }
         },
-        db::get<Tags::ExpectedContributorsForObservations>(box));
+        db::get<Tags::ExpectedContributorsForObservations>(*box));
   }
 };
 }  // namespace Actions
@@ -172,11 +300,14 @@ struct ContributeVolumeDataToWriter {
       const gsl::not_null<Parallel::NodeLock*> node_lock,
       const observers::ObservationId& observation_id,
       ArrayComponentId observer_group_id, const std::string& subfile_name,
-      std::unordered_map<observers::ArrayComponentId, ElementVolumeData>&&
-          received_volume_data) noexcept {
+      std::unordered_map<observers::ArrayComponentId,
+                         ContiguousElementVolumeData>&& received_volume_data,
+      const h5::ComponentStorage& storage) noexcept {
     if constexpr (tmpl::list_contains_v<DbTagsList, Tags::TensorData> and
                   tmpl::list_contains_v<DbTagsList,
                                         Tags::ContributorsOfTensorData> and
+                  tmpl::list_contains_v<DbTagsList,
+                                        Tags::VolumeDataSchemas> and
                   tmpl::list_contains_v<DbTagsList, Tags::VolumeDataLock> and
                   tmpl::list_contains_v<DbTagsList, Tags::H5FileLock>) {
       // The below gymnastics with pointers is done in order to minimize the
@@ -190,10 +321,13 @@ struct ContributeVolumeDataToWriter {
       // data itself is guaranteed to be stable inside the VolumeDataLock.
       std::unordered_map<
           observers::ObservationId,
-          std::unordered_map<observers::ArrayComponentId, ElementVolumeData>>*
-          all_volume_data = nullptr;
-      std::unordered_map<observers::ArrayComponentId, ElementVolumeData>
+          std::unordered_map<observers::ArrayComponentId,
+                             ContiguousElementVolumeData>>* all_volume_data =
+          nullptr;
+      std::unordered_map<observers::ArrayComponentId,
+                         ContiguousElementVolumeData>
           volume_data;
+      const VolumeDataSchema* schema = nullptr;
       Parallel::NodeLock* volume_file_lock = nullptr;
       std::unordered_map<ObservationId, std::unordered_set<ArrayComponentId>>*
           volume_observers_contributed = nullptr;
@@ -207,11 +341,11 @@ struct ContributeVolumeDataToWriter {
           make_not_null(&box),
           [&observation_id, &observations_registered_with_id,
            &observer_group_id, &all_volume_data, &volume_observers_contributed,
-           &volume_data_lock, &volume_file_lock](
+           &volume_data_lock, &volume_file_lock, &schema](
               const gsl::not_null<std::unordered_map<
                   observers::ObservationId,
                   std::unordered_map<observers::ArrayComponentId,
-                                     ElementVolumeData>>*>
+                                     ContiguousElementVolumeData>>*>
                   volume_data_ptr,
               const gsl::not_null<std::unordered_map<
                   ObservationId, std::unordered_set<ArrayComponentId>>*>
@@ -220,7 +354,9 @@ struct ContributeVolumeDataToWriter {
               const gsl::not_null<Parallel::NodeLock*> volume_file_lock_ptr,
               const std::unordered_map<ObservationKey,
                                        std::unordered_set<ArrayComponentId>>&
-                  observations_registered) noexcept {
+                  observations_registered,
+              const std::unordered_map<ObservationKey, VolumeDataSchema>&
+                  schemas) noexcept {
             const ObservationKey& key{observation_id.observation_key()};
             const auto& registered_group_ids = observations_registered.at(key);
             if (UNLIKELY(registered_group_ids.find(observer_group_id) ==
@@ -231,6 +367,15 @@ struct ContributeVolumeDataToWriter {
                     << observation_id);
             }
 
+            // The schemas are stored in a node-based map, so the pointer
+            // remains valid when the schemas of other subfiles are registered
+            const auto schema_it = schemas.find(key);
+            if (UNLIKELY(schema_it == schemas.end())) {
+              ERROR("No tensor components were registered for the volume "
+                    "observation id "
+                    << observation_id);
+            }
+            schema = &schema_it->second;
             all_volume_data = &*volume_data_ptr;
             volume_observers_contributed = &*volume_observers_contributed_ptr;
             volume_data_lock = &*volume_data_lock_ptr;
@@ -238,9 +383,11 @@ struct ContributeVolumeDataToWriter {
                 observations_registered.at(key).size();
             volume_file_lock = &*volume_file_lock_ptr;
           },
-          db::get<Tags::ExpectedContributorsForObservations>(box));
+          db::get<Tags::ExpectedContributorsForObservations>(box),
+          db::get<Tags::VolumeDataSchemas>(box));
       node_lock->unlock();
 
+      ASSERT(schema != nullptr, "Failed to set schema in the mutate");
       ASSERT(all_volume_data != nullptr,
              "Failed to set all_volume_data in the mutate");
       ASSERT(volume_file_lock != nullptr,
@@ -291,6 +438,15 @@ struct ContributeVolumeDataToWriter {
       if (perform_write) {
         ASSERT(not volume_data.empty(),
                "Failed to populate volume_data before trying to write it.");
+        // The tensor data is moved rather than copied since `volume_data` is
+        // not used after the write, and this is done before taking the file
+        // lock so that the lock is only held while accessing the file.
+        std::vector<ContiguousElementVolumeData> dg_elements;
+        dg_elements.reserve(volume_data.size());
+        for (auto& id_and_element : volume_data) {
+          dg_elements.push_back(std::move(id_and_element.second));
+        }
+        volume_data.clear();
         // Write to file. We use a separate node lock because writing can be
         // very time consuming (it's network dependent, depends on how full the
         // disks are, what other users are doing, etc.) and we want to be able
@@ -310,14 +466,10 @@ struct ContributeVolumeDataToWriter {
           constexpr size_t version_number = 0;
           auto& volume_file =
               h5file.try_insert<h5::VolumeData>(subfile_name, version_number);
-          std::vector<ElementVolumeData> dg_elements;
-          dg_elements.reserve(volume_data.size());
-          for (const auto& id_and_element : volume_data) {
-            dg_elements.push_back(id_and_element.second);
-          }
           // Write the data to the file
-          volume_file.write_volume_data(observation_id.hash(),
-                                        observation_id.value(), dg_elements);
+          volume_file.write_volume_data(
+              observation_id.hash(), observation_id.value(),
+              schema->component_names(), dg_elements, storage);
         }
         volume_file_lock->unlock();
       }
@@ -327,9 +479,10 @@ struct ContributeVolumeDataToWriter {
       (void)observer_group_id;
       (void)subfile_name;
       (void)received_volume_data;
+      (void)storage;
       ERROR(
           "Could not find one of the tags TensorData, "
-          "ContributorsOfTensorData, "
+          "ContributorsOfTensorData, VolumeDataSchemas, "
           "VolumeDataLock, or H5FileLock in the DataBox.");
     }
   }
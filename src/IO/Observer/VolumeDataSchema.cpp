@@ -0,0 +1,44 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/VolumeDataSchema.hpp"
+
+#include <boost/functional/hash.hpp>
+#include <cstddef>
+#include <ostream>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Utilities/StdHelpers.hpp"
+
+namespace observers {
+VolumeDataSchema::VolumeDataSchema(
+    std::vector<std::string> component_names) noexcept
+    : id_(boost::hash_range(component_names.begin(), component_names.end())),
+      component_names_(std::move(component_names)) {}
+
+void VolumeDataSchema::pup(PUP::er& p) noexcept {
+  p | id_;
+  p | component_names_;
+}
+
+bool operator==(const VolumeDataSchema& lhs,
+                const VolumeDataSchema& rhs) noexcept {
+  return lhs.id() == rhs.id() and
+         lhs.component_names() == rhs.component_names();
+}
+
+bool operator!=(const VolumeDataSchema& lhs,
+                const VolumeDataSchema& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os,
+                         const VolumeDataSchema& schema) noexcept {
+  using ::operator<<;
+  return os << schema.component_names();
+}
+}  // namespace observers
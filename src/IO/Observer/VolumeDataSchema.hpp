@@ -0,0 +1,61 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief The names and the order of the tensor components of a volume
+ * observation.
+ *
+ * All elements contributing to a volume observation send their tensor
+ * components in the same order, so the names of the components are registered
+ * once per subfile with the `observers::ObserverWriter` (see
+ * `observers::Actions::RegisterVolumeDataSchema`) instead of being sent with
+ * the data of every element. The `id()` is a hash of the component names that
+ * is used to check cheaply that a schema was already registered.
+ */
+class VolumeDataSchema {
+ public:
+  VolumeDataSchema() = default;
+
+  explicit VolumeDataSchema(std::vector<std::string> component_names) noexcept;
+
+  size_t id() const noexcept { return id_; }
+
+  const std::vector<std::string>& component_names() const noexcept {
+    return component_names_;
+  }
+
+  size_t number_of_components() const noexcept {
+    return component_names_.size();
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+
+ private:
+  size_t id_{0};
+  std::vector<std::string> component_names_{};
+};
+
+bool operator==(const VolumeDataSchema& lhs,
+                const VolumeDataSchema& rhs) noexcept;
+bool operator!=(const VolumeDataSchema& lhs,
+                const VolumeDataSchema& rhs) noexcept;
+
+std::ostream& operator<<(std::ostream& os,
+                         const VolumeDataSchema& schema) noexcept;
+}  // namespace observers
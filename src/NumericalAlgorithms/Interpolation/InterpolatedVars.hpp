@@ -14,6 +14,9 @@
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/BlockId.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Parallel/PupStlCpp17.hpp"
 
 namespace intrp {
 
@@ -57,6 +60,10 @@ struct Info {
   /// already been done for this `Info`.
   std::unordered_set<ElementId<VolumeDim>>
       interpolation_is_done_for_these_elements{};
+  /// The `InterpolationPlan::id` of the plan made for the points in
+  /// `block_coord_holders`, if any.  The `Holder`'s plan is only used
+  /// for this `Info` if it has this id.
+  std::optional<size_t> interpolation_plan_id{};
 };
 
 template <size_t VolumeDim, typename TagList>
@@ -65,6 +72,7 @@ void pup(PUP::er& p, Info<VolumeDim, TagList>& t) noexcept {  // NOLINT
   p | t.vars;
   p | t.global_offsets;
   p | t.interpolation_is_done_for_these_elements;
+  p | t.interpolation_plan_id;
 }
 
 template <size_t VolumeDim, typename TagList>
@@ -72,6 +80,74 @@ void operator|(PUP::er& p, Info<VolumeDim, TagList>& t) noexcept {  // NOLINT
   pup(p, t);
 }
 
+/// \brief Holds the assignment of the points of an `InterpolationTarget`
+/// to the local `Element`s and the interpolants onto them, so that they
+/// are reused for as long as the target sends the same points.
+///
+/// Targets whose points do not move in the block logical frame (e.g. a
+/// fixed sphere in a domain without time-dependent maps) send identical
+/// `block_coord_holders` at every `temporal_id`. For those targets the
+/// element logical coordinates and the interpolation matrices are
+/// computed only once per `Element` and `Mesh`.
+///
+/// The plan is cleared when the target has no more points waiting at this
+/// `Interpolator`, so that a target that is done doesn't keep its
+/// interpolation matrices alive. It is therefore reused for as long as the
+/// points of the next `temporal_id` arrive before the interpolation of the
+/// previous one is complete.
+template <size_t VolumeDim>
+struct InterpolationPlan {
+  struct ElementPlan {
+    Mesh<VolumeDim> mesh{};
+    /// The indices into `block_coord_holders` of the points in the
+    /// `Element`, which is empty if there are none.
+    std::vector<size_t> offsets{};
+    Irregular<VolumeDim> interpolant{};
+
+    void pup(PUP::er& p) noexcept {  // NOLINT
+      p | mesh;
+      p | offsets;
+      p | interpolant;
+    }
+  };
+
+  /// Identifies the set of points the plan was made for. It changes
+  /// whenever the plan is reset for new points.
+  size_t id = 0;
+  std::vector<std::optional<IdPair<
+      domain::BlockId, tnsr::I<double, VolumeDim, typename ::Frame::Logical>>>>
+      block_coord_holders{};
+  std::unordered_map<ElementId<VolumeDim>, ElementPlan> element_plans{};
+
+  /// Makes `block_coord_holders` the points of the plan, and returns the
+  /// id of the plan for them.
+  size_t set_points(
+      const std::vector<std::optional<
+          IdPair<domain::BlockId,
+                 tnsr::I<double, VolumeDim, typename ::Frame::Logical>>>>&
+          new_block_coord_holders) noexcept {
+    if (new_block_coord_holders != block_coord_holders) {
+      ++id;
+      block_coord_holders = new_block_coord_holders;
+      element_plans.clear();
+    }
+    return id;
+  }
+
+  /// Discards the points and the element plans. The id is kept, so that
+  /// the next points start a plan with a new id.
+  void clear() noexcept {
+    block_coord_holders.clear();
+    element_plans.clear();
+  }
+
+  void pup(PUP::er& p) noexcept {  // NOLINT
+    p | id;
+    p | block_coord_holders;
+    p | element_plans;
+  }
+};
+
 /// Holds `Info`s at all `temporal_id`s for a given
 /// `InterpolationTargetTag`.  Also holds `temporal_id`s when data has
 /// been interpolated; this is used for cleanup purposes.  All
@@ -86,6 +162,7 @@ struct Holder {
       infos;
   std::unordered_set<typename Metavariables::temporal_id::type>
       temporal_ids_when_data_has_been_interpolated;
+  InterpolationPlan<Metavariables::volume_dim> interpolation_plan{};
 };
 
 template <typename Metavariables, typename InterpolationTargetTag,
@@ -95,6 +172,7 @@ void pup(PUP::er& p,                                              // NOLINT
              t) noexcept {                                        // NOLINT
   p | t.infos;
   p | t.temporal_ids_when_data_has_been_interpolated;
+  p | t.interpolation_plan;
 }
 
 template <typename Metavariables, typename InterpolationTargetTag,
@@ -81,17 +81,19 @@ struct ReceivePoints {
         ](const gsl::not_null<
             typename intrp::Tags::InterpolatedVarsHolders<Metavariables>::type*>
               vars_holders) noexcept {
-          auto& vars_infos =
-              get<intrp::Vars::HolderTag<InterpolationTargetTag,
-                                         Metavariables>>(*vars_holders)
-                  .infos;
+          auto& holder = get<intrp::Vars::HolderTag<InterpolationTargetTag,
+                                                    Metavariables>>(
+              *vars_holders);
 
           // Add the target interpolation points at this temporal_id.
-          vars_infos.emplace(std::make_pair(
-              temporal_id,
-              intrp::Vars::Info<VolumeDim, typename InterpolationTargetTag::
-                                               vars_to_interpolate_to_target>{
-                  std::move(block_logical_coords)}));
+          // If they are the same points as before, the interpolation
+          // plan made for them is reused.
+          intrp::Vars::Info<VolumeDim, typename InterpolationTargetTag::
+                                           vars_to_interpolate_to_target>
+              info{std::move(block_logical_coords)};
+          info.interpolation_plan_id =
+              holder.interpolation_plan.set_points(info.block_coord_holders);
+          holder.infos.emplace(temporal_id, std::move(info));
         });
 
     try_to_interpolate<InterpolationTargetTag>(
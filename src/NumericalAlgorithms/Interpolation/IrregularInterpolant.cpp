@@ -4,92 +4,93 @@
 #include "IrregularInterpolant.hpp"
 
 #include <array>
+#include <cstddef>
+#include <pup.h>
+#include <pup_stl.h>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Blas.hpp"
+#include "Utilities/Gsl.hpp"
 // IWYU pragma: no_forward_declare Tensor
 
-namespace {
+namespace intrp {
 
 template <size_t Dim>
-Matrix interpolation_matrix(
-    const Mesh<Dim>& mesh,
-    const tnsr::I<DataVector, Dim, Frame::Logical>& points) noexcept;
-
-template <>
-Matrix interpolation_matrix(
-    const Mesh<1>& mesh,
-    const tnsr::I<DataVector, 1, Frame::Logical>& points) noexcept {
-  // For 1d interpolation matrix, simply return the legendre-gauss-lobatto
-  // matrix.
-  return Spectral::interpolation_matrix(mesh, get<0>(points));
-}
-
-template <>
-Matrix interpolation_matrix(
-    const Mesh<2>& mesh,
-    const tnsr::I<DataVector, 2, Frame::Logical>& points) noexcept {
-  const std::array<Matrix, 2> matrices{
-      {Spectral::interpolation_matrix(mesh.slice_through(0), get<0>(points)),
-       Spectral::interpolation_matrix(mesh.slice_through(1), get<1>(points))}};
+Irregular<Dim>::Irregular() = default;
 
-  const auto number_of_points = get<0>(points).size();
-  Matrix result(number_of_points, mesh.number_of_grid_points());
-  // First dimension of DataVector varies fastest.
-  for (size_t j = 0, s = 0; j < mesh.extents(1); ++j) {
-    for (size_t i = 0; i < mesh.extents(0); ++i) {
-      for (size_t p = 0; p < number_of_points; ++p) {
-        result(p, s) = matrices[0](p, i) * matrices[1](p, j);
+template <size_t Dim>
+Irregular<Dim>::Irregular(
+    const Mesh<Dim>& source_mesh,
+    const tnsr::I<DataVector, Dim, Frame::Logical>& target_points) noexcept {
+  const size_t number_of_points = get<0>(target_points).size();
+  for (size_t d = 0; d < Dim; ++d) {
+    const Matrix matrix = Spectral::interpolation_matrix(
+        source_mesh.slice_through(d), target_points.get(d));
+    auto& transposed_matrix = gsl::at(interpolation_matrices_, d);
+    transposed_matrix = Matrix(source_mesh.extents(d), number_of_points);
+    for (size_t p = 0; p < number_of_points; ++p) {
+      for (size_t i = 0; i < source_mesh.extents(d); ++i) {
+        transposed_matrix(i, p) = matrix(p, i);
       }
-      ++s;
     }
   }
-  return result;
 }
 
-template <>
-Matrix interpolation_matrix(
-    const Mesh<3>& mesh,
-    const tnsr::I<DataVector, 3, Frame::Logical>& points) noexcept {
-  const std::array<Matrix, 3> matrices{
-      {Spectral::interpolation_matrix(mesh.slice_through(0), get<0>(points)),
-       Spectral::interpolation_matrix(mesh.slice_through(1), get<1>(points)),
-       Spectral::interpolation_matrix(mesh.slice_through(2), get<2>(points))}};
+template <size_t Dim>
+void Irregular<Dim>::pup(PUP::er& p) noexcept {
+  p | interpolation_matrices_;
+}
 
-  const auto number_of_points = get<0>(points).size();
-  Matrix result(number_of_points, mesh.number_of_grid_points());
-  // First dimension of DataVector varies fastest.
-  for (size_t k = 0, s = 0; k < mesh.extents(2); ++k) {
-    for (size_t j = 0; j < mesh.extents(1); ++j) {
-      for (size_t i = 0; i < mesh.extents(0); ++i) {
-        for (size_t p = 0; p < number_of_points; ++p) {
-          result(p, s) =
-              matrices[0](p, i) * matrices[1](p, j) * matrices[2](p, k);
-        }
-        ++s;
-      }
-    }
+template <size_t Dim>
+size_t Irregular<Dim>::number_of_source_points() const noexcept {
+  size_t result = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    result *= gsl::at(interpolation_matrices_, d).rows();
   }
   return result;
 }
-}  // namespace
-
-namespace intrp {
-
-template <size_t Dim>
-Irregular<Dim>::Irregular() = default;
-
-template <size_t Dim>
-Irregular<Dim>::Irregular(
-    const Mesh<Dim>& source_mesh,
-    const tnsr::I<DataVector, Dim, Frame::Logical>& target_points) noexcept
-    : interpolation_matrix_(interpolation_matrix(source_mesh, target_points)) {}
 
 template <size_t Dim>
-void Irregular<Dim>::pup(PUP::er& p) noexcept {
-  p | interpolation_matrix_;
+void Irregular<Dim>::interpolate_components(
+    const gsl::not_null<double*> result, const double* const source,
+    const size_t number_of_components) const noexcept {
+  const size_t number_of_points = number_of_target_points();
+  const size_t source_size = number_of_source_points() * number_of_components;
+  if (number_of_points == 0 or source_size == 0) {
+    return;
+  }
+  // The data partially contracted with the weights of one point. Contracting
+  // over the first (fastest varying) dimension leaves the largest amount of
+  // data, and each further contraction reduces it.
+  std::array<std::vector<double>, 2> buffers{};
+  if constexpr (Dim > 1) {
+    buffers[0].resize(source_size / interpolation_matrices_[0].rows());
+    buffers[1].resize(buffers[0].size() / interpolation_matrices_[1].rows());
+  }
+  for (size_t p = 0; p < number_of_points; ++p) {
+    const double* input = source;
+    size_t input_size = source_size;
+    for (size_t d = 0; d < Dim; ++d) {
+      const auto& matrix = gsl::at(interpolation_matrices_, d);
+      const size_t extent = matrix.rows();
+      const size_t output_size = input_size / extent;
+      const bool is_last_dim = d == Dim - 1;
+      // The last contraction leaves one value per component, which goes
+      // into the result at the offset of this point.
+      double* const output =
+          is_last_dim ? result.get() + p : gsl::at(buffers, d % 2).data();
+      // output[m] = sum_i weights[i] * input[i + extent * m]
+      dgemv_('T', extent, output_size, 1.0, input, extent,
+             matrix.data() + p * matrix.spacing(), 1, 0.0, output,
+             is_last_dim ? number_of_points : 1);
+      input = output;
+      input_size = output_size;
+    }
+  }
 }
 
 template <size_t Dim>
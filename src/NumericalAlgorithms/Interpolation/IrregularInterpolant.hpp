@@ -3,13 +3,13 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "DataStructures/Variables.hpp"
-#include "Utilities/Blas.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 
@@ -26,6 +26,12 @@ namespace intrp {
 
 /// \ingroup NumericalAlgorithmsGroup
 /// Interpolates a `Variables` onto an arbitrary set of points.
+///
+/// \details The interpolant is the tensor product of one-dimensional Lagrange
+/// interpolants through the grid points of the source `Mesh`. Only the
+/// one-dimensional interpolation weights of each target point are stored,
+/// and the interpolation contracts them with the data one dimension at a
+/// time, for all tensor components at once.
 template <size_t Dim>
 class Irregular {
  public:
@@ -54,9 +60,23 @@ class Irregular {
 
  private:
   friend bool operator==(const Irregular& lhs, const Irregular& rhs) noexcept {
-    return lhs.interpolation_matrix_ == rhs.interpolation_matrix_;
+    return lhs.interpolation_matrices_ == rhs.interpolation_matrices_;
   }
-  Matrix interpolation_matrix_;
+
+  size_t number_of_target_points() const noexcept {
+    return interpolation_matrices_[0].columns();
+  }
+  size_t number_of_source_points() const noexcept;
+
+  // Interpolates `number_of_components` components stored one after the
+  // other in `source` into `result`, in the layout of a `Variables`
+  void interpolate_components(gsl::not_null<double*> result,
+                              const double* source,
+                              size_t number_of_components) const noexcept;
+
+  // The interpolation matrix of each dimension, stored transposed so that
+  // the weights of each target point are contiguous
+  std::array<Matrix, Dim> interpolation_matrices_{};
 };
 
 template <size_t Dim>
@@ -64,24 +84,18 @@ template <typename TagsList>
 void Irregular<Dim>::interpolate(
     const gsl::not_null<Variables<TagsList>*> result,
     const Variables<TagsList>& vars) const noexcept {
-  // For matrix multiplication of Interp . Source = Result:
-  //   matrix Interp is m rows by k columns
-  //   matrix Source is k rows by n columns
-  //   matrix Result is m rows by n columns
-  const size_t m = interpolation_matrix_.rows();
-  const size_t k = interpolation_matrix_.columns();
-  const size_t n = vars.number_of_independent_components;
-  ASSERT(k == vars.number_of_grid_points(),
+  const size_t m = number_of_target_points();
+  ASSERT(number_of_source_points() == vars.number_of_grid_points(),
          "Number of grid points in source 'vars', "
              << vars.number_of_grid_points()
-             << ",\n disagrees with the size of the source_mesh, " << k
+             << ",\n disagrees with the size of the source_mesh, "
+             << number_of_source_points()
              << ", that was passed into the constructor");
   if (result->number_of_grid_points() != m) {
     *result = Variables<TagsList>(m, 0.);
   }
-  dgemm_('n', 'n', m, n, k, 1.0, interpolation_matrix_.data(),
-         interpolation_matrix_.spacing(), vars.data(), k, 0.0, result->data(),
-         m);
+  interpolate_components(make_not_null(result->data()), vars.data(),
+                         vars.number_of_independent_components);
 }
 
 template <size_t Dim>
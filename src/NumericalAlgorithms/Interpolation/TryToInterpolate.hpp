@@ -45,10 +45,16 @@ void interpolate_data(
               holders,
           const typename Tags::VolumeVarsInfo<Metavariables>::type&
               volume_vars_info) noexcept {
-        auto& interp_info =
+        auto& holder =
             get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
-                *holders)
-                .infos.at(temporal_id);
+                *holders);
+        auto& interp_info = holder.infos.at(temporal_id);
+        // The interpolation plan is only valid if it was made for the
+        // points at this temporal_id.
+        auto* const plan =
+            interp_info.interpolation_plan_id == holder.interpolation_plan.id
+                ? &holder.interpolation_plan
+                : nullptr;
 
         for (const auto& volume_info_outer : volume_vars_info) {
           // Are we at the right time?
@@ -59,6 +65,10 @@ void interpolate_data(
           // Get list of ElementIds that have the correct temporal_id and that
           // have not yet been interpolated.
           std::vector<ElementId<Metavariables::volume_dim>> element_ids;
+          // The subset of those for which the plan has no interpolant on
+          // the current Mesh.
+          std::vector<ElementId<Metavariables::volume_dim>>
+              element_ids_to_plan;
 
           for (const auto& volume_info_inner : volume_info_outer.second) {
             // Have we interpolated this element before?
@@ -68,48 +78,98 @@ void interpolate_data(
               interp_info.interpolation_is_done_for_these_elements.emplace(
                   volume_info_inner.first);
               element_ids.push_back(volume_info_inner.first);
+              if (plan != nullptr) {
+                const auto element_plan =
+                    plan->element_plans.find(volume_info_inner.first);
+                if (element_plan != plan->element_plans.end() and
+                    (element_plan->second.offsets.empty() or
+                     element_plan->second.mesh ==
+                         volume_info_inner.second.mesh)) {
+                  continue;
+                }
+              }
+              element_ids_to_plan.push_back(volume_info_inner.first);
             }
           }
 
           // Get element logical coordinates.
           const auto element_coord_holders = element_logical_coordinates(
-              element_ids, interp_info.block_coord_holders);
-
-          // Construct local vars and interpolate.
-          for (const auto& element_coord_pair : element_coord_holders) {
-            const auto& element_id = element_coord_pair.first;
-            const auto& element_coord_holder = element_coord_pair.second;
-            const auto& volume_info = volume_info_outer.second.at(element_id);
-
-            // Construct local_vars which is some set of variables
-            // derived from volume_info.vars plus an arbitrary set
-            // of compute items in
-            // InterpolationTargetTag::compute_items_on_source.
-
-            auto new_box = db::create<
-                db::AddSimpleTags<::Tags::Variables<
-                    typename Metavariables::interpolator_source_vars>>,
-                db::AddComputeTags<
-                    typename InterpolationTargetTag::compute_items_on_source>>(
-                volume_info.vars);
-
-            Variables<
-                typename InterpolationTargetTag::vars_to_interpolate_to_target>
-                local_vars(volume_info.mesh.number_of_grid_points());
-
-            tmpl::for_each<
-                typename InterpolationTargetTag::vars_to_interpolate_to_target>(
-                [&new_box, &local_vars](auto x) noexcept {
-                  using tag = typename decltype(x)::type;
-                  get<tag>(local_vars) = db::get<tag>(new_box);
-                });
-
-            // Now interpolate.
-            intrp::Irregular<Metavariables::volume_dim> interpolator(
-                volume_info.mesh, element_coord_holder.element_logical_coords);
-            interp_info.vars.emplace_back(interpolator.interpolate(local_vars));
-            interp_info.global_offsets.emplace_back(
-                element_coord_holder.offsets);
+              element_ids_to_plan, interp_info.block_coord_holders);
+
+          const auto interpolate_element =
+              [&interp_info, &volume_info_outer](
+                  const ElementId<Metavariables::volume_dim>& element_id,
+                  const Irregular<Metavariables::volume_dim>& interpolator,
+                  const std::vector<size_t>& offsets) noexcept {
+                const auto& volume_info =
+                    volume_info_outer.second.at(element_id);
+
+                // Construct local_vars which is some set of variables
+                // derived from volume_info.vars plus an arbitrary set
+                // of compute items in
+                // InterpolationTargetTag::compute_items_on_source.
+
+                auto new_box = db::create<
+                    db::AddSimpleTags<::Tags::Variables<
+                        typename Metavariables::interpolator_source_vars>>,
+                    db::AddComputeTags<typename InterpolationTargetTag::
+                                           compute_items_on_source>>(
+                    volume_info.vars);
+
+                Variables<typename InterpolationTargetTag::
+                              vars_to_interpolate_to_target>
+                    local_vars(volume_info.mesh.number_of_grid_points());
+
+                tmpl::for_each<typename InterpolationTargetTag::
+                                   vars_to_interpolate_to_target>(
+                    [&new_box, &local_vars](auto x) noexcept {
+                      using tag = typename decltype(x)::type;
+                      get<tag>(local_vars) = db::get<tag>(new_box);
+                    });
+
+                // Now interpolate.
+                interp_info.vars.emplace_back(
+                    interpolator.interpolate(local_vars));
+                interp_info.global_offsets.emplace_back(offsets);
+              };
+
+          if (plan == nullptr) {
+            for (const auto& element_coord_pair : element_coord_holders) {
+              const auto& element_id = element_coord_pair.first;
+              const auto& element_coord_holder = element_coord_pair.second;
+              interpolate_element(
+                  element_id,
+                  intrp::Irregular<Metavariables::volume_dim>(
+                      volume_info_outer.second.at(element_id).mesh,
+                      element_coord_holder.element_logical_coords),
+                  element_coord_holder.offsets);
+            }
+            continue;
+          }
+
+          // Add the new elements to the plan, including those that contain
+          // none of the points, and interpolate with the plan.
+          for (const auto& element_id : element_ids_to_plan) {
+            auto& element_plan = plan->element_plans[element_id];
+            element_plan.mesh = volume_info_outer.second.at(element_id).mesh;
+            const auto element_coord_holder =
+                element_coord_holders.find(element_id);
+            if (element_coord_holder == element_coord_holders.end()) {
+              element_plan.offsets.clear();
+              element_plan.interpolant = Irregular<Metavariables::volume_dim>{};
+            } else {
+              element_plan.offsets = element_coord_holder->second.offsets;
+              element_plan.interpolant = Irregular<Metavariables::volume_dim>(
+                  element_plan.mesh,
+                  element_coord_holder->second.element_logical_coords);
+            }
+          }
+          for (const auto& element_id : element_ids) {
+            const auto& element_plan = plan->element_plans.at(element_id);
+            if (not element_plan.offsets.empty()) {
+              interpolate_element(element_id, element_plan.interpolant,
+                                  element_plan.offsets);
+            }
           }
         }
       },
@@ -156,15 +216,20 @@ void try_to_interpolate(
           receiver_proxy, info.vars, info.global_offsets, temporal_id);
     }
 
-    // Clear interpolated data, since we don't need it anymore.
+    // Clear interpolated data, since we don't need it anymore. Once the
+    // target has no more points here, its interpolation plan is unused.
     db::mutate<Tags::InterpolatedVarsHolders<Metavariables>>(
         box, [&temporal_id](
                  const gsl::not_null<typename Tags::InterpolatedVarsHolders<
                      Metavariables>::type*>
                      holders_l) noexcept {
-          get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
-              *holders_l)
-              .infos.erase(temporal_id);
+          auto& holder =
+              get<Vars::HolderTag<InterpolationTargetTag, Metavariables>>(
+                  *holders_l);
+          holder.infos.erase(temporal_id);
+          if (holder.infos.empty()) {
+            holder.interpolation_plan.clear();
+          }
         });
   }
 }
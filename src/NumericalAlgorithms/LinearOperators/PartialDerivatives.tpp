@@ -5,6 +5,12 @@
 
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -52,18 +58,19 @@ struct LogicalImpl;
 //
 // - We factor out the `logical_deriv_index == 0` case so that we do not need to
 //   zero the memory in `du` before the computation.
-template <typename DerivativeTags, size_t Dim, typename DerivativeFrame>
+//
+// - The components are passed as raw pointers together with their number so
+//   that the contraction can be applied to a block of components at a time.
+//   This allows the overload that computes the logical derivatives to contract
+//   each block while its logical derivatives are still in cache.
+template <size_t Dim, typename DerivativeFrame>
 void partial_derivatives_impl(
-    const gsl::not_null<Variables<db::wrap_tags_in<
-        Tags::deriv, DerivativeTags, tmpl::size_t<Dim>, DerivativeFrame>>*>
-        du,
+    double* pdu,
     const std::array<const double*, Dim>& logical_partial_derivatives_of_u,
+    const size_t number_of_independent_components,
+    const size_t num_grid_points,
     const InverseJacobian<DataVector, Dim, Frame::Logical, DerivativeFrame>&
         inverse_jacobian) noexcept {
-  constexpr size_t number_of_independent_components =
-      Variables<DerivativeTags>::number_of_independent_components;
-  double* pdu = du->data();
-  const size_t num_grid_points = du->number_of_grid_points();
   DataVector lhs{};
   DataVector logical_du{};
 
@@ -108,6 +115,64 @@ void partial_derivatives_impl(
     }
   }
 }
+
+template <typename DerivativeTags, size_t Dim, typename DerivativeFrame>
+void partial_derivatives_impl(
+    const gsl::not_null<Variables<db::wrap_tags_in<
+        Tags::deriv, DerivativeTags, tmpl::size_t<Dim>, DerivativeFrame>>*>
+        du,
+    const std::array<const double*, Dim>& logical_partial_derivatives_of_u,
+    const InverseJacobian<DataVector, Dim, Frame::Logical, DerivativeFrame>&
+        inverse_jacobian) noexcept {
+  partial_derivatives_impl(
+      du->data(), logical_partial_derivatives_of_u,
+      Variables<DerivativeTags>::number_of_independent_components,
+      du->number_of_grid_points(), inverse_jacobian);
+}
+
+// Computes the logical derivatives of `number_of_components` consecutive
+// components starting at `u`, using the same sequence of matrix
+// multiplications and transposes as `LogicalImpl`. The `buffer` must hold
+// `2 * number_of_components * mesh.number_of_grid_points()` doubles.
+template <size_t Dim>
+void logical_derivatives_of_components(
+    const gsl::not_null<std::array<double*, Dim>*> logical_du,
+    const gsl::not_null<double*> buffer, const double* const u,
+    const size_t number_of_components, const Mesh<Dim>& mesh) noexcept {
+  const size_t deriv_size = number_of_components * mesh.number_of_grid_points();
+  double* const u_transposed = buffer.get();
+  // clang-tidy: no pointer arithmetic
+  double* const du_transposed = buffer.get() + deriv_size;  // NOLINT
+  size_t chunk_size = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    const size_t extent = mesh.extents(d);
+    const Matrix& differentiation_matrix =
+        Spectral::differentiation_matrix(mesh.slice_through(d));
+    if (d == 0) {
+      dgemm_<true>('N', 'N', extent, deriv_size / extent, extent, 1.0,
+                   differentiation_matrix.data(),
+                   differentiation_matrix.spacing(), u, extent, 0.0,
+                   (*logical_du)[0], extent);
+    } else {
+      // Rotate the indices so that direction `d` varies fastest, differentiate
+      // and rotate back.
+      raw_transpose(make_not_null(u_transposed), u, chunk_size,
+                    deriv_size / chunk_size);
+      dgemm_<true>('N', 'N', extent, deriv_size / extent, extent, 1.0,
+                   differentiation_matrix.data(),
+                   differentiation_matrix.spacing(), u_transposed, extent, 0.0,
+                   du_transposed, extent);
+      raw_transpose(make_not_null(gsl::at(*logical_du, d)), du_transposed,
+                    deriv_size / chunk_size, chunk_size);
+    }
+    chunk_size *= extent;
+  }
+}
+
+// The number of doubles of scratch memory that the fused computation of the
+// logical derivatives and their contraction with the inverse Jacobian targets
+// per block of components, chosen so that a block fits in the L2 cache.
+constexpr size_t fused_derivatives_block_size = 32768;
 }  // namespace partial_derivatives_detail
 
 template <typename DerivativeTags, typename VariableTags, size_t Dim>
@@ -191,35 +256,55 @@ void partial_derivatives(
     partial_derivatives_of_u.initialize(mesh.number_of_grid_points());
   }
 
+  // The logical derivatives of a block of components are contracted with the
+  // inverse Jacobian immediately after they are computed, so the logical
+  // derivatives of all components are never stored at once. For many
+  // components this avoids streaming a buffer of `Dim` times the size of `u`
+  // through memory twice.
+  constexpr size_t number_of_independent_components =
+      Variables<DerivativeTags>::number_of_independent_components;
+  const size_t num_grid_points = u.number_of_grid_points();
+  const size_t max_components_per_block =
+      partial_derivatives_detail::fused_derivatives_block_size /
+      ((Dim + 2) * num_grid_points);
+  const size_t components_per_block =
+      std::min(number_of_independent_components,
+               std::max(size_t{1}, max_components_per_block));
+
   // Using malloc instead of new is faster because we do not need to zero the
   // data.
   // clang-tidy: cppcoreguidelines-no-malloc
   // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-  std::unique_ptr<double[], decltype(&free)> logical_derivs_data(
-      static_cast<double*>(
-          malloc(Dim * u.number_of_grid_points() *  // NOLINT
-                 Variables<DerivativeTags>::number_of_independent_components *
-                 sizeof(double))),
+  std::unique_ptr<double[], decltype(&free)> buffer(
+      static_cast<double*>(malloc((Dim + 2) * components_per_block *  // NOLINT
+                                  num_grid_points * sizeof(double))),
       &free);
   std::array<double*, Dim> logical_derivs{};
-  for (size_t i = 0; i < Dim; ++i) {
-    gsl::at(logical_derivs, i) =
-        &(logical_derivs_data
-              [i * u.number_of_grid_points() *
-               Variables<DerivativeTags>::number_of_independent_components]);
-  }
-  partial_derivatives_detail::LogicalImpl<
-      Dim, VariableTags, DerivativeTags>::apply(make_not_null(&logical_derivs),
-                                                &partial_derivatives_of_u, u,
-                                                mesh);
-
   std::array<const double*, Dim> const_logical_derivs{};
-  for (size_t i = 0; i < Dim; ++i) {
-    gsl::at(const_logical_derivs, i) = gsl::at(logical_derivs, i);
+  for (size_t first_component = 0;
+       first_component < number_of_independent_components;
+       first_component += components_per_block) {
+    const size_t number_of_components =
+        std::min(components_per_block,
+                 number_of_independent_components - first_component);
+    for (size_t i = 0; i < Dim; ++i) {
+      gsl::at(logical_derivs, i) =
+          &buffer[i * number_of_components * num_grid_points];
+      gsl::at(const_logical_derivs, i) = gsl::at(logical_derivs, i);
+    }
+    partial_derivatives_detail::logical_derivatives_of_components(
+        make_not_null(&logical_derivs),
+        make_not_null(&buffer[Dim * number_of_components * num_grid_points]),
+        // clang-tidy: no pointer arithmetic
+        u.data() + first_component * num_grid_points,  // NOLINT
+        number_of_components, mesh);
+    partial_derivatives_detail::partial_derivatives_impl(
+        // clang-tidy: no pointer arithmetic
+        partial_derivatives_of_u.data() +  // NOLINT
+            first_component * Dim * num_grid_points,
+        const_logical_derivs, number_of_components, num_grid_points,
+        inverse_jacobian);
   }
-  partial_derivatives_detail::partial_derivatives_impl<DerivativeTags>(
-      make_not_null(&partial_derivatives_of_u), const_logical_derivs,
-      inverse_jacobian);
 }
 
 template <typename DerivativeTags, typename VariableTags, size_t Dim,
@@ -16,6 +16,9 @@ extern "C" {
 #pragma GCC diagnostic ignored "-Wredundant-decls"
 extern void dgesv_(int*, int*, double*, int*, int*, double*, int*,  // NOLINT
                    int*);
+extern void dgetrf_(int*, int*, double*, int*, int*, int*);  // NOLINT
+extern void dgetrs_(char*, int*, int*, const double*, int*,  // NOLINT
+                    const int*, double*, int*, int*);
 #pragma GCC diagnostic pop
 }
 
@@ -131,4 +134,48 @@ int general_matrix_linear_solve(const gsl::not_null<DataVector*> solution,
       solution, make_not_null(&copied_matrix_operator), rhs, number_of_rhs);
 }
 
+int batched_lu_factorization(const gsl::not_null<double*> matrices,
+                             const gsl::not_null<int*> pivots,
+                             const size_t matrix_size,
+                             const size_t number_of_matrices) noexcept {
+  int size = static_cast<int>(matrix_size);
+  int first_failure = 0;
+  for (size_t i = 0; i < number_of_matrices; ++i) {
+    int info = 0;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    dgetrf_(&size, &size, matrices.get() + i * matrix_size * matrix_size,
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            &size, pivots.get() + i * matrix_size, &info);
+    if (first_failure == 0) {
+      first_failure = info;
+    }
+  }
+  return first_failure;
+}
+
+int batched_lu_solve(const gsl::not_null<double*> rhs_in_solution_out,
+                     const double* const factored_matrices,
+                     const int* const pivots, const size_t matrix_size,
+                     const size_t number_of_matrices) noexcept {
+  char transpose = 'N';
+  int size = static_cast<int>(matrix_size);
+  int number_of_rhs = 1;
+  int first_failure = 0;
+  for (size_t i = 0; i < number_of_matrices; ++i) {
+    int info = 0;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    dgetrs_(&transpose, &size, &number_of_rhs,
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            factored_matrices + i * matrix_size * matrix_size, &size,
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            pivots + i * matrix_size,
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            rhs_in_solution_out.get() + i * matrix_size, &size, &info);
+    if (first_failure == 0) {
+      first_failure = info;
+    }
+  }
+  return first_failure;
+}
+
 }  // namespace lapack
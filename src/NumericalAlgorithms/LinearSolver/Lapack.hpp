@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "Utilities/Gsl.hpp"
 
 /// \cond
@@ -81,4 +83,40 @@ int general_matrix_linear_solve(gsl::not_null<DataVector*> solution,
                                 const DataVector& rhs,
                                 int number_of_rhs = 0) noexcept;
 // @}
+
+/*!
+ * \ingroup LinearSolverGroup
+ * \brief Wrapper for LAPACK dgetrf applied to a batch of square matrices,
+ * which computes the LUP decomposition of each matrix in-place.
+ *
+ * \details `matrices` holds `number_of_matrices` column-major matrices of
+ * size `matrix_size` by `matrix_size` stored one after the other, and is
+ * overwritten with their LU factors. `pivots` must hold `matrix_size *
+ * number_of_matrices` entries and is filled with the pivots of each matrix,
+ * also one after the other. The factors and pivots can be passed to
+ * `batched_lu_solve` any number of times to solve for new right-hand sides
+ * without repeating the factorization.
+ *
+ * The function return `int` is the first nonzero value of the `INFO` field of
+ * the LAPACK calls, or 0 if all factorizations succeeded.
+ */
+int batched_lu_factorization(gsl::not_null<double*> matrices,
+                             gsl::not_null<int*> pivots, size_t matrix_size,
+                             size_t number_of_matrices) noexcept;
+
+/*!
+ * \ingroup LinearSolverGroup
+ * \brief Wrapper for LAPACK dgetrs applied to a batch of matrices factored
+ * by `batched_lu_factorization`.
+ *
+ * \details `rhs_in_solution_out` holds one right-hand side of size
+ * `matrix_size` for each matrix, one after the other, and is overwritten with
+ * the solutions.
+ *
+ * The function return `int` is the first nonzero value of the `INFO` field of
+ * the LAPACK calls, or 0 if all solves succeeded.
+ */
+int batched_lu_solve(gsl::not_null<double*> rhs_in_solution_out,
+                     const double* factored_matrices, const int* pivots,
+                     size_t matrix_size, size_t number_of_matrices) noexcept;
 }  // namespace lapack
@@ -0,0 +1,146 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Parallel/MeasuredCosts.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace tuples {
+template <typename... InboxTags>
+class TaggedTuple;
+}  // namespace tuples
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+/// \endcond
+
+namespace Parallel {
+namespace Actions {
+/*!
+ * \ingroup ActionsGroup
+ * \brief Add the `Parallel::Tags::MeasuredCosts` to the \ref DataBoxGroup
+ * "DataBox", with all costs set to zero.
+ *
+ * Place this action in the `Initialization` phase of a component that
+ * measures its costs with `Parallel::Actions::StartCostMeasurement` and
+ * `Parallel::Actions::StopCostMeasurement`.
+ *
+ * DataBox changes:
+ * - Adds:
+ *   - `Parallel::Tags::MeasuredCosts`
+ * - Removes: nothing
+ * - Modifies: nothing
+ */
+struct InitializeMeasuredCosts {
+  using simple_tags = tmpl::list<Tags::MeasuredCosts>;
+  using compute_tags = tmpl::list<>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    return {std::move(box)};
+  }
+};
+
+/*!
+ * \ingroup ActionsGroup
+ * \brief Start measuring the wall time spent on the actions of the cost
+ * category `Category`.
+ *
+ * The actions between this action and the matching
+ * `Parallel::Actions::StopCostMeasurement` are timed together, and the time is
+ * added to the `Parallel::Tags::MeasuredCosts`. The timed actions should not
+ * wait for data from other elements, because the time an element waits is
+ * spent on the work of other elements.
+ *
+ * Uses:
+ * - DataBox:
+ *   - `Parallel::Tags::MeasuredCosts`
+ *
+ * DataBox changes:
+ * - Adds: nothing
+ * - Removes: nothing
+ * - Modifies:
+ *   - `Parallel::Tags::MeasuredCosts`
+ */
+template <CostCategory Category>
+struct StartCostMeasurement {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    db::mutate<Tags::MeasuredCosts>(
+        make_not_null(&box),
+        [](const gsl::not_null<MeasuredCosts*> costs) noexcept {
+          costs->start(Category, sys::wall_time());
+        });
+    return {std::move(box)};
+  }
+};
+
+/*!
+ * \ingroup ActionsGroup
+ * \brief Stop measuring the wall time spent on the actions of the cost
+ * category `Category`, and add it to the `Parallel::Tags::MeasuredCosts`.
+ *
+ * \see Parallel::Actions::StartCostMeasurement
+ *
+ * Uses:
+ * - DataBox:
+ *   - `Parallel::Tags::MeasuredCosts`
+ *
+ * DataBox changes:
+ * - Adds: nothing
+ * - Removes: nothing
+ * - Modifies:
+ *   - `Parallel::Tags::MeasuredCosts`
+ */
+template <CostCategory Category>
+struct StopCostMeasurement {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    db::mutate<Tags::MeasuredCosts>(
+        make_not_null(&box),
+        [](const gsl::not_null<MeasuredCosts*> costs) noexcept {
+          costs->stop(Category, sys::wall_time());
+        });
+    return {std::move(box)};
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \brief The actions in `ActionList` with the start and the stop of a cost
+/// measurement of `Category` around them.
+template <CostCategory Category, typename ActionList>
+using measure_cost =
+    tmpl::flatten<tmpl::list<StartCostMeasurement<Category>, ActionList,
+                             StopCostMeasurement<Category>>>;
+}  // namespace Actions
+}  // namespace Parallel
@@ -11,6 +11,7 @@
 #include <initializer_list>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 #include "Informer/Informer.hpp"
 #include "Options/ParseOptions.hpp"
@@ -41,6 +42,17 @@ CREATE_HAS_TYPE_ALIAS_V(phase_change_tags_and_combines_list)
 CREATE_GET_TYPE_ALIAS_OR_DEFAULT(phase_change_tags_and_combines_list)
 CREATE_HAS_TYPE_ALIAS(initialize_phase_change_decision_data)
 CREATE_HAS_TYPE_ALIAS_V(initialize_phase_change_decision_data)
+
+template <typename ParallelComponent, typename = std::void_t<>>
+struct has_execute_before_exit : std::false_type {};
+
+template <typename ParallelComponent>
+struct has_execute_before_exit<
+    ParallelComponent,
+    std::void_t<decltype(ParallelComponent::execute_before_exit(
+        std::declval<CProxy_GlobalCache<
+            typename ParallelComponent::metavariables>&>()))>>
+    : std::true_type {};
 }  // namespace detail
 
 /// \ingroup ParallelGroup
@@ -500,6 +512,12 @@ void Main<Metavariables>::execute_next_phase() noexcept {
       make_not_null(&phase_change_decision_data_), current_phase_,
       global_cache_proxy_);
   if (Metavariables::Phase::Exit == current_phase_) {
+    tmpl::for_each<component_list>([this](auto parallel_component) noexcept {
+      using component = tmpl::type_from<decltype(parallel_component)>;
+      if constexpr (detail::has_execute_before_exit<component>::value) {
+        component::execute_before_exit(global_cache_proxy_);
+      }
+    });
     Informer::print_exit_info();
     sys::exit();
   }
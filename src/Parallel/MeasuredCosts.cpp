@@ -0,0 +1,96 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/MeasuredCosts.hpp"
+
+#include <numeric>
+#include <ostream>
+#include <pup.h>
+#include <pup_stl.h>
+
+#include "Parallel/PupStlCpp17.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Parallel {
+std::ostream& operator<<(std::ostream& os,
+                         const CostCategory category) noexcept {
+  switch (category) {
+    case CostCategory::VolumeTerms:
+      return os << "VolumeTerms";
+    case CostCategory::BoundaryCorrections:
+      return os << "BoundaryCorrections";
+    case CostCategory::PrimitiveRecovery:
+      return os << "PrimitiveRecovery";
+    case CostCategory::Observation:
+      return os << "Observation";
+    default:  // LCOV_EXCL_LINE
+      // LCOV_EXCL_START
+      ERROR("Unknown CostCategory " << static_cast<int>(category));
+      // LCOV_EXCL_STOP
+  }
+}
+
+void MeasuredCosts::start(const CostCategory category,
+                          const double wall_time) noexcept {
+  ASSERT(not current_category_.has_value(),
+         "Cannot start measuring the cost of "
+             << category << " while measuring the cost of "
+             << *current_category_ << ".");
+  current_category_ = category;
+  start_time_ = wall_time;
+}
+
+void MeasuredCosts::stop(const CostCategory category,
+                         const double wall_time) noexcept {
+  ASSERT(current_category_ == category,
+         "Cannot stop measuring the cost of "
+             << category << " because it was not started.");
+  if (not paused_) {
+    gsl::at(costs_, static_cast<size_t>(category)) += wall_time - start_time_;
+  }
+  current_category_.reset();
+  paused_ = false;
+}
+
+void MeasuredCosts::pause(const double wall_time) noexcept {
+  ASSERT(current_category_.has_value() and not paused_,
+         "Can only pause a running cost measurement.");
+  gsl::at(costs_, static_cast<size_t>(*current_category_)) +=
+      wall_time - start_time_;
+  paused_ = true;
+}
+
+void MeasuredCosts::resume(const double wall_time) noexcept {
+  ASSERT(current_category_.has_value() and paused_,
+         "Can only resume a paused cost measurement.");
+  start_time_ = wall_time;
+  paused_ = false;
+}
+
+double MeasuredCosts::cost(const CostCategory category) const noexcept {
+  return gsl::at(costs_, static_cast<size_t>(category));
+}
+
+double MeasuredCosts::total() const noexcept {
+  return std::accumulate(costs_.begin(), costs_.end(), 0.);
+}
+
+void MeasuredCosts::pup(PUP::er& p) noexcept {
+  p | costs_;
+  p | current_category_;
+  p | start_time_;
+  p | paused_;
+}
+
+bool operator==(const MeasuredCosts& lhs, const MeasuredCosts& rhs) noexcept {
+  return lhs.costs_ == rhs.costs_ and
+         lhs.current_category_ == rhs.current_category_ and
+         lhs.start_time_ == rhs.start_time_ and lhs.paused_ == rhs.paused_;
+}
+
+bool operator!=(const MeasuredCosts& lhs, const MeasuredCosts& rhs) noexcept {
+  return not(lhs == rhs);
+}
+}  // namespace Parallel
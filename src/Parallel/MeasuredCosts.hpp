@@ -0,0 +1,108 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <optional>
+
+#include "DataStructures/DataBox/Tag.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Parallel {
+/*!
+ * \ingroup ParallelGroup
+ * \brief The kinds of work whose cost an element of an array component
+ * measures.
+ *
+ * \see Parallel::MeasuredCosts
+ */
+enum class CostCategory {
+  VolumeTerms,
+  BoundaryCorrections,
+  PrimitiveRecovery,
+  Observation
+};
+
+std::ostream& operator<<(std::ostream& os, CostCategory category) noexcept;
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief The wall time an element of an array component spent on each
+ * `Parallel::CostCategory` of work.
+ *
+ * A measurement is started and stopped by the
+ * `Parallel::Actions::StartCostMeasurement` and
+ * `Parallel::Actions::StopCostMeasurement` actions, and the time between them
+ * is added to the cost of the category. Only one measurement can run at a
+ * time. The costs accumulate over the whole run.
+ *
+ * The Charm++ load balancer still uses the CPU time that Charm++ measures for
+ * each element, which includes all work the element does, not only the actions
+ * that are measured here. The measured costs add information on which kinds of
+ * work make an element expensive, and are reported by
+ * `Events::ObserveMeasuredCosts`.
+ */
+class MeasuredCosts {
+ public:
+  static constexpr size_t number_of_categories = 4;
+
+  /// Start measuring the cost of `category` at the wall time `wall_time`
+  void start(CostCategory category, double wall_time) noexcept;
+
+  /// Stop measuring the cost of `category` at the wall time `wall_time`, and
+  /// add the time since the measurement was started to the cost
+  void stop(CostCategory category, double wall_time) noexcept;
+
+  /// Add the time since the current measurement was started or resumed at the
+  /// wall time `wall_time` to its cost, and don't count the time until the
+  /// measurement is resumed.
+  ///
+  /// This excludes work done on behalf of other elements from the cost, e.g.
+  /// the actions that an `[inline]` entry method runs on a receiving element
+  /// that lives on the same processor.
+  void pause(double wall_time) noexcept;
+
+  /// Continue a paused measurement at the wall time `wall_time`
+  void resume(double wall_time) noexcept;
+
+  /// Whether a measurement was started but not yet stopped
+  bool measuring() const noexcept { return current_category_.has_value(); }
+
+  /// The accumulated cost of `category`
+  double cost(CostCategory category) const noexcept;
+
+  /// The accumulated cost of all categories
+  double total() const noexcept;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+
+ private:
+  friend bool operator==(const MeasuredCosts& lhs,
+                         const MeasuredCosts& rhs) noexcept;
+
+  std::array<double, number_of_categories> costs_{};
+  std::optional<CostCategory> current_category_{};
+  double start_time_{0.};
+  bool paused_{false};
+};
+
+bool operator!=(const MeasuredCosts& lhs, const MeasuredCosts& rhs) noexcept;
+
+namespace Tags {
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ParallelGroup
+/// The `Parallel::MeasuredCosts` of an element of an array component.
+struct MeasuredCosts : db::SimpleTag {
+  using type = Parallel::MeasuredCosts;
+};
+}  // namespace Tags
+}  // namespace Parallel
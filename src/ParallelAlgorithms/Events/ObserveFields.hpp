@@ -5,7 +5,6 @@
 
 #include <cstddef>
 #include <functional>
-#include <initializer_list>
 #include <optional>
 #include <pup.h>
 #include <string>
@@ -20,10 +19,12 @@
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
+#include "IO/H5/ComponentStorage.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"  // IWYU pragma: keep
 #include "IO/Observer/VolumeActions.hpp"      // IWYU pragma: keep
+#include "IO/Observer/VolumeDataSchema.hpp"
 #include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
 #include "Options/Auto.hpp"
 #include "Options/Options.hpp"
@@ -35,9 +36,9 @@
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/Tags.hpp"
 #include "Utilities/Algorithm.hpp"
-#include "Utilities/Literals.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeString.hpp"
-#include "Utilities/Numeric.hpp"
 #include "Utilities/Registration.hpp"
 #include "Utilities/StdHelpers.hpp"
 #include "Utilities/TMPL.hpp"
@@ -92,7 +93,8 @@ class ObserveFields;  // IWYU pragma: keep
  *   \f$\text{value} - \text{analytic solution}\f$
  *
  * The user may specify an `interpolation_mesh` to which the
- * data is interpolated.
+ * data is interpolated, and how the data is stored in the file (see
+ * `h5::ComponentStorage`).
  */
 template <size_t VolumeDim, typename ObservationValueTag, typename... Tensors,
           typename... AnalyticSolutionTensors, typename EventRegistrars,
@@ -143,8 +145,16 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
         "on a new mesh.";
   };
 
+  struct Storage {
+    using type = h5::ComponentStorage;
+    static constexpr Options::String help =
+        "How the tensor components are stored in the file. Storing them in "
+        "single precision, compressed, or quantized to a given absolute error "
+        "reduces the size of the file and the time spent writing it.";
+  };
+
   using options =
-      tmpl::list<SubfileName, VariablesToObserve, InterpolateToMesh>;
+      tmpl::list<SubfileName, VariablesToObserve, InterpolateToMesh, Storage>;
   static constexpr Options::String help =
       "Observe volume tensor fields.\n"
       "\n"
@@ -163,11 +173,13 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
   explicit ObserveFields(const std::string& subfile_name,
                          const std::vector<std::string>& variables_to_observe,
                          std::optional<Mesh<VolumeDim>> interpolation_mesh = {},
+                         h5::ComponentStorage storage = {},
                          const Options::Context& context = {})
       : subfile_path_("/" + subfile_name),
         variables_to_observe_(variables_to_observe.begin(),
                               variables_to_observe.end()),
-        interpolation_mesh_(interpolation_mesh) {
+        interpolation_mesh_(interpolation_mesh),
+        storage_(std::move(storage)) {
     using ::operator<<;
     const std::unordered_set<std::string> valid_tensors{
         db::tag_name<Tensors>()...};
@@ -183,6 +195,8 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
       }
     }
     variables_to_observe_.insert(coordinates_tag::name());
+    schema_ = make_schema(variables_to_observe_, false);
+    schema_with_errors_ = make_schema(variables_to_observe_, true);
   }
 
   using argument_tags = tmpl::flatten<tmpl::list<
@@ -205,11 +219,12 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
       Parallel::GlobalCache<Metavariables>& cache,
       const ElementId<VolumeDim>& array_index,
       const ParallelComponent* const component) const noexcept {
-    call_operator_impl(subfile_path_, variables_to_observe_,
-                       interpolation_mesh_, observation_value, mesh,
-                       inertial_coordinates, analytic_solution_tensors...,
-                       non_solution_tensors..., optional_analytic_solutions,
-                       cache, array_index, component);
+    call_operator_impl(subfile_path_, variables_to_observe_, schema_,
+                       schema_with_errors_, interpolation_mesh_, storage_,
+                       observation_value, mesh, inertial_coordinates,
+                       analytic_solution_tensors..., non_solution_tensors...,
+                       optional_analytic_solutions, cache, array_index,
+                       component);
   }
 
   // This overload is called when the list of analytic-solution tensors is
@@ -230,15 +245,56 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
                      component);
   }
 
+  /// The names of the observed tensor components in the order in which they
+  /// are sent to the observer, with or without the errors of the
+  /// `AnalyticSolutionTensors`
+  static observers::VolumeDataSchema make_schema(
+      const std::unordered_set<std::string>& variables_to_observe,
+      const bool with_errors) noexcept {
+    std::vector<std::string> component_names{};
+    const auto record_names = [&component_names, &variables_to_observe](
+                                  const auto tensor_tag_v,
+                                  const bool error) noexcept {
+      using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
+      using TensorType = typename tensor_tag::type;
+      if (variables_to_observe.count(db::tag_name<tensor_tag>()) == 1) {
+        const std::string name =
+            error ? "Error(" + db::tag_name<tensor_tag>() + ")"
+                  : db::tag_name<tensor_tag>();
+        for (size_t i = 0; i < TensorType::size(); ++i) {
+          component_names.push_back(name + TensorType::component_suffix(i));
+        }
+      }
+    };
+    record_names(tmpl::type_<coordinates_tag>{}, false);
+    EXPAND_PACK_LEFT_TO_RIGHT(
+        record_names(tmpl::type_<AnalyticSolutionTensors>{}, false));
+    EXPAND_PACK_LEFT_TO_RIGHT(
+        record_names(tmpl::type_<NonSolutionTensors>{}, false));
+    if (with_errors) {
+      EXPAND_PACK_LEFT_TO_RIGHT(
+          record_names(tmpl::type_<AnalyticSolutionTensors>{}, true));
+    }
+    return observers::VolumeDataSchema{std::move(component_names)};
+  }
+
   // We factor out the work into a static member function so it can  be shared
   // with other field observing events, like the one that deals with DG-subcell
   // where there are two grids. This is to avoid copy-pasting all of the code.
+  //
+  // The `schema` and the `schema_with_errors` are the results of `make_schema`
+  // for the `variables_to_observe`. The names of the tensor components are
+  // registered once with the `observers::ObserverWriter` and only the data is
+  // sent for each element.
   template <typename OptionalAnalyticSolutions, typename Metavariables,
             typename ParallelComponent>
   static void call_operator_impl(
       const std::string& subfile_path,
       const std::unordered_set<std::string>& variables_to_observe,
+      const observers::VolumeDataSchema& schema,
+      const observers::VolumeDataSchema& schema_with_errors,
       const std::optional<Mesh<VolumeDim>>& interpolation_mesh,
+      const h5::ComponentStorage& storage,
       const typename ObservationValueTag::type& observation_value,
       const Mesh<VolumeDim>& mesh,
       const tnsr::I<DataVector, VolumeDim, Frame::Inertial>&
@@ -260,37 +316,45 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
       }
     }();
 
-    const std::string element_name =
-        MakeString{} << ElementId<VolumeDim>(array_index) << '/';
+    const observers::VolumeDataSchema& observed_schema =
+        analytic_solutions.has_value() ? schema_with_errors : schema;
+    const observers::ObservationId observation_id(observation_value,
+                                                  subfile_path + ".vol");
+    // The schema is only registered once per node, later registrations only
+    // compare its id
+    Parallel::local_synchronous_action<
+        observers::Actions::RegisterVolumeDataSchema>(
+        Parallel::get_parallel_component<
+            observers::ObserverWriter<Metavariables>>(cache),
+        observation_id.observation_key(), observed_schema);
 
     // if no interpolation_mesh is provided, the interpolation is essentially
     // ignored by the RegularGridInterpolant except for a single copy.
-    const intrp::RegularGrid interpolant(mesh,
-                                         interpolation_mesh.value_or(mesh));
-
-    // Remove tensor types, only storing individual components.
-    std::vector<TensorComponent> components;
-    // This is larger than we need if we are only observing some
-    // tensors, but that's not a big deal and calculating the correct
-    // size is nontrivial.
-    components.reserve(alg::accumulate(
-        std::initializer_list<size_t>{
-            inertial_coordinates.size(),
-            (analytic_solutions.has_value() ? 2 : 1) *
-                AnalyticSolutionTensors::type::size()...,
-            NonSolutionTensors::type::size()...},
-        0_st));
-
-    const auto record_tensor_components = [&components, &element_name,
-                                           &interpolant, &variables_to_observe](
+    const Mesh<VolumeDim> observed_mesh = interpolation_mesh.value_or(mesh);
+    const intrp::RegularGrid interpolant(mesh, observed_mesh);
+
+    // Remove tensor types, storing the individual components one after the
+    // other in the order of the schema.
+    const size_t number_of_points = observed_mesh.number_of_grid_points();
+    DataVector components(observed_schema.number_of_components() *
+                          number_of_points);
+    size_t offset = 0;
+    const auto record_component = [&components, &interpolant,
+                                   &number_of_points,
+                                   &offset](const DataVector& data) noexcept {
+      DataVector component(components.data() + offset, number_of_points);
+      interpolant.interpolate(make_not_null(&component), data);
+      offset += number_of_points;
+    };
+
+    const auto record_tensor_components = [&record_component,
+                                           &variables_to_observe](
                                               const auto tensor_tag_v,
                                               const auto& tensor) noexcept {
       using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
       if (variables_to_observe.count(db::tag_name<tensor_tag>()) == 1) {
         for (size_t i = 0; i < tensor.size(); ++i) {
-          components.emplace_back(element_name + db::tag_name<tensor_tag>() +
-                                      tensor.component_suffix(i),
-                                  interpolant.interpolate(tensor[i]));
+          record_component(tensor[i]);
         }
       }
     };
@@ -302,20 +366,17 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
         tmpl::type_<NonSolutionTensors>{}, non_solution_tensors));
 
     if (analytic_solutions.has_value()) {
-      const auto record_errors = [&components, &element_name,
-                                  &analytic_solutions, &interpolant,
+      const auto record_errors = [&analytic_solutions, &record_component,
                                   &variables_to_observe](
                                      const auto tensor_tag_v,
                                      const auto& tensor) noexcept {
         using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
         if (variables_to_observe.count(db::tag_name<tensor_tag>()) == 1) {
+          DataVector error{};
           for (size_t i = 0; i < tensor.size(); ++i) {
-            DataVector error = tensor[i] - get<::Tags::Analytic<tensor_tag>>(
-                                               analytic_solutions->get())[i];
-            components.emplace_back(element_name + "Error(" +
-                                        db::tag_name<tensor_tag>() + ")" +
-                                        tensor.component_suffix(i),
-                                    interpolant.interpolate(error));
+            error = tensor[i] - get<::Tags::Analytic<tensor_tag>>(
+                                    analytic_solutions->get())[i];
+            record_component(error);
           }
         }
       };
@@ -324,6 +385,11 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
 
       (void)(record_errors);  // Silence GCC warning about unused variable
     }
+    ASSERT(offset == components.size(),
+           "Recorded " << offset / number_of_points
+                       << " tensor components, but the schema has "
+                       << observed_schema.number_of_components()
+                       << " components: " << observed_schema);
 
     // Send data to volume observer
     auto& local_observer =
@@ -331,15 +397,13 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
              cache)
              .ckLocalBranch();
     Parallel::simple_action<observers::Actions::ContributeVolumeData>(
-        local_observer,
-        observers::ObservationId(observation_value, subfile_path + ".vol"),
-        subfile_path,
+        local_observer, observation_id, subfile_path,
         observers::ArrayComponentId(
             std::add_pointer_t<ParallelComponent>{nullptr},
             Parallel::ArrayIndex<ElementId<VolumeDim>>(array_index)),
-        std::move(components), interpolation_mesh.value_or(mesh).extents(),
-        interpolation_mesh.value_or(mesh).basis(),
-        interpolation_mesh.value_or(mesh).quadrature());
+        std::string(MakeString{} << ElementId<VolumeDim>(array_index)),
+        std::move(components), observed_mesh.extents(), observed_mesh.basis(),
+        observed_mesh.quadrature(), storage);
   }
 
   using observation_registration_tags = tmpl::list<>;
@@ -357,12 +421,18 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
     p | subfile_path_;
     p | variables_to_observe_;
     p | interpolation_mesh_;
+    p | storage_;
+    p | schema_;
+    p | schema_with_errors_;
   }
 
  private:
   std::string subfile_path_;
   std::unordered_set<std::string> variables_to_observe_{};
   std::optional<Mesh<VolumeDim>> interpolation_mesh_{};
+  h5::ComponentStorage storage_{};
+  observers::VolumeDataSchema schema_{};
+  observers::VolumeDataSchema schema_with_errors_{};
 };
 
 /// \cond
@@ -0,0 +1,175 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/TagName.hpp"
+#include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"  // IWYU pragma: keep
+#include "IO/Observer/ReductionActions.hpp"   // IWYU pragma: keep
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/ArrayIndex.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/MeasuredCosts.hpp"
+#include "Parallel/Reduction.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Registration.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/// \cond
+template <typename ObservationValueTag, typename EventRegistrars>
+class ObserveMeasuredCosts;
+/// \endcond
+
+namespace Registrars {
+template <typename ObservationValueTag>
+using ObserveMeasuredCosts =
+    ::Registration::Registrar<Events::ObserveMeasuredCosts,
+                              ObservationValueTag>;
+}  // namespace Registrars
+
+/*!
+ * \brief %Observe the costs the elements measured since the start of the run
+ * (see `Parallel::MeasuredCosts`).
+ *
+ * Writes reduction quantities:
+ * - `ObservationValueTag`
+ * - `NumberOfElements`
+ * - The summed cost of each `Parallel::CostCategory`, e.g. `VolumeTerms`
+ * - `Total` = the summed cost of all categories
+ * - `MaxElementTotal` = the largest total cost of any element
+ *
+ * The costs are the wall times in seconds. They accumulate over the run, so the
+ * difference between two observations is the cost of the work in between. The
+ * ratio of the largest to the average total cost of an element shows how
+ * uneven the work is over the elements.
+ */
+template <typename ObservationValueTag,
+          typename EventRegistrars =
+              tmpl::list<Registrars::ObserveMeasuredCosts<ObservationValueTag>>>
+class ObserveMeasuredCosts : public Event<EventRegistrars> {
+ private:
+  using ReductionData = Parallel::ReductionData<
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      Parallel::ReductionDatum<size_t, funcl::Plus<>>,
+      Parallel::ReductionDatum<std::vector<double>, funcl::VectorPlus>,
+      Parallel::ReductionDatum<double, funcl::Max<>>>;
+
+ public:
+  /// The name of the subfile inside the HDF5 file
+  struct SubfileName {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "The name of the subfile inside the HDF5 file without an extension and "
+        "without a preceding '/'."};
+  };
+
+  /// \cond
+  explicit ObserveMeasuredCosts(CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveMeasuredCosts);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<SubfileName>;
+  static constexpr Options::String help =
+      "Observe the costs the elements measured since the start of the run.\n"
+      "\n"
+      "Writes reduction quantities:\n"
+      " * ObservationValueTag\n"
+      " * NumberOfElements\n"
+      " * The summed cost of each category of work\n"
+      " * Total = the summed cost of all categories\n"
+      " * MaxElementTotal = the largest total cost of any element";
+
+  ObserveMeasuredCosts() = default;
+  explicit ObserveMeasuredCosts(const std::string& subfile_name) noexcept;
+
+  using observed_reduction_data_tags =
+      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+
+  using argument_tags =
+      tmpl::list<ObservationValueTag, Parallel::Tags::MeasuredCosts>;
+
+  template <typename Metavariables, typename ArrayIndex,
+            typename ParallelComponent>
+  void operator()(const typename ObservationValueTag::type& observation_value,
+                  const Parallel::MeasuredCosts& measured_costs,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const ParallelComponent* const /*meta*/) const noexcept {
+    std::vector<std::string> reduction_names{
+        db::tag_name<ObservationValueTag>(), "NumberOfElements"};
+    std::vector<double> costs{};
+    costs.reserve(Parallel::MeasuredCosts::number_of_categories + 1);
+    for (size_t i = 0; i < Parallel::MeasuredCosts::number_of_categories;
+         ++i) {
+      const auto category = static_cast<Parallel::CostCategory>(i);
+      reduction_names.push_back(get_output(category));
+      costs.push_back(measured_costs.cost(category));
+    }
+    reduction_names.emplace_back("Total");
+    reduction_names.emplace_back("MaxElementTotal");
+    const double total_cost = measured_costs.total();
+    costs.push_back(total_cost);
+
+    auto& local_observer =
+        *Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+             cache)
+             .ckLocalBranch();
+    Parallel::simple_action<observers::Actions::ContributeReductionData>(
+        local_observer,
+        observers::ObservationId(observation_value, subfile_path_ + ".dat"),
+        observers::ArrayComponentId{
+            std::add_pointer_t<ParallelComponent>{nullptr},
+            Parallel::ArrayIndex<ArrayIndex>(array_index)},
+        subfile_path_, std::move(reduction_names),
+        ReductionData{static_cast<double>(observation_value), size_t{1},
+                      std::move(costs), total_cost});
+  }
+
+  using observation_registration_tags = tmpl::list<>;
+  std::pair<observers::TypeOfObservation, observers::ObservationKey>
+  get_observation_type_and_key_for_registration() const noexcept {
+    return {observers::TypeOfObservation::Reduction,
+            observers::ObservationKey(subfile_path_ + ".dat")};
+  }
+
+  bool needs_evolved_variables() const noexcept override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    Event<EventRegistrars>::pup(p);
+    p | subfile_path_;
+  }
+
+ private:
+  std::string subfile_path_;
+};
+
+template <typename ObservationValueTag, typename EventRegistrars>
+ObserveMeasuredCosts<ObservationValueTag, EventRegistrars>::
+    ObserveMeasuredCosts(const std::string& subfile_name) noexcept
+    : subfile_path_("/" + subfile_name) {}
+
+/// \cond
+template <typename ObservationValueTag, typename EventRegistrars>
+PUP::able::PUP_ID
+    ObserveMeasuredCosts<ObservationValueTag, EventRegistrars>::my_PUP_ID =
+        0;  // NOLINT
+/// \endcond
+}  // namespace Events
@@ -62,6 +62,9 @@ namespace LinearSolver::cg {
  *
  * \see Gmres for a linear solver that can invert nonsymmetric operators
  * \f$A\f$.
+ *
+ * \see PipelinedConjugateGradient for a variant that overlaps its global
+ * reduction with the operator application.
  */
 template <typename Metavariables, typename FieldsTag, typename OptionsGroup,
           typename SourceTag =
@@ -0,0 +1,111 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "ParallelAlgorithms/LinearSolver/ConjugateGradient/ElementActions.hpp"
+#include "ParallelAlgorithms/LinearSolver/ConjugateGradient/PipelinedElementActions.hpp"
+#include "ParallelAlgorithms/LinearSolver/ConjugateGradient/ResidualMonitor.hpp"
+#include "ParallelAlgorithms/LinearSolver/Observe.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace LinearSolver::cg {
+
+/*!
+ * \ingroup LinearSolverGroup
+ * \brief A pipelined conjugate gradient solver for linear systems of equations
+ * \f$Ax=b\f$ where the operator \f$A\f$ is symmetric.
+ *
+ * \details This solver is mathematically equivalent to the
+ * `LinearSolver::cg::ConjugateGradient`, but it overlaps its global reduction
+ * with the operator application. The standard conjugate gradient algorithm
+ * performs two reductions per iteration whose results are needed before the
+ * elements can continue, so all elements idle for the latency of two global
+ * reductions in every iteration. The pipelined variant by
+ * \cite Ghysels2014 reformulates the algorithm with the additional recurrence
+ * vectors \f$w=A(r)\f$, \f$s=A(p)\f$ and \f$z=A(s)\f$ so that each iteration
+ * needs only the inner products \f$\langle r, r\rangle\f$ and
+ * \f$\langle w, r\rangle\f$. The elements contribute both in a single
+ * reduction and then immediately apply the operator to \f$w\f$ while the
+ * reduction is in flight. Once both the operator application and the reduction
+ * have completed, the elements compute
+ * \f{align*}
+ * \beta_i &= \frac{\langle r_i, r_i\rangle}{\langle r_{i-1}, r_{i-1}\rangle}
+ * \text{,} \quad
+ * \alpha_i = \frac{\langle r_i, r_i\rangle}{\langle w_i, r_i\rangle -
+ * \beta_i \langle r_i, r_i\rangle / \alpha_{i-1}} \\
+ * z_i &= A(w_i) + \beta_i z_{i-1} \text{,} \quad
+ * s_i = w_i + \beta_i s_{i-1} \text{,} \quad
+ * p_i = r_i + \beta_i p_{i-1} \\
+ * x_{i+1} &= x_i + \alpha_i p_i \text{,} \quad
+ * r_{i+1} = r_i - \alpha_i s_i \text{,} \quad
+ * w_{i+1} = w_i - \alpha_i z_i
+ * \f}
+ * with \f$\beta_0=0\f$, start the next reduction and apply the operator again.
+ *
+ * The operand \f$w\f$ that the `ApplyOperatorActions` passed to `solve` must
+ * apply the operator to is
+ * `db::add_tag_prefix<LinearSolver::Tags::Operand, FieldsTag>`, and the result
+ * must be stored in `db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+ * db::add_tag_prefix<LinearSolver::Tags::Operand, FieldsTag>>`, just like for
+ * the `LinearSolver::cg::ConjugateGradient`. Starting the pipeline requires
+ * one additional operator application to compute \f$w_0=A(r_0)\f$. The
+ * `solve` action list applies the operator to the initial residual first and
+ * then runs the actions in the `cg::detail` namespace in this order:
+ * 1. `PerformPipelinedStep` (on elements): Set \f$w_0=A(r_0)\f$, or update the
+ * recurrences above with the inner products that the `ResidualMonitor`
+ * broadcast. Then contribute \f$\langle r, r\rangle\f$ and
+ * \f$\langle w, r\rangle\f$ to a reduction and apply the operator to \f$w\f$
+ * without waiting for the result.
+ * 2. `UpdatePipelinedResidual` (on `ResidualMonitor`): Observe the residual
+ * magnitude, check the `Convergence::Tags::Criteria` and broadcast the inner
+ * products and the convergence state back to the elements.
+ *
+ * Since the residual \f$r\f$ is updated by a recurrence, it can deviate from
+ * the true residual \f$b-Ax\f$ when many iterations are performed, which can
+ * limit the attainable accuracy compared to the
+ * `LinearSolver::cg::ConjugateGradient`. The pipelined variant pays off when
+ * the latency of the global reductions dominates the cost of an iteration,
+ * e.g. for many elements spread over many nodes.
+ *
+ * Preconditioning is not supported, i.e. this is the unpreconditioned variant
+ * of the pipelined conjugate gradient algorithm.
+ */
+template <typename Metavariables, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag =
+              db::add_tag_prefix<::Tags::FixedSource, FieldsTag>>
+struct PipelinedConjugateGradient {
+  using fields_tag = FieldsTag;
+  using options_group = OptionsGroup;
+  using source_tag = SourceTag;
+
+  /// Apply the linear operator to this tag in each iteration
+  using operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Operand, fields_tag>;
+
+  /*!
+   * \brief The parallel components used by the pipelined conjugate gradient
+   * linear solver
+   */
+  using component_list = tmpl::list<
+      detail::ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>;
+
+  using initialize_element =
+      detail::InitializePipelinedElement<FieldsTag, OptionsGroup>;
+
+  using register_element = tmpl::list<>;
+
+  using observed_reduction_data_tags = observers::make_reduction_data_tags<
+      tmpl::list<observe_detail::reduction_data>>;
+
+  template <typename ApplyOperatorActions, typename Label = OptionsGroup>
+  using solve = tmpl::list<
+      detail::PrepareSolve<FieldsTag, OptionsGroup, Label, SourceTag>,
+      ApplyOperatorActions,
+      detail::PerformPipelinedStep<FieldsTag, OptionsGroup, Label, SourceTag>>;
+};
+
+}  // namespace LinearSolver::cg
@@ -0,0 +1,303 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
+#include "NumericalAlgorithms/Convergence/HasConverged.hpp"
+#include "NumericalAlgorithms/Convergence/Tags.hpp"
+#include "NumericalAlgorithms/LinearSolver/InnerProduct.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Reduction.hpp"
+#include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "ParallelAlgorithms/LinearSolver/ConjugateGradient/ResidualMonitorActions.hpp"
+#include "ParallelAlgorithms/LinearSolver/ConjugateGradient/Tags/InboxTags.hpp"
+#include "ParallelAlgorithms/LinearSolver/Tags.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace tuples {
+template <typename...>
+class TaggedTuple;
+}  // namespace tuples
+namespace LinearSolver::cg::detail {
+template <typename Metavariables, typename FieldsTag, typename OptionsGroup>
+struct ResidualMonitor;
+template <typename FieldsTag, typename OptionsGroup, typename Label,
+          typename SourceTag>
+struct PrepareSolve;
+}  // namespace LinearSolver::cg::detail
+/// \endcond
+
+namespace LinearSolver::cg::detail {
+
+namespace Tags {
+/// The search direction \f$p\f$ of the pipelined conjugate gradient algorithm
+template <typename Tag>
+struct SearchDirection : db::PrefixTag, db::SimpleTag {
+  static std::string name() noexcept {
+    // Add "Linear" prefix to abbreviate the namespace for uniqueness
+    return "LinearSearchDirection(" + db::tag_name<Tag>() + ")";
+  }
+  using type = typename Tag::type;
+  using tag = Tag;
+};
+
+/// The step length \f$\alpha\f$ of the previous iteration of the pipelined
+/// conjugate gradient algorithm
+template <typename OptionsGroup>
+struct StepLength : db::SimpleTag {
+  static std::string name() noexcept {
+    return "StepLength(" + Options::name<OptionsGroup>() + ")";
+  }
+  using type = double;
+};
+}  // namespace Tags
+
+template <typename FieldsTag, typename OptionsGroup>
+struct InitializePipelinedElement {
+ private:
+  using fields_tag = FieldsTag;
+  using operator_applied_to_fields_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, fields_tag>;
+  using operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Operand, fields_tag>;
+  using operator_applied_to_operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, operand_tag>;
+  using residual_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>;
+  using search_direction_tag = db::add_tag_prefix<Tags::SearchDirection,
+                                                  fields_tag>;
+  using operator_applied_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         search_direction_tag>;
+  using operator_squared_applied_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         operator_applied_to_search_direction_tag>;
+  using residual_square_tag = LinearSolver::Tags::MagnitudeSquare<residual_tag>;
+
+ public:
+  using simple_tags =
+      tmpl::list<Convergence::Tags::IterationId<OptionsGroup>,
+                 operator_applied_to_fields_tag, operand_tag,
+                 operator_applied_to_operand_tag, residual_tag,
+                 search_direction_tag, operator_applied_to_search_direction_tag,
+                 operator_squared_applied_to_search_direction_tag,
+                 residual_square_tag, Tags::StepLength<OptionsGroup>,
+                 Convergence::Tags::HasConverged<OptionsGroup>>;
+  using compute_tags = tmpl::list<>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTagsList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    // The `PrepareSolve` and `PerformPipelinedStep` actions populate these tags
+    // with initial values, except for `operator_applied_to_fields_tag` which is
+    // expected to be filled at that point and `operator_applied_to_operand_tag`
+    // which is expected to be updated in every iteration of the algorithm.
+    Initialization::mutate_assign<
+        tmpl::list<Convergence::Tags::IterationId<OptionsGroup>,
+                   residual_square_tag, Tags::StepLength<OptionsGroup>>>(
+        make_not_null(&box), std::numeric_limits<size_t>::max(),
+        std::numeric_limits<double>::signaling_NaN(),
+        std::numeric_limits<double>::signaling_NaN());
+    return std::make_tuple(std::move(box));
+  }
+};
+
+/*!
+ * \brief Advance the recurrences of the pipelined conjugate gradient algorithm
+ * once \f$n=A(w)\f$ is available, and start the reduction of the next
+ * iteration's inner products before \f$A(w)\f$ is applied again.
+ *
+ * The first time this action runs after `PrepareSolve` the operator was applied
+ * to the initial residual, so it sets \f$w=A(r)\f$ and starts the pipeline.
+ * This is signaled by the `Tags::InitialHasConverged` broadcast that
+ * `PrepareSolve` triggered.
+ */
+template <typename FieldsTag, typename OptionsGroup, typename Label,
+          typename SourceTag>
+struct PerformPipelinedStep {
+ private:
+  using fields_tag = FieldsTag;
+  using operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Operand, fields_tag>;
+  using operator_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, operand_tag>;
+  using residual_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>;
+  using search_direction_tag = db::add_tag_prefix<Tags::SearchDirection,
+                                                  fields_tag>;
+  using operator_applied_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         search_direction_tag>;
+  using operator_squared_applied_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         operator_applied_to_search_direction_tag>;
+  using residual_square_tag = LinearSolver::Tags::MagnitudeSquare<residual_tag>;
+
+ public:
+  using inbox_tags = tmpl::list<
+      Tags::InitialHasConverged<OptionsGroup>,
+      Tags::PipelinedInnerProductsAndHasConverged<OptionsGroup>>;
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex>
+  static bool is_ready(const db::DataBox<DbTags>& box,
+                       const tuples::TaggedTuple<InboxTags...>& inboxes,
+                       const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                       const ArrayIndex& /*array_index*/) noexcept {
+    const size_t iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    const auto& initial_inbox =
+        get<Tags::InitialHasConverged<OptionsGroup>>(inboxes);
+    const auto& inbox =
+        get<Tags::PipelinedInnerProductsAndHasConverged<OptionsGroup>>(
+            inboxes);
+    return initial_inbox.find(iteration_id) != initial_inbox.end() or
+           inbox.find(iteration_id) != inbox.end();
+  }
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&, bool, size_t> apply(
+      db::DataBox<DbTagsList>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    const size_t iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    auto& initial_inbox =
+        tuples::get<Tags::InitialHasConverged<OptionsGroup>>(inboxes);
+    const auto initial_has_converged = initial_inbox.find(iteration_id);
+    if (initial_has_converged != initial_inbox.end()) {
+      // Start the pipeline: The operator was applied to the initial residual
+      auto has_converged =
+          std::move(initial_inbox.extract(initial_has_converged).mapped());
+      db::mutate<operand_tag, Convergence::Tags::HasConverged<OptionsGroup>>(
+          make_not_null(&box),
+          [&has_converged](const auto operand,
+                           const gsl::not_null<Convergence::HasConverged*>
+                               local_has_converged,
+                           const auto& operator_applied_to_residual) noexcept {
+            *operand = operator_applied_to_residual;
+            *local_has_converged = std::move(has_converged);
+          },
+          get<operator_tag>(box));
+    } else {
+      auto received_data = std::move(
+          tuples::get<Tags::PipelinedInnerProductsAndHasConverged<
+              OptionsGroup>>(inboxes)
+              .extract(iteration_id)
+              .mapped());
+      const double residual_square = get<0>(received_data);
+      const double operand_residual_inner_product = get<1>(received_data);
+      auto& has_converged = get<2>(received_data);
+      db::mutate<Convergence::Tags::HasConverged<OptionsGroup>>(
+          make_not_null(&box),
+          [&has_converged](const gsl::not_null<Convergence::HasConverged*>
+                               local_has_converged) noexcept {
+            *local_has_converged = std::move(has_converged);
+          });
+      // Once the solve has converged the fields already hold the solution
+      if (not get<Convergence::Tags::HasConverged<OptionsGroup>>(box)) {
+        const bool is_first_iteration = iteration_id == 0;
+        const double beta =
+            is_first_iteration
+                ? 0.
+                : residual_square / get<residual_square_tag>(box);
+        const double alpha =
+            residual_square /
+            (is_first_iteration
+                 ? operand_residual_inner_product
+                 : (operand_residual_inner_product -
+                    beta * residual_square /
+                        get<Tags::StepLength<OptionsGroup>>(box)));
+        db::mutate<
+            operator_squared_applied_to_search_direction_tag,
+            operator_applied_to_search_direction_tag, search_direction_tag,
+            fields_tag, residual_tag, operand_tag, residual_square_tag,
+            Tags::StepLength<OptionsGroup>,
+            Convergence::Tags::IterationId<OptionsGroup>>(
+            make_not_null(&box),
+            [is_first_iteration, alpha, beta, residual_square](
+                const auto z, const auto s, const auto p, const auto x,
+                const auto r, const auto w,
+                const gsl::not_null<double*> local_residual_square,
+                const gsl::not_null<double*> step_length,
+                const gsl::not_null<size_t*> local_iteration_id,
+                const auto& n) noexcept {
+              // The recurrences start with z=n, s=w and p=r
+              if (is_first_iteration) {
+                *z = n;
+                *s = *w;
+                *p = *r;
+              } else {
+                *z = n + beta * *z;
+                *s = *w + beta * *s;
+                *p = *r + beta * *p;
+              }
+              *x += alpha * *p;
+              *r -= alpha * *s;
+              *w -= alpha * *z;
+              *local_residual_square = residual_square;
+              *step_length = alpha;
+              ++(*local_iteration_id);
+            },
+            get<operator_tag>(box));
+      }
+    }
+
+    // Terminate the solve once it has converged
+    constexpr size_t this_action_index =
+        tmpl::index_of<ActionList, PerformPipelinedStep>::value;
+    if (get<Convergence::Tags::HasConverged<OptionsGroup>>(box)) {
+      return {std::move(box), false, this_action_index + 1};
+    }
+
+    // Start the reduction of the inner products for the next iteration. We
+    // don't wait for the result but immediately apply the operator to the
+    // updated operand w, so the latency of the reduction is hidden behind the
+    // operator application.
+    const auto& residual = get<residual_tag>(box);
+    Parallel::contribute_to_reduction<UpdatePipelinedResidual<
+        FieldsTag, OptionsGroup, ParallelComponent>>(
+        Parallel::ReductionData<
+            Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+            Parallel::ReductionDatum<double, funcl::Plus<>>,
+            Parallel::ReductionDatum<double, funcl::Plus<>>>{
+            get<Convergence::Tags::IterationId<OptionsGroup>>(box),
+            inner_product(residual, residual),
+            inner_product(get<operand_tag>(box), residual)},
+        Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
+        Parallel::get_parallel_component<
+            ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
+
+    constexpr size_t apply_operator_index =
+        tmpl::index_of<ActionList, PrepareSolve<FieldsTag, OptionsGroup, Label,
+                                                SourceTag>>::value +
+        1;
+    return {std::move(box), false, apply_operator_index};
+  }
+};
+
+}  // namespace LinearSolver::cg::detail
@@ -188,4 +188,83 @@ struct UpdateResidual {
   }
 };
 
+/*!
+ * \brief Receive the inner products \f$\langle r_i, r_i\rangle\f$ and
+ * \f$\langle w_i, r_i\rangle\f$ of the pipelined conjugate gradient
+ * algorithm, check convergence and broadcast them back to the elements.
+ *
+ * The elements compute the coefficients \f$\alpha_i\f$ and \f$\beta_i\f$
+ * from the broadcast inner products themselves. The residual of iteration 0 is
+ * handled by `InitializeResidual`, so the broadcast for iteration 0 only
+ * carries the inner products.
+ */
+template <typename FieldsTag, typename OptionsGroup, typename BroadcastTarget>
+struct UpdatePipelinedResidual {
+ private:
+  using fields_tag = FieldsTag;
+  using residual_square_tag = LinearSolver::Tags::MagnitudeSquare<
+      db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>;
+  using initial_residual_magnitude_tag =
+      ::Tags::Initial<LinearSolver::Tags::Magnitude<
+          db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>>;
+
+ public:
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex,
+            typename DataBox = db::DataBox<DbTagsList>,
+            Requires<db::tag_is_retrievable_v<residual_square_tag, DataBox>> =
+                nullptr>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const size_t iteration_id, const double residual_square,
+                    const double operand_residual_inner_product) noexcept {
+    Convergence::HasConverged has_converged{};
+    if (iteration_id > 0) {
+      db::mutate<residual_square_tag>(
+          make_not_null(&box),
+          [residual_square](
+              const gsl::not_null<double*> local_residual_square) noexcept {
+            *local_residual_square = residual_square;
+          });
+
+      // At this point, the iteration is complete. We proceed with observing,
+      // logging and checking convergence before broadcasting back to the
+      // elements.
+
+      const double residual_magnitude = sqrt(residual_square);
+      LinearSolver::observe_detail::contribute_to_reduction_observer<
+          OptionsGroup, ParallelComponent>(iteration_id, residual_magnitude,
+                                           cache);
+
+      // Determine whether the linear solver has converged
+      has_converged = Convergence::HasConverged{
+          get<Convergence::Tags::Criteria<OptionsGroup>>(box), iteration_id,
+          residual_magnitude, get<initial_residual_magnitude_tag>(box)};
+
+      // Do some logging
+      if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
+                   ::Verbosity::Quiet)) {
+        Parallel::printf(
+            "%s(%zu) iteration complete. Remaining residual: %e\n",
+            Options::name<OptionsGroup>(), iteration_id, residual_magnitude);
+      }
+      if (UNLIKELY(has_converged and
+                   get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
+                       ::Verbosity::Quiet)) {
+        Parallel::printf(
+            "%s has converged in %zu iterations: %s\n",
+            Options::name<OptionsGroup>(), iteration_id, has_converged);
+      }
+    }
+
+    Parallel::receive_data<
+        Tags::PipelinedInnerProductsAndHasConverged<OptionsGroup>>(
+        Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
+        std::make_tuple(residual_square, operand_residual_inner_product,
+                        // NOLINTNEXTLINE(performance-move-const-arg)
+                        std::move(has_converged)));
+  }
+};
+
 }  // namespace LinearSolver::cg::detail
@@ -7,6 +7,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -41,6 +42,42 @@ struct NormalizeOperandAndUpdateField;
 
 namespace LinearSolver::gmres::detail {
 
+/*!
+ * \brief Reduce the inner products of the `operand` with all vectors in the
+ * `basis_history`, followed by the inner product of the `operand` with itself,
+ * to the `StoreOrthogonalization` action on the `ResidualMonitor`
+ *
+ * All inner products are batched in a single reduction, so an orthogonalization
+ * pass over the full Krylov basis costs one global synchronization regardless
+ * of the number of iterations (classical Gram-Schmidt).
+ */
+template <typename FieldsTag, typename OptionsGroup, typename ParallelComponent,
+          typename BasisHistory, typename Operand, typename Metavariables,
+          typename ArrayIndex>
+void contribute_orthogonalizations(
+    const size_t iteration_id, const size_t orthogonalization_iteration_id,
+    const BasisHistory& basis_history, const Operand& operand,
+    Parallel::GlobalCache<Metavariables>& cache,
+    const ArrayIndex& array_index) noexcept {
+  std::vector<double> local_orthogonalizations(basis_history.size() + 1);
+  for (size_t i = 0; i < basis_history.size(); ++i) {
+    local_orthogonalizations[i] =
+        inner_product(gsl::at(basis_history, i), operand);
+  }
+  local_orthogonalizations.back() = inner_product(operand, operand);
+  Parallel::contribute_to_reduction<
+      StoreOrthogonalization<FieldsTag, OptionsGroup, ParallelComponent>>(
+      Parallel::ReductionData<
+          Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+          Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+          Parallel::ReductionDatum<std::vector<double>, funcl::VectorPlus>>{
+          iteration_id, orthogonalization_iteration_id,
+          std::move(local_orthogonalizations)},
+      Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
+      Parallel::get_parallel_component<
+          ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
+}
+
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
           typename Label, typename SourceTag>
 struct PrepareSolve {
@@ -262,19 +299,11 @@ struct PerformStep {
         },
         get<operator_tag>(box));
 
-    Parallel::contribute_to_reduction<
-        StoreOrthogonalization<FieldsTag, OptionsGroup, ParallelComponent>>(
-        Parallel::ReductionData<
-            Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
-            Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
-            Parallel::ReductionDatum<double, funcl::Plus<>>>{
-            get<Convergence::Tags::IterationId<OptionsGroup>>(box),
-            get<orthogonalization_iteration_id_tag>(box),
-            inner_product(get<basis_history_tag>(box)[0],
-                          get<operand_tag>(box))},
-        Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
-        Parallel::get_parallel_component<
-            ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
+    contribute_orthogonalizations<FieldsTag, OptionsGroup, ParallelComponent>(
+        get<Convergence::Tags::IterationId<OptionsGroup>>(box),
+        get<orthogonalization_iteration_id_tag>(box),
+        get<basis_history_tag>(box), get<operand_tag>(box), cache,
+        array_index);
 
     return {std::move(box)};
   }
@@ -294,7 +323,8 @@ struct OrthogonalizeOperand {
       LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
 
  public:
-  using inbox_tags = tmpl::list<Tags::Orthogonalization<OptionsGroup>>;
+  using inbox_tags = tmpl::list<Tags::Orthogonalization<OptionsGroup>,
+                                Tags::FinalOrthogonalization<OptionsGroup>>;
 
   template <typename DbTags, typename... InboxTags, typename Metavariables,
             typename ArrayIndex>
@@ -302,9 +332,13 @@ struct OrthogonalizeOperand {
                        const tuples::TaggedTuple<InboxTags...>& inboxes,
                        const Parallel::GlobalCache<Metavariables>& /*cache*/,
                        const ArrayIndex& /*array_index*/) noexcept {
+    const auto& iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box);
     const auto& inbox = get<Tags::Orthogonalization<OptionsGroup>>(inboxes);
-    return inbox.find(db::get<Convergence::Tags::IterationId<OptionsGroup>>(
-               box)) != inbox.end();
+    const auto& final_inbox =
+        get<Tags::FinalOrthogonalization<OptionsGroup>>(inboxes);
+    return inbox.find(iteration_id) != inbox.end() or
+           final_inbox.find(iteration_id) != final_inbox.end();
   }
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -315,54 +349,41 @@ struct OrthogonalizeOperand {
       Parallel::GlobalCache<Metavariables>& cache,
       const ArrayIndex& array_index, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) noexcept {
-    const double orthogonalization = std::move(
-        tuples::get<Tags::Orthogonalization<OptionsGroup>>(inboxes)
-            .extract(db::get<Convergence::Tags::IterationId<OptionsGroup>>(box))
-            .mapped());
+    constexpr size_t this_action_index =
+        tmpl::index_of<ActionList, OrthogonalizeOperand>::value;
+    const auto& iteration_id =
+        get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    auto& inbox = tuples::get<Tags::Orthogonalization<OptionsGroup>>(inboxes);
+    // The residual monitor has determined that the orthogonalization is
+    // complete, so the final orthogonalization is applied in the next action
+    if (inbox.find(iteration_id) == inbox.end()) {
+      return {std::move(box), false, this_action_index + 1};
+    }
 
+    // The residual monitor has requested another pass over the Krylov basis
+    // to restore orthogonality lost to cancellation
+    const auto orthogonalizations =
+        std::move(inbox.extract(iteration_id).mapped());
     db::mutate<operand_tag, orthogonalization_iteration_id_tag>(
         make_not_null(&box),
-        [orthogonalization](
+        [&orthogonalizations](
             const auto operand,
             const gsl::not_null<size_t*> orthogonalization_iteration_id,
             const auto& basis_history) noexcept {
-          *operand -= orthogonalization *
-                      gsl::at(basis_history, *orthogonalization_iteration_id);
+          for (size_t i = 0; i < orthogonalizations.size(); ++i) {
+            *operand -= orthogonalizations[i] * gsl::at(basis_history, i);
+          }
           ++(*orthogonalization_iteration_id);
         },
         get<basis_history_tag>(box));
 
-    const auto& next_orthogonalization_iteration_id =
-        get<orthogonalization_iteration_id_tag>(box);
-    const auto& iteration_id =
-        get<Convergence::Tags::IterationId<OptionsGroup>>(box);
-    const bool orthogonalization_complete =
-        next_orthogonalization_iteration_id == iteration_id + 1;
-    const double local_orthogonalization =
-        inner_product(orthogonalization_complete
-                          ? get<operand_tag>(box)
-                          : gsl::at(get<basis_history_tag>(box),
-                                    next_orthogonalization_iteration_id),
-                      get<operand_tag>(box));
-
-    Parallel::contribute_to_reduction<
-        StoreOrthogonalization<FieldsTag, OptionsGroup, ParallelComponent>>(
-        Parallel::ReductionData<
-            Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
-            Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
-            Parallel::ReductionDatum<double, funcl::Plus<>>>{
-            iteration_id, next_orthogonalization_iteration_id,
-            local_orthogonalization},
-        Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
-        Parallel::get_parallel_component<
-            ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
+    contribute_orthogonalizations<FieldsTag, OptionsGroup, ParallelComponent>(
+        iteration_id, get<orthogonalization_iteration_id_tag>(box),
+        get<basis_history_tag>(box), get<operand_tag>(box), cache,
+        array_index);
 
     // Repeat this action until orthogonalization is complete
-    constexpr size_t this_action_index =
-        tmpl::index_of<ActionList, OrthogonalizeOperand>::value;
-    return {std::move(box), false,
-            orthogonalization_complete ? (this_action_index + 1)
-                                       : this_action_index};
+    return {std::move(box), false, this_action_index};
   }
 };
 
@@ -410,20 +431,26 @@ struct NormalizeOperandAndUpdateField {
         tuples::get<Tags::FinalOrthogonalization<OptionsGroup>>(inboxes)
             .extract(db::get<Convergence::Tags::IterationId<OptionsGroup>>(box))
             .mapped());
-    const double normalization = get<0>(received_data);
-    const auto& minres = get<1>(received_data);
-    auto& has_converged = get<2>(received_data);
+    const auto& orthogonalizations = get<0>(received_data);
+    const double normalization = get<1>(received_data);
+    const auto& minres = get<2>(received_data);
+    auto& has_converged = get<3>(received_data);
 
     db::mutate<operand_tag, basis_history_tag, fields_tag,
                Convergence::Tags::IterationId<OptionsGroup>,
                Convergence::Tags::HasConverged<OptionsGroup>>(
         make_not_null(&box),
-        [normalization, &minres, &has_converged](
+        [&orthogonalizations, normalization, &minres, &has_converged](
             const auto operand, const auto basis_history, const auto field,
             const gsl::not_null<size_t*> iteration_id,
             const gsl::not_null<Convergence::HasConverged*> local_has_converged,
             const auto& initial_field,
             const auto& preconditioned_basis_history) noexcept {
+          // Complete the orthogonalization of the operand against the Krylov
+          // basis with the projections of the last pass
+          for (size_t i = 0; i < orthogonalizations.size(); ++i) {
+            *operand -= orthogonalizations[i] * gsl::at(*basis_history, i);
+          }
           // Avoid an FPE if the new operand norm is exactly zero. In that case
           // the problem is solved and the algorithm will terminate (see
           // Proposition 9.3 in \cite Saad2003). Since there will be no next
@@ -55,27 +55,38 @@ namespace LinearSolver::gmres {
  * will converge the field \f$x\f$ towards the solution and update the operand
  * \f$q\f$ in the process. This requires reductions over all elements that are
  * received by a `ResidualMonitor` singleton parallel component, processed, and
- * then broadcast back to all elements. Since the reductions are performed to
- * find a vector that is orthogonal to those used in previous steps, the number
- * of reductions increases linearly with iterations. No restarting mechanism is
- * currently implemented. The actions are implemented in the `gmres::detail`
- * namespace and constitute the full algorithm in the following order:
+ * then broadcast back to all elements. To keep the number of global
+ * synchronizations independent of the number of iterations, the Arnoldi
+ * orthogonalization is performed with classical Gram-Schmidt: all inner
+ * products with the previously determined orthogonal vectors are batched in a
+ * single reduction, and the magnitude of the orthogonalized vector follows from
+ * the Pythagorean theorem. When this procedure cancels most of \f$A(q)\f$ and
+ * thus risks losing orthogonality, a second pass is performed
+ * (\cite Daniel1976). Each iteration therefore requires one or two reductions.
+ * These reductions are not overlapped with the operator application: the
+ * elements wait for the result of the orthogonalization before they apply the
+ * operator again, so every iteration still pays the latency of at least one
+ * global reduction. No restarting mechanism is currently implemented. The
+ * actions are implemented in the `gmres::detail` namespace and constitute the
+ * full algorithm in the following order:
  * 1. `PerformStep` (on elements): Start an Arnoldi orthogonalization by
- * computing the inner product between \f$A(q)\f$ and the first of the
- * previously determined set of orthogonal vectors.
+ * computing the inner products between \f$A(q)\f$ and all of the previously
+ * determined set of orthogonal vectors, as well as the magnitude of
+ * \f$A(q)\f$, and reduce.
  * 2. `StoreOrthogonalization` (on `ResidualMonitor`): Keep track of the
- * computed inner product in a Hessenberg matrix, then broadcast.
- * 3. `OrthogonalizeOperand` (on elements): Proceed with the Arnoldi
- * orthogonalization by computing inner products and reducing to
- * `StoreOrthogonalization` on the `ResidualMonitor` until the new orthogonal
- * vector is constructed. Then compute its magnitude and reduce.
+ * computed inner products in a Hessenberg matrix. If the orthogonalization
+ * must be repeated, broadcast the inner products to `OrthogonalizeOperand`.
+ * 3. `OrthogonalizeOperand` (on elements): Project out the previously
+ * determined orthogonal vectors and repeat the reduction to
+ * `StoreOrthogonalization`. Skipped when the orthogonalization is complete.
  * 4. `StoreOrthogonalization` (on `ResidualMonitor`): Perform a QR
  * decomposition of the Hessenberg matrix to produce a residual vector.
  * Broadcast to `NormalizeOperandAndUpdateField` along with a termination
  * flag if the `Convergence::Tags::Criteria` are met.
- * 5. `NormalizeOperandAndUpdateField` (on elements): Set the operand \f$q\f$ as
- * the new orthogonal vector and normalize. Use the residual vector and the set
- * of orthogonal vectors to determine the solution \f$x\f$.
+ * 5. `NormalizeOperandAndUpdateField` (on elements): Complete the
+ * orthogonalization to set the operand \f$q\f$ as the new orthogonal vector
+ * and normalize. Use the residual vector and the set of orthogonal vectors to
+ * determine the solution \f$x\f$.
  *
  * \see ConjugateGradient for a linear solver that is more efficient when the
  * linear operator \f$A\f$ is symmetric.
@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -20,7 +23,9 @@
 #include "ParallelAlgorithms/LinearSolver/Gmres/Tags/InboxTags.hpp"
 #include "ParallelAlgorithms/LinearSolver/Observe.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 
@@ -111,8 +116,16 @@ struct StoreOrthogonalization {
                     const ArrayIndex& /*array_index*/,
                     const size_t iteration_id,
                     const size_t orthogonalization_iteration_id,
-                    const double orthogonalization) noexcept {
-    if (UNLIKELY(orthogonalization_iteration_id == 0)) {
+                    std::vector<double> orthogonalizations) noexcept {
+    ASSERT(orthogonalizations.size() == iteration_id + 2,
+           "Expected the inner products of the operand with all "
+               << iteration_id + 1
+               << " basis vectors and with itself, but received "
+               << orthogonalizations.size() << " values.");
+    const double operand_magnitude_square = orthogonalizations.back();
+    orthogonalizations.pop_back();
+
+    if (orthogonalization_iteration_id == 0) {
       // Append a row and a column to the orthogonalization history. Zero the
       // entries that won't be set during the orthogonalization procedure below.
       db::mutate<orthogonalization_history_tag>(
@@ -120,45 +133,57 @@ struct StoreOrthogonalization {
           [iteration_id](const auto orthogonalization_history) noexcept {
             orthogonalization_history->resize(iteration_id + 2,
                                               iteration_id + 1);
-            for (size_t j = 0; j < orthogonalization_history->columns() - 1;
-                 ++j) {
+            for (size_t j = 0; j < orthogonalization_history->columns(); ++j) {
               (*orthogonalization_history)(
                   orthogonalization_history->rows() - 1, j) = 0.;
             }
+            for (size_t i = 0; i <= iteration_id; ++i) {
+              (*orthogonalization_history)(i, iteration_id) = 0.;
+            }
           });
     }
 
-    // While the orthogonalization procedure is not complete, store the
-    // orthogonalization, broadcast it back to all elements and return early
-    if (orthogonalization_iteration_id <= iteration_id) {
-      db::mutate<orthogonalization_history_tag>(
-          make_not_null(&box),
-          [orthogonalization, iteration_id, orthogonalization_iteration_id](
-              const auto orthogonalization_history) noexcept {
-            (*orthogonalization_history)(orthogonalization_iteration_id,
-                                         iteration_id) = orthogonalization;
-          });
+    // Accumulate the projections of this pass over the Krylov basis. The
+    // magnitude of the orthogonalized operand follows from the Pythagorean
+    // theorem, so it needs no additional reduction.
+    double remaining_magnitude_square = operand_magnitude_square;
+    db::mutate<orthogonalization_history_tag>(
+        make_not_null(&box),
+        [&orthogonalizations, &remaining_magnitude_square,
+         iteration_id](const auto orthogonalization_history) noexcept {
+          for (size_t i = 0; i < orthogonalizations.size(); ++i) {
+            (*orthogonalization_history)(i, iteration_id) +=
+                orthogonalizations[i];
+            remaining_magnitude_square -= square(orthogonalizations[i]);
+          }
+        });
 
+    // Classical Gram-Schmidt loses orthogonality when the projections cancel
+    // most of the operand. In that case, broadcast the projections and
+    // orthogonalize the result once more ("twice is enough", see the DGKS
+    // criterion in \cite Daniel1976). Otherwise, the orthogonalization is
+    // complete.
+    if (orthogonalization_iteration_id == 0 and
+        remaining_magnitude_square < 0.5 * operand_magnitude_square) {
       Parallel::receive_data<Tags::Orthogonalization<OptionsGroup>>(
           Parallel::get_parallel_component<BroadcastTarget>(cache),
-          iteration_id, orthogonalization);
+          iteration_id, std::move(orthogonalizations));
       return;
     }
-
-    // At this point, the orthogonalization procedure is complete.
+    const double normalization = sqrt(std::max(remaining_magnitude_square, 0.));
     db::mutate<orthogonalization_history_tag>(
         make_not_null(&box),
-        [orthogonalization, iteration_id, orthogonalization_iteration_id](
-            const auto orthogonalization_history) noexcept {
-          (*orthogonalization_history)(orthogonalization_iteration_id,
-                                       iteration_id) = sqrt(orthogonalization);
+        [normalization,
+         iteration_id](const auto orthogonalization_history) noexcept {
+          (*orthogonalization_history)(iteration_id + 1, iteration_id) =
+              normalization;
         });
 
     // Perform a QR decomposition of the Hessenberg matrix that was built during
     // the orthogonalization
     const auto& orthogonalization_history =
         get<orthogonalization_history_tag>(box);
-    const auto num_rows = orthogonalization_iteration_id + 1;
+    const auto num_rows = iteration_id + 2;
     DenseMatrix<double> qr_Q;
     DenseMatrix<double> qr_R;
     blaze::qr(orthogonalization_history, qr_Q, qr_R);
@@ -200,7 +225,8 @@ struct StoreOrthogonalization {
 
     Parallel::receive_data<Tags::FinalOrthogonalization<OptionsGroup>>(
         Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
-        std::make_tuple(sqrt(orthogonalization), std::move(minres),
+        std::make_tuple(std::move(orthogonalizations), normalization,
+                        std::move(minres),
                         // NOLINTNEXTLINE(performance-move-const-arg)
                         std::move(has_converged)));
   }
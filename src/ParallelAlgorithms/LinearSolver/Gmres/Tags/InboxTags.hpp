@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <map>
 #include <tuple>
+#include <vector>
 
 #include "DataStructures/DenseVector.hpp"
 #include "NumericalAlgorithms/Convergence/HasConverged.hpp"
@@ -26,15 +27,17 @@ template <typename OptionsGroup>
 struct Orthogonalization
     : Parallel::InboxInserters::Value<Orthogonalization<OptionsGroup>> {
   using temporal_id = size_t;
-  using type = std::map<temporal_id, double>;
+  using type = std::map<temporal_id, std::vector<double>>;
 };
 
 template <typename OptionsGroup>
 struct FinalOrthogonalization
     : Parallel::InboxInserters::Value<FinalOrthogonalization<OptionsGroup>> {
   using temporal_id = size_t;
-  using type = std::map<temporal_id, std::tuple<double, DenseVector<double>,
-                                                Convergence::HasConverged>>;
+  using type =
+      std::map<temporal_id,
+               std::tuple<std::vector<double>, double, DenseVector<double>,
+                          Convergence::HasConverged>>;
 };
 
 }  // namespace LinearSolver::gmres::detail::Tags
@@ -0,0 +1,212 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3D.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <vector>
+
+#include "DataStructures/BoostMultiArray.hpp"  // IWYU pragma: keep
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/StellarCollapseEos.hpp"
+#include "Utilities/ContainerHelpers.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+// IWYU pragma: no_include <boost/multi_array.hpp>
+
+namespace EquationsOfState {
+Tabulated3D::Tabulated3D(const h5::StellarCollapseEos& table) noexcept
+    : energy_shift_(table.get_scalar_dataset<double>("energy_shift")) {
+  const std::array<std::string, 3> coordinate_names{
+      {"logrho", "logtemp", "ye"}};
+  for (size_t d = 0; d < 3; ++d) {
+    const std::vector<double> coordinates =
+        table.get_rank1_dataset(gsl::at(coordinate_names, d));
+    const size_t number_of_points = coordinates.size();
+    if (number_of_points < 2) {
+      ERROR("The table needs at least two points in '"
+            << gsl::at(coordinate_names, d) << "', not " << number_of_points);
+    }
+    const double spacing = (coordinates.back() - coordinates.front()) /
+                           static_cast<double>(number_of_points - 1);
+    for (size_t i = 0; i < number_of_points; ++i) {
+      if (std::abs(coordinates[i] - coordinates.front() -
+                   static_cast<double>(i) * spacing) > 1.e-8 * spacing) {
+        ERROR("The table must be uniformly spaced in '"
+              << gsl::at(coordinate_names, d) << "', but point " << i
+              << " is at " << coordinates[i] << " instead of "
+              << coordinates.front() + static_cast<double>(i) * spacing);
+      }
+    }
+    gsl::at(number_of_points_, d) = number_of_points;
+    gsl::at(lower_coordinates_, d) = coordinates.front();
+    gsl::at(inverse_spacings_, d) = 1.0 / spacing;
+  }
+
+  // The rank-3 datasets are indexed as [ye][temp][rho]
+  const std::array<std::string, number_of_quantities> quantity_names{
+      {"logpress", "logenergy", "cs2"}};
+  table_.resize(number_of_quantities * number_of_points_[0] *
+                number_of_points_[1] * number_of_points_[2]);
+  for (size_t q = 0; q < number_of_quantities; ++q) {
+    const boost::multi_array<double, 3> quantity =
+        table.get_rank3_dataset(gsl::at(quantity_names, q));
+    if (quantity.shape()[0] != number_of_points_[2] or
+        quantity.shape()[1] != number_of_points_[1] or
+        quantity.shape()[2] != number_of_points_[0]) {
+      ERROR("The dataset '" << gsl::at(quantity_names, q) << "' has extents ("
+                            << quantity.shape()[0] << ","
+                            << quantity.shape()[1] << ","
+                            << quantity.shape()[2]
+                            << ") but the coordinates require ("
+                            << number_of_points_[2] << ","
+                            << number_of_points_[1] << ","
+                            << number_of_points_[0] << ")");
+    }
+    size_t grid_point = 0;
+    for (size_t k = 0; k < number_of_points_[2]; ++k) {
+      for (size_t j = 0; j < number_of_points_[1]; ++j) {
+        for (size_t i = 0; i < number_of_points_[0]; ++i, ++grid_point) {
+          table_[grid_point * number_of_quantities + q] = quantity[k][j][i];
+        }
+      }
+    }
+  }
+}
+
+Tabulated3D::Tabulated3D(const std::string& filename,
+                         const std::string& subgroup) noexcept
+    : Tabulated3D(h5::H5File<h5::AccessType::ReadOnly>{filename}
+                      .get<h5::StellarCollapseEos>(subgroup)) {}
+
+template <typename DataType>
+void Tabulated3D::pressure_energy_and_sound_speed_squared(
+    const gsl::not_null<Scalar<DataType>*> pressure,
+    const gsl::not_null<Scalar<DataType>*> specific_internal_energy,
+    const gsl::not_null<Scalar<DataType>*> sound_speed_squared,
+    const Scalar<DataType>& rest_mass_density,
+    const Scalar<DataType>& temperature,
+    const Scalar<DataType>& electron_fraction) const noexcept {
+  const size_t number_of_grid_points = get_size(get(rest_mass_density));
+  destructive_resize_components(pressure, number_of_grid_points);
+  destructive_resize_components(specific_internal_energy,
+                                number_of_grid_points);
+  destructive_resize_components(sound_speed_squared, number_of_grid_points);
+
+  // Offsets in table_ between neighboring grid points in each dimension
+  const std::array<size_t, 3> strides{
+      {number_of_quantities, number_of_quantities * number_of_points_[0],
+       number_of_quantities * number_of_points_[0] * number_of_points_[1]}};
+
+  for (size_t s = 0; s < number_of_grid_points; ++s) {
+    ASSERT(get_element(get(rest_mass_density), s) > 0.0 and
+               get_element(get(temperature), s) > 0.0,
+           "The rest mass density and the temperature must be positive, not "
+               << get_element(get(rest_mass_density), s) << " and "
+               << get_element(get(temperature), s));
+    const std::array<double, 3> coordinates{
+        {log10(get_element(get(rest_mass_density), s)),
+         log10(get_element(get(temperature), s)),
+         get_element(get(electron_fraction), s)}};
+    // Locate the cell containing the point directly from the uniform grid
+    size_t offset = 0;
+    std::array<double, 3> weights{};
+    for (size_t d = 0; d < 3; ++d) {
+      const double x = std::clamp(
+          (gsl::at(coordinates, d) - gsl::at(lower_coordinates_, d)) *
+              gsl::at(inverse_spacings_, d),
+          0.0, static_cast<double>(gsl::at(number_of_points_, d) - 1));
+      const size_t index =
+          std::min(static_cast<size_t>(x), gsl::at(number_of_points_, d) - 2);
+      gsl::at(weights, d) = x - static_cast<double>(index);
+      offset += index * gsl::at(strides, d);
+    }
+
+    std::array<double, number_of_quantities> result{};
+    for (size_t corner = 0; corner < 8; ++corner) {
+      double weight = 1.0;
+      size_t corner_offset = offset;
+      for (size_t d = 0; d < 3; ++d) {
+        if ((corner >> d) & 1) {
+          weight *= gsl::at(weights, d);
+          corner_offset += gsl::at(strides, d);
+        } else {
+          weight *= 1.0 - gsl::at(weights, d);
+        }
+      }
+      for (size_t q = 0; q < number_of_quantities; ++q) {
+        gsl::at(result, q) += weight * table_[corner_offset + q];
+      }
+    }
+
+    get_element(get(*pressure), s) = pow(10.0, result[0]);
+    get_element(get(*specific_internal_energy), s) =
+        pow(10.0, result[1]) - energy_shift_;
+    get_element(get(*sound_speed_squared), s) = result[2];
+  }
+}
+
+std::array<double, 3> Tabulated3D::lower_bounds() const noexcept {
+  return {{pow(10.0, lower_coordinates_[0]), pow(10.0, lower_coordinates_[1]),
+           lower_coordinates_[2]}};
+}
+
+std::array<double, 3> Tabulated3D::upper_bounds() const noexcept {
+  std::array<double, 3> upper_coordinates{};
+  for (size_t d = 0; d < 3; ++d) {
+    gsl::at(upper_coordinates, d) =
+        gsl::at(lower_coordinates_, d) +
+        static_cast<double>(gsl::at(number_of_points_, d) - 1) /
+            gsl::at(inverse_spacings_, d);
+  }
+  return {{pow(10.0, upper_coordinates[0]), pow(10.0, upper_coordinates[1]),
+           upper_coordinates[2]}};
+}
+
+void Tabulated3D::pup(PUP::er& p) noexcept {
+  p | number_of_points_;
+  p | lower_coordinates_;
+  p | inverse_spacings_;
+  p | energy_shift_;
+  p | table_;
+}
+
+bool operator==(const Tabulated3D& lhs, const Tabulated3D& rhs) noexcept {
+  return lhs.number_of_points_ == rhs.number_of_points_ and
+         lhs.lower_coordinates_ == rhs.lower_coordinates_ and
+         lhs.inverse_spacings_ == rhs.inverse_spacings_ and
+         lhs.energy_shift_ == rhs.energy_shift_ and lhs.table_ == rhs.table_;
+}
+
+bool operator!=(const Tabulated3D& lhs, const Tabulated3D& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+#define DTYPE(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                                \
+  template void Tabulated3D::pressure_energy_and_sound_speed_squared(         \
+      const gsl::not_null<Scalar<DTYPE(data)>*> pressure,                     \
+      const gsl::not_null<Scalar<DTYPE(data)>*> specific_internal_energy,     \
+      const gsl::not_null<Scalar<DTYPE(data)>*> sound_speed_squared,          \
+      const Scalar<DTYPE(data)>& rest_mass_density,                           \
+      const Scalar<DTYPE(data)>& temperature,                                 \
+      const Scalar<DTYPE(data)>& electron_fraction) const noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (double, DataVector))
+
+#undef INSTANTIATION
+#undef DTYPE
+}  // namespace EquationsOfState
@@ -0,0 +1,166 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Options/Options.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+namespace h5 {
+class StellarCollapseEos;
+}  // namespace h5
+/// \endcond
+
+namespace EquationsOfState {
+/*!
+ * \ingroup EquationsOfStateGroup
+ * \brief A nuclear equation of state tabulated in the rest mass density
+ * \f$\rho\f$, the temperature \f$T\f$, and the electron fraction \f$Y_e\f$.
+ *
+ * The table is read with `h5::StellarCollapseEos` from a file in the format of
+ * [stellarcollapse.org](https://stellarcollapse.org).  The grid of the table
+ * must be uniform in \f$\log_{10}\rho\f$, \f$\log_{10}T\f$, and \f$Y_e\f$, so
+ * that the cell containing a point is found with one multiplication per
+ * dimension instead of a search.  The pressure and the specific internal
+ * energy are trilinearly interpolated in \f$\log_{10}\f$ space, and the sound
+ * speed squared is trilinearly interpolated directly.  Points outside the
+ * table are clamped to its boundary.
+ *
+ * All interpolated quantities at a grid point are stored next to each other,
+ * so that interpolating all of them at one point reads eight short contiguous
+ * runs of memory.  `pressure_energy_and_sound_speed_squared` evaluates all
+ * quantities for all points of a `DataVector` in a single call.
+ *
+ * No unit conversion is done, so all quantities are in the units of the table:
+ * \f$\rho\f$ in \f$\mathrm{g}/\mathrm{cm}^3\f$, \f$T\f$ in MeV, the pressure
+ * in \f$\mathrm{dyn}/\mathrm{cm}^2\f$, the specific internal energy in
+ * \f$\mathrm{erg}/\mathrm{g}\f$, and the sound speed squared in
+ * \f$\mathrm{cm}^2/\mathrm{s}^2\f$.
+ *
+ * Tables are typically several hundred MB, so the equation of state should be
+ * stored in the global cache using `hydro::Tags::TabulatedEquationOfState`,
+ * which keeps a single copy per node, rather than in the DataBox of each
+ * element.
+ */
+class Tabulated3D {
+ public:
+  static constexpr size_t number_of_quantities = 3;
+
+  Tabulated3D() = default;
+  Tabulated3D(const Tabulated3D&) = default;
+  Tabulated3D& operator=(const Tabulated3D&) = default;
+  Tabulated3D(Tabulated3D&&) = default;
+  Tabulated3D& operator=(Tabulated3D&&) = default;
+  ~Tabulated3D() = default;
+
+  explicit Tabulated3D(const h5::StellarCollapseEos& table) noexcept;
+
+  /// Reads the table in the group `subgroup` of the file `filename`.
+  Tabulated3D(const std::string& filename,
+              const std::string& subgroup) noexcept;
+
+  /// Computes the pressure, the specific internal energy, and the sound speed
+  /// squared from the rest mass density, the temperature, and the electron
+  /// fraction.
+  template <typename DataType>
+  void pressure_energy_and_sound_speed_squared(
+      gsl::not_null<Scalar<DataType>*> pressure,
+      gsl::not_null<Scalar<DataType>*> specific_internal_energy,
+      gsl::not_null<Scalar<DataType>*> sound_speed_squared,
+      const Scalar<DataType>& rest_mass_density,
+      const Scalar<DataType>& temperature,
+      const Scalar<DataType>& electron_fraction) const noexcept;
+
+  /// The smallest and largest rest mass density, temperature, and electron
+  /// fraction in the table.
+  std::array<double, 3> lower_bounds() const noexcept;
+  std::array<double, 3> upper_bounds() const noexcept;
+
+  // clang-tidy: no runtime references
+  void pup(PUP::er& p) noexcept;  // NOLINT
+
+ private:
+  friend bool operator==(const Tabulated3D& lhs,
+                         const Tabulated3D& rhs) noexcept;
+
+  // The number of grid points, the smallest coordinate, and the inverse of the
+  // grid spacing in log10(rho), log10(T), and Y_e, in that order
+  std::array<size_t, 3> number_of_points_{};
+  std::array<double, 3> lower_coordinates_{};
+  std::array<double, 3> inverse_spacings_{};
+  double energy_shift_ = std::numeric_limits<double>::signaling_NaN();
+  // log10(p), log10(epsilon + energy_shift), and c_s^2 at each grid point,
+  // with rho varying fastest between grid points and Y_e slowest
+  std::vector<double> table_{};
+};
+
+bool operator!=(const Tabulated3D& lhs, const Tabulated3D& rhs) noexcept;
+}  // namespace EquationsOfState
+
+namespace hydro {
+namespace OptionTags {
+/// \ingroup OptionGroupsGroup
+/// Groups the options for reading a tabulated equation of state
+struct TabulatedEquationOfStateGroup {
+  static std::string name() noexcept { return "TabulatedEquationOfState"; }
+  static constexpr Options::String help{
+      "Options for reading a tabulated equation of state"};
+};
+
+/// \ingroup OptionTagsGroup
+/// The file containing a tabulated equation of state in the format of
+/// stellarcollapse.org
+struct TabulatedEquationOfStateFilename {
+  static std::string name() noexcept { return "Filename"; }
+  using type = std::string;
+  static constexpr Options::String help{
+      "H5 file containing the equation of state table"};
+  using group = TabulatedEquationOfStateGroup;
+};
+
+/// \ingroup OptionTagsGroup
+/// The group in the file containing the tabulated equation of state
+struct TabulatedEquationOfStateSubgroup {
+  static std::string name() noexcept { return "Subgroup"; }
+  using type = std::string;
+  static constexpr Options::String help{
+      "Group in the H5 file containing the table, '/' for the root group"};
+  using group = TabulatedEquationOfStateGroup;
+};
+}  // namespace OptionTags
+
+namespace Tags {
+/// The tabulated equation of state read from the file given in the options.
+///
+/// This tag is intended for the const global cache, which holds one copy of
+/// the (large) table per node.
+struct TabulatedEquationOfState : db::SimpleTag {
+  using type = EquationsOfState::Tabulated3D;
+  using option_tags =
+      tmpl::list<OptionTags::TabulatedEquationOfStateFilename,
+                 OptionTags::TabulatedEquationOfStateSubgroup>;
+
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const std::string& filename,
+                                  const std::string& subgroup) noexcept {
+    return EquationsOfState::Tabulated3D{filename, subgroup};
+  }
+};
+}  // namespace Tags
+}  // namespace hydro
@@ -4,12 +4,15 @@
 #pragma once
 
 #include <tuple>
+#include <type_traits>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
+#include "Time/ImplicitSector.hpp"
 #include "Time/Tags.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeWithValue.hpp"
 #include "Utilities/NoSuchType.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -24,7 +27,9 @@ class GlobalCache;
 /// \endcond
 
 /// Records the variables and their time derivatives in the time stepper
-/// history.
+/// history. For systems with an `implicit_sector` (see
+/// `imex::has_implicit_sector`) also records the stiff sources in the
+/// `Tags::HistoryImplicitSources`.
 ///
 /// \note this is a free function version of `Actions::RecordTimeStepperData`.
 /// This free function alternative permits the inclusion of the time step
@@ -48,6 +53,32 @@ void record_time_stepper_data(
       },
       db::get<Tags::TimeStepId>(*box), db::get<variables_tag>(*box),
       db::get<dt_variables_tag>(*box));
+
+  if constexpr (imex::has_implicit_sector_v<System> and
+                std::is_same_v<variables_tag,
+                               typename System::variables_tag>) {
+    // Also record the stiff sources, which are not part of the time
+    // derivative. The time stepper only needs their values, so the variables
+    // are not stored again.
+    using implicit_sector = typename System::implicit_sector;
+    using implicit_history_tag = Tags::HistoryImplicitSources<variables_tag>;
+    db::mutate_apply<
+        tmpl::list<implicit_history_tag>,
+        tmpl::push_front<typename implicit_sector::argument_tags,
+                         Tags::TimeStepId, variables_tag>>(
+        [](const gsl::not_null<typename implicit_history_tag::type*>
+               implicit_history,
+           const TimeStepId& time_step_id,
+           const typename variables_tag::type& vars,
+           const auto&... args) noexcept {
+          auto sources =
+              make_with_value<typename dt_variables_tag::type>(vars, 0.);
+          implicit_sector::source(make_not_null(&sources), vars, args...);
+          implicit_history->insert(time_step_id,
+                                   typename variables_tag::type{}, sources);
+        },
+        box);
+  }
 }
 
 namespace Actions {
@@ -66,12 +97,16 @@ namespace Actions {
 ///   - dt_variables_tag
 ///   - Tags::HistoryEvolvedVariables<variables_tag>
 ///   - Tags::TimeStepId
+///   - for systems with an `implicit_sector`: its `argument_tags` and
+///     Tags::HistoryImplicitSources<variables_tag>
 ///
 /// DataBox changes:
 /// - Adds: nothing
 /// - Removes: nothing
 /// - Modifies:
 ///   - Tags::HistoryEvolvedVariables<variables_tag>
+///   - for systems with an `implicit_sector`:
+///     Tags::HistoryImplicitSources<variables_tag>
 template <typename VariablesTag = NoSuchType>
 struct RecordTimeStepperData {
   template <typename DbTags, typename... InboxTags, typename Metavariables,
@@ -7,17 +7,22 @@
 #pragma once
 
 #include <tuple>
+#include <type_traits>
 #include <utility>  // IWYU pragma: keep // for std::move
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
+#include "Time/ImplicitSector.hpp"
 #include "Time/Tags.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/NoSuchType.hpp"
+#include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
 // IWYU pragma: no_include "Time/Time.hpp" // for TimeDelta
 
 /// \cond
+class ImexTimeStepper;
 namespace Parallel {
 template <typename Metavariables>
 class GlobalCache;
@@ -29,6 +34,10 @@ class GlobalCache;
 /// Perform variable updates for one substep for a substep method, or one step
 /// for an LMM method.
 ///
+/// For systems with an `implicit_sector` (see `imex::has_implicit_sector`) the
+/// substep is completed by solving for the stiff sources implicitly, which
+/// requires a `Tags::TimeStepper<ImexTimeStepper>`.
+///
 /// \note This is a free function version of `Actions::UpdateU`. This free
 /// function alternative permits the inclusion of the time step procedure in
 /// the middle of another action.
@@ -39,14 +48,36 @@ void update_u(const gsl::not_null<db::DataBox<DbTags>*> box) noexcept {
                           typename System::variables_tag, VariablesTag>;
   using history_tag = Tags::HistoryEvolvedVariables<variables_tag>;
 
-  db::mutate<variables_tag, history_tag>(
-      box,
-      [](const gsl::not_null<typename variables_tag::type*> vars,
-         const gsl::not_null<typename history_tag::type*> history,
-         const ::TimeDelta& time_step, const auto& time_stepper) noexcept {
-        time_stepper.update_u(vars, history, time_step);
-      },
-      db::get<Tags::TimeStep>(*box), db::get<Tags::TimeStepper<>>(*box));
+  if constexpr (imex::has_implicit_sector_v<System> and
+                std::is_same_v<variables_tag,
+                               typename System::variables_tag>) {
+    using implicit_sector = typename System::implicit_sector;
+    using implicit_history_tag = Tags::HistoryImplicitSources<variables_tag>;
+    db::mutate_apply<
+        tmpl::list<variables_tag, history_tag, implicit_history_tag>,
+        tmpl::push_front<typename implicit_sector::argument_tags,
+                         Tags::TimeStep, Tags::TimeStepper<ImexTimeStepper>>>(
+        [](const gsl::not_null<typename variables_tag::type*> vars,
+           const gsl::not_null<typename history_tag::type*> history,
+           const gsl::not_null<typename implicit_history_tag::type*>
+               implicit_history,
+           const ::TimeDelta& time_step, const auto& time_stepper,
+           const auto&... args) noexcept {
+          const double implicit_weight = time_stepper.imex_update_u(
+              vars, history, implicit_history, time_step);
+          implicit_sector::solve(vars, implicit_weight, args...);
+        },
+        box);
+  } else {
+    db::mutate<variables_tag, history_tag>(
+        box,
+        [](const gsl::not_null<typename variables_tag::type*> vars,
+           const gsl::not_null<typename history_tag::type*> history,
+           const ::TimeDelta& time_step, const auto& time_stepper) noexcept {
+          time_stepper.update_u(vars, history, time_step);
+        },
+        db::get<Tags::TimeStep>(*box), db::get<Tags::TimeStepper<>>(*box));
+  }
 }
 
 namespace Actions {
@@ -60,7 +91,8 @@ namespace Actions {
 ///   `system::variables_tag` if none is provided)
 ///   - Tags::HistoryEvolvedVariables<variables_tag>
 ///   - Tags::TimeStep
-///   - Tags::TimeStepper<>
+///   - Tags::TimeStepper<>, or Tags::TimeStepper<ImexTimeStepper> and the
+///     `argument_tags` of the `implicit_sector` for systems that have one
 ///
 /// DataBox changes:
 /// - Adds: nothing
@@ -68,6 +100,8 @@ namespace Actions {
 /// - Modifies:
 ///   - variables_tag
 ///   - Tags::HistoryEvolvedVariables<variables_tag>
+///   - for systems with an `implicit_sector`:
+///     Tags::HistoryImplicitSources<variables_tag>
 template <typename VariablesTag = NoSuchType>
 struct UpdateU {
   template <typename DbTags, typename... InboxTags, typename Metavariables,
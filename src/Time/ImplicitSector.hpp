@@ -0,0 +1,52 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "Utilities/TypeTraits/CreateHasTypeAlias.hpp"
+
+/// Implicit-explicit (IMEX) time stepping of stiff source terms
+namespace imex {
+namespace detail {
+CREATE_HAS_TYPE_ALIAS(implicit_sector)
+CREATE_HAS_TYPE_ALIAS_V(implicit_sector)
+}  // namespace detail
+
+/*!
+ * \brief Check if the `System` has stiff source terms that are integrated
+ * implicitly by an `ImexTimeStepper`
+ *
+ * A system that has stiff source terms \f$S(u)\f$, e.g. neutrino-matter
+ * coupling or constraint damping with a large damping parameter, can integrate
+ * them implicitly and the remaining terms \f$F(t, u)\f$ explicitly, so the step
+ * size is limited by the explicit terms only. To do so, the system omits the
+ * stiff sources from its time derivative and provides them in a type alias
+ * `implicit_sector` with the following members:
+ *
+ * - `argument_tags`: A typelist of DataBox tags for background quantities that
+ *   the sources depend on, such as the spacetime metric or opacities. These
+ *   must not include the evolved variables.
+ * - `static void source(gsl::not_null<DtVars*> source, const Vars& vars,
+ *   const ArgumentTags::type&... args)`: Compute the stiff sources
+ *   \f$S(u)\f$.
+ * - `static void solve(gsl::not_null<Vars*> vars, double implicit_weight,
+ *   const ArgumentTags::type&... args)`: Overwrite the variables
+ *   \f$u^\ast\f$ passed in with the solution \f$u\f$ of
+ *   \f$u - w S(u) = u^\ast\f$, where \f$w\f$ is the `implicit_weight`. The
+ *   sources must be local to each grid point, so this is a small system of
+ *   equations at every grid point that can be solved independently, either in
+ *   closed form or by a few Newton-Raphson iterations.
+ *
+ * The `record_time_stepper_data` and `update_u` functions take care of
+ * recording the sources in the `Tags::HistoryImplicitSources` and of solving
+ * the implicit equation on every substep. They need a
+ * `Tags::TimeStepper<ImexTimeStepper>` in the DataBox.
+ */
+template <typename System>
+struct has_implicit_sector : detail::has_implicit_sector<System> {};
+
+/// \see has_implicit_sector
+template <typename System>
+constexpr bool has_implicit_sector_v =
+    detail::has_implicit_sector_v<System>;
+}  // namespace imex
@@ -103,6 +103,40 @@ struct HistoryEvolvedVariables : HistoryEvolvedVariables<>, db::SimpleTag {
 };
 /// \endcond
 
+/// \ingroup DataBoxTagsGroup
+/// \ingroup TimeGroup
+/// Tag for the history of the stiff sources that an `ImexTimeStepper`
+/// integrates implicitly
+///
+/// The derivatives of the history entries hold the sources computed by the
+/// system's `implicit_sector` (see `imex::has_implicit_sector`). The values of
+/// the entries are not used by the time stepper, so they are left empty.
+///
+/// Leaving the template parameter unspecified gives a base tag.
+///
+/// \tparam Tag tag for the variables
+template <typename Tag = void>
+struct HistoryImplicitSources;
+
+/// \cond
+template <>
+struct HistoryImplicitSources<> : db::BaseTag {};
+
+template <typename TagsList>
+struct HistoryImplicitSources<::Tags::Variables<TagsList>>
+    : HistoryImplicitSources<>, db::SimpleTag {
+  using type =
+      TimeSteppers::History<::Variables<TagsList>,
+                            ::Variables<db::wrap_tags_in<Tags::dt, TagsList>>>;
+};
+
+template <typename Tag>
+struct HistoryImplicitSources : HistoryImplicitSources<>, db::SimpleTag {
+  using type =
+      TimeSteppers::History<typename Tag::type, typename Tags::dt<Tag>::type>;
+};
+/// \endcond
+
 /// \ingroup DataBoxTagsGroup
 /// \ingroup TimeGroup
 /// \brief Tag for the stepper error measure.
@@ -0,0 +1,52 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Time/TimeSteppers/ImexRungeKutta2.hpp"
+
+#include "Time/TimeStepId.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+
+namespace TimeSteppers {
+
+size_t ImexRungeKutta2::order() const noexcept { return 2; }
+
+size_t ImexRungeKutta2::error_estimate_order() const noexcept { return 1; }
+
+uint64_t ImexRungeKutta2::number_of_substeps() const noexcept { return 2; }
+
+uint64_t ImexRungeKutta2::number_of_substeps_for_error() const noexcept {
+  return 2;
+}
+
+size_t ImexRungeKutta2::number_of_past_steps() const noexcept { return 0; }
+
+// The growth function of the explicit part is 1 + mu + mu^2 / 2 with
+// mu = lambda * dt, so the equation dy/dt = -2 y evolves stably for dt <= 1.
+double ImexRungeKutta2::stable_step() const noexcept { return 1.; }
+
+TimeStepId ImexRungeKutta2::next_time_id(
+    const TimeStepId& current_id, const TimeDelta& time_step) const noexcept {
+  switch (current_id.substep()) {
+    case 0:
+      ASSERT(current_id.substep_time() == current_id.step_time(),
+             "Wrong substep time");
+      return {current_id.time_runs_forward(), current_id.slab_number(),
+              current_id.step_time(), 1, current_id.step_time() + time_step};
+    case 1:
+      ASSERT(current_id.substep_time() == current_id.step_time() + time_step,
+             "Wrong substep time");
+      return {current_id.time_runs_forward(), current_id.slab_number(),
+              current_id.step_time() + time_step};
+    default:
+      ERROR("Bad substep value in ImexRungeKutta2: " << current_id.substep());
+  }
+}
+
+TimeStepId ImexRungeKutta2::next_time_id_for_error(
+    const TimeStepId& current_id, const TimeDelta& time_step) const noexcept {
+  return next_time_id(current_id, time_step);
+}
+}  // namespace TimeSteppers
+
+PUP::able::PUP_ID TimeSteppers::ImexRungeKutta2::my_PUP_ID =  // NOLINT
+    0;
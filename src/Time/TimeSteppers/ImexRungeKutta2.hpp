@@ -0,0 +1,268 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines class ImexRungeKutta2.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <pup.h>
+
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Time/EvolutionOrdering.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"  // IWYU pragma: keep
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+struct TimeStepId;
+namespace TimeSteppers {
+template <typename Vars, typename DerivVars>
+class History;
+}  // namespace TimeSteppers
+/// \endcond
+
+namespace TimeSteppers {
+
+/*!
+ * \ingroup TimeSteppersGroup
+ *
+ * A second-order additive implicit-explicit (IMEX) Runge-Kutta time-stepper.
+ *
+ * The stepper integrates \f$du/dt = F(t, u) + S(u)\f$, where the stiff sources
+ * \f$S\f$ are integrated with an L-stable, stiffly-accurate singly-diagonally
+ * implicit scheme and \f$F\f$ with Heun's method (the second-order
+ * strong-stability-preserving Runge-Kutta method). The Butcher tableaus of the
+ * explicit and implicit parts are
+ *
+ * \f{align}{
+ * \begin{array}{c|ccc}
+ * 0 & & & \\
+ * 1 & 1 & & \\
+ * 1 & \frac{1}{2} & \frac{1}{2} & \\ \hline
+ *   & \frac{1}{2} & \frac{1}{2} & 0
+ * \end{array}
+ * \qquad
+ * \begin{array}{c|ccc}
+ * 0 & 0 & & \\
+ * 1 & 1 - \gamma & \gamma & \\
+ * 1 & \frac{1}{2} & \frac{1}{2} - \gamma & \gamma \\ \hline
+ *   & \frac{1}{2} & \frac{1}{2} - \gamma & \gamma
+ * \end{array}
+ * \f}
+ *
+ * with \f$\gamma = 1 - 1/\sqrt{2}\f$. The first stage is explicit, so the
+ * stepper takes two substeps per step, at the start and at the end of the
+ * step. Each substep is completed by solving the implicit equation
+ * \f$u - \gamma\,dt\,S(u) = u^\ast\f$ (see `ImexTimeStepper`). Since both
+ * parts are stiffly accurate, the result of the last solve is the solution at
+ * the end of the step. The implicit part is L-stable, so the step size is
+ * limited by the explicit terms only. However, in the stiff limit, where the
+ * solution relaxes to the equilibrium of the stiff sources within a step, the
+ * accuracy of that equilibrium reduces to first order in the step size.
+ *
+ * When used as an explicit time stepper, i.e. without stiff sources, this is
+ * Heun's method. The error estimate compares to the forward Euler step, and
+ * dense output is a linear interpolation between the start and the end of the
+ * step, which is second-order accurate and unaffected by stiff sources.
+ */
+class ImexRungeKutta2 : public ImexTimeStepper::Inherit {
+ public:
+  using options = tmpl::list<>;
+  static constexpr Options::String help = {
+      "A second-order implicit-explicit Runge-Kutta time-stepper. Integrates "
+      "the stiff sources of a system implicitly, and all other terms with "
+      "Heun's method."};
+
+  ImexRungeKutta2() = default;
+  ImexRungeKutta2(const ImexRungeKutta2&) noexcept = default;
+  ImexRungeKutta2& operator=(const ImexRungeKutta2&) noexcept = default;
+  ImexRungeKutta2(ImexRungeKutta2&&) noexcept = default;
+  ImexRungeKutta2& operator=(ImexRungeKutta2&&) noexcept = default;
+  ~ImexRungeKutta2() noexcept override = default;
+
+  template <typename Vars, typename DerivVars>
+  void update_u(gsl::not_null<Vars*> u,
+                gsl::not_null<History<Vars, DerivVars>*> history,
+                const TimeDelta& time_step) const noexcept;
+
+  template <typename Vars, typename ErrVars, typename DerivVars>
+  bool update_u(gsl::not_null<Vars*> u, gsl::not_null<ErrVars*> u_error,
+                gsl::not_null<History<Vars, DerivVars>*> history,
+                const TimeDelta& time_step) const noexcept;
+
+  template <typename Vars, typename DerivVars>
+  double imex_update_u(
+      gsl::not_null<Vars*> u, gsl::not_null<History<Vars, DerivVars>*> history,
+      gsl::not_null<History<Vars, DerivVars>*> implicit_history,
+      const TimeDelta& time_step) const noexcept;
+
+  template <typename Vars, typename DerivVars>
+  bool dense_update_u(gsl::not_null<Vars*> u,
+                      const History<Vars, DerivVars>& history,
+                      double time) const noexcept;
+
+  size_t order() const noexcept override;
+
+  size_t error_estimate_order() const noexcept override;
+
+  uint64_t number_of_substeps() const noexcept override;
+
+  uint64_t number_of_substeps_for_error() const noexcept override;
+
+  size_t number_of_past_steps() const noexcept override;
+
+  double stable_step() const noexcept override;
+
+  TimeStepId next_time_id(const TimeStepId& current_id,
+                          const TimeDelta& time_step) const noexcept override;
+
+  TimeStepId next_time_id_for_error(
+      const TimeStepId& current_id,
+      const TimeDelta& time_step) const noexcept override;
+
+  template <typename Vars, typename DerivVars>
+  bool can_change_step_size(
+      const TimeStepId& time_id,
+      const TimeSteppers::History<Vars, DerivVars>& /*history*/) const
+      noexcept {
+    return time_id.substep() == 0;
+  }
+
+  WRAPPED_PUPable_decl_template(ImexRungeKutta2);  // NOLINT
+
+  explicit ImexRungeKutta2(CkMigrateMessage* /*unused*/) noexcept {}
+
+  // clang-tidy: do not pass by non-const reference
+  void pup(PUP::er& p) noexcept override {  // NOLINT
+    ImexTimeStepper::Inherit::pup(p);
+  }
+
+ private:
+  // The diagonal coefficient of the implicit part, 1 - 1/sqrt(2)
+  static constexpr double gamma_ = 0.29289321881345247559915563789515;
+};
+
+inline bool constexpr operator==(const ImexRungeKutta2& /*lhs*/,
+                                 const ImexRungeKutta2& /*rhs*/) noexcept {
+  return true;
+}
+
+inline bool constexpr operator!=(const ImexRungeKutta2& /*lhs*/,
+                                 const ImexRungeKutta2& /*rhs*/) noexcept {
+  return false;
+}
+
+template <typename Vars, typename DerivVars>
+void ImexRungeKutta2::update_u(
+    const gsl::not_null<Vars*> u,
+    const gsl::not_null<History<Vars, DerivVars>*> history,
+    const TimeDelta& time_step) const noexcept {
+  ASSERT(history->integration_order() == 2,
+         "Fixed-order stepper cannot run at order "
+         << history->integration_order());
+  const size_t substep = (history->end() - 1).time_step_id().substep();
+
+  // Clean up old history
+  if (substep == 0) {
+    history->mark_unneeded(history->end() - 1);
+  }
+
+  const double dt = time_step.value();
+  const auto& u0 = history->begin().value();
+
+  switch (substep) {
+    case 0: {
+      *u = u0 + dt * history->begin().derivative();
+      break;
+    }
+    case 1: {
+      *u = u0 + (0.5 * dt) * (history->begin().derivative() +
+                              (history->begin() + 1).derivative());
+      break;
+    }
+    default:
+      ERROR("Bad substep value in ImexRungeKutta2: " << substep);
+  }
+}
+
+template <typename Vars, typename ErrVars, typename DerivVars>
+bool ImexRungeKutta2::update_u(
+    const gsl::not_null<Vars*> u, const gsl::not_null<ErrVars*> u_error,
+    const gsl::not_null<History<Vars, DerivVars>*> history,
+    const TimeDelta& time_step) const noexcept {
+  update_u(u, history, time_step);
+  if ((history->end() - 1).time_step_id().substep() == 1) {
+    *u_error = *u - history->begin().value() -
+               time_step.value() * history->begin().derivative();
+    return true;
+  }
+  return false;
+}
+
+template <typename Vars, typename DerivVars>
+double ImexRungeKutta2::imex_update_u(
+    const gsl::not_null<Vars*> u,
+    const gsl::not_null<History<Vars, DerivVars>*> history,
+    const gsl::not_null<History<Vars, DerivVars>*> implicit_history,
+    const TimeDelta& time_step) const noexcept {
+  ASSERT(implicit_history->size() > 0 and
+             (implicit_history->end() - 1).time_step_id() ==
+                 (history->end() - 1).time_step_id(),
+         "The implicit history must hold the sources of the same substeps as "
+         "the explicit history.");
+  const size_t substep = (history->end() - 1).time_step_id().substep();
+  if (substep == 0) {
+    implicit_history->mark_unneeded(implicit_history->end() - 1);
+  }
+  update_u(u, history, time_step);
+
+  const double dt = time_step.value();
+  const auto& source0 = implicit_history->begin().derivative();
+  if (substep == 0) {
+    *u += ((1.0 - gamma_) * dt) * source0;
+  } else {
+    *u += (0.5 * dt) * source0 +
+          ((0.5 - gamma_) * dt) * (implicit_history->begin() + 1).derivative();
+  }
+  return gamma_ * dt;
+}
+
+template <typename Vars, typename DerivVars>
+bool ImexRungeKutta2::dense_update_u(const gsl::not_null<Vars*> u,
+                                     const History<Vars, DerivVars>& history,
+                                     const double time) const noexcept {
+  if ((history.end() - 1).time_step_id().substep() != 0) {
+    return false;
+  }
+  const double step_start = history.front().value();
+  const double step_end = history.back().value();
+  if (time == step_end) {
+    // Special case necessary for dense output at the initial time,
+    // before taking a step.
+    *u = (history.end() - 1).value();
+    return true;
+  }
+  const evolution_less<double> before{step_end > step_start};
+  if (history.size() == 1 or before(step_end, time)) {
+    return false;
+  }
+  const double output_fraction = (time - step_start) / (step_end - step_start);
+  ASSERT(output_fraction >= 0, "Attempting dense output at time " << time
+         << ", but already progressed past " << step_start);
+  ASSERT(output_fraction <= 1,
+         "Requested time (" << time << " not within step [" << step_start
+         << ", " << step_end << "]");
+
+  *u = (1.0 - output_fraction) * history.begin().value() +
+       output_fraction * (history.end() - 1).value();
+  return true;
+}
+}  // namespace TimeSteppers
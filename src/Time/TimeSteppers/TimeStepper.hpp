@@ -31,6 +31,7 @@ class History;
 namespace TimeSteppers {
 class AdamsBashforthN;  // IWYU pragma: keep
 class DormandPrince5;
+class ImexRungeKutta2;
 class RungeKutta3;  // IWYU pragma: keep
 class RungeKutta4;
 }  // namespace TimeSteppers
@@ -51,7 +52,8 @@ class TimeStepper : public PUP::able {
           TimeStepper_detail::FakeVirtualInherit_update_u<TimeStepper>>>;
   using creatable_classes =
       tmpl::list<TimeSteppers::AdamsBashforthN, TimeSteppers::DormandPrince5,
-                 TimeSteppers::RungeKutta3, TimeSteppers::RungeKutta4>;
+                 TimeSteppers::ImexRungeKutta2, TimeSteppers::RungeKutta3,
+                 TimeSteppers::RungeKutta4>;
 
   WRAPPED_PUPable_abstract(TimeStepper);  // NOLINT
 
@@ -242,8 +244,96 @@ class LtsTimeStepper : public TimeStepper::Inherit {
   /// \endcond
 };
 
+// ImexTimeStepper cannot be split out into its own file for the same reason
+// as LtsTimeStepper.
+namespace ImexTimeStepper_detail {
+DEFINE_FAKE_VIRTUAL(imex_update_u)
+}  // namespace ImexTimeStepper_detail
+
+/// \ingroup TimeSteppersGroup
+///
+/// Base class for TimeSteppers with implicit-explicit (IMEX) support,
+/// derived from TimeStepper.
+///
+/// An IMEX time stepper integrates \f$du/dt = F(t, u) + S(u)\f$, where the
+/// stiff sources \f$S(u)\f$ are integrated implicitly and \f$F(t, u)\f$ is
+/// integrated explicitly. The `history` holds \f$F\f$ and the
+/// `implicit_history` holds \f$S\f$ for the same substeps. Each substep
+/// computes an intermediate result \f$u^\ast\f$ from both histories and is
+/// completed by solving \f$u - w S(u) = u^\ast\f$, where the weight \f$w\f$
+/// is returned by `imex_update_u` (see `imex::has_implicit_sector`). Since
+/// the stiff sources don't limit the step size, step choosers such as
+/// `StepChoosers::Cfl` only need to account for the explicit part, which
+/// `stable_step()` refers to.
+///
+/// IMEX time steppers can also be used as explicit time steppers by calling
+/// the functions of the `TimeStepper` base class. Their dense output must
+/// not depend on the derivatives in the history, so that `dense_update_u` is
+/// also valid when the stiff sources are integrated implicitly.
+class ImexTimeStepper : public TimeStepper::Inherit {
+ public:
+  using Inherit =
+      ImexTimeStepper_detail::FakeVirtualInherit_imex_update_u<ImexTimeStepper>;
+  // When you add a class here, remember to add it to TimeStepper as well.
+  using creatable_classes = tmpl::list<TimeSteppers::ImexRungeKutta2>;
+
+  WRAPPED_PUPable_abstract(ImexTimeStepper);  // NOLINT
+
+  /// Compute the intermediate result \f$u^\ast\f$ of the current substep
+  /// from the explicit and implicit histories, and return the weight \f$w\f$
+  /// of the implicit equation \f$u - w S(u) = u^\ast\f$ that completes the
+  /// substep.
+  template <typename Vars, typename DerivVars>
+  double imex_update_u(
+      const gsl::not_null<Vars*> u,
+      const gsl::not_null<TimeSteppers::History<Vars, DerivVars>*> history,
+      const gsl::not_null<TimeSteppers::History<Vars, DerivVars>*>
+          implicit_history,
+      const TimeDelta& time_step) const noexcept {
+    return ImexTimeStepper_detail::fake_virtual_imex_update_u<
+        creatable_classes>(this, u, history, implicit_history, time_step);
+  }
+
+  /// \cond
+  // FakeVirtual forces derived classes to override the fake virtual
+  // methods.  Here the base class method is actually what we want
+  // because we are not a most-derived class, so we forward to the
+  // TimeStepper version.
+  template <typename Vars, typename DerivVars>
+  void update_u(
+      const gsl::not_null<Vars*> u,
+      const gsl::not_null<TimeSteppers::History<Vars, DerivVars>*> history,
+      const TimeDelta& time_step) const noexcept {
+    return TimeStepper::update_u(u, history, time_step);
+  }
+
+  template <typename Vars, typename ErrVars, typename DerivVars>
+  bool update_u(
+      const gsl::not_null<Vars*> u, const gsl::not_null<ErrVars*> u_error,
+      const gsl::not_null<TimeSteppers::History<Vars, DerivVars>*> history,
+      const TimeDelta& time_step) const noexcept {
+    return TimeStepper::update_u(u, u_error, history, time_step);
+  }
+
+  template <typename Vars, typename DerivVars>
+  bool dense_update_u(const gsl::not_null<Vars*> u,
+                      const TimeSteppers::History<Vars, DerivVars>& history,
+                      const double time) const noexcept {
+    return TimeStepper::dense_update_u(u, history, time);
+  }
+
+  template <typename Vars, typename DerivVars>
+  bool can_change_step_size(
+      const TimeStepId& time_id,
+      const TimeSteppers::History<Vars, DerivVars>& history) const noexcept {
+    return TimeStepper::can_change_step_size(time_id, history);
+  }
+  /// \endcond
+};
+
 
 #include "Time/TimeSteppers/AdamsBashforthN.hpp"  // IWYU pragma: keep
 #include "Time/TimeSteppers/DormandPrince5.hpp"
+#include "Time/TimeSteppers/ImexRungeKutta2.hpp"
 #include "Time/TimeSteppers/RungeKutta3.hpp"  // IWYU pragma: keep
 #include "Time/TimeSteppers/RungeKutta4.hpp"  // IWYU pragma: keep
@@ -10,6 +10,52 @@ import numpy as np
 import sys
 
 
+def xdmf_number_type(dataset):
+    """
+    Return the XDMF NumberType and Precision that describe the values stored
+    in the HDF5 dataset.
+    """
+    number_types = {
+        ('f', 4): "Float",
+        ('f', 8): "Float",
+        ('i', 1): "Char",
+        ('i', 2): "Short",
+        ('i', 4): "Int",
+        ('i', 8): "Int",
+        ('u', 1): "UChar",
+        ('u', 2): "UShort",
+        ('u', 4): "UInt",
+    }
+    key = (dataset.dtype.kind, dataset.dtype.itemsize)
+    if key not in number_types:
+        raise ValueError(
+            "Dataset '{}' has type '{}', which can't be described in "
+            "XDMF.".format(dataset.name, dataset.dtype))
+    return number_types[key], dataset.dtype.itemsize
+
+
+def xdmf_data_item(dataset, dataset_path, numpoints):
+    """
+    Return the XDMF DataItem that reads the dataset at `dataset_path`.
+
+    Quantized datasets store integer offsets from `quantization_offset` in
+    units of `quantization_step` (see `h5::VolumeData`). They are wrapped in
+    a Function that restores the values.
+    """
+    number_type, precision = xdmf_number_type(dataset)
+    data_item = ("        <DataItem Dimensions=\" %d\" "
+                 "NumberType=\"%s\" Precision=\"%d\" Format=\"HDF5\">\n" %
+                 (numpoints, number_type, precision) + dataset_path +
+                 "\n        </DataItem>\n")
+    if 'quantization_step' not in dataset.attrs:
+        return data_item
+    offset = float(np.squeeze(dataset.attrs['quantization_offset']))
+    step = float(np.squeeze(dataset.attrs['quantization_step']))
+    return ("        <DataItem Dimensions=\" %d\" ItemType=\"Function\" "
+            "Function=\"%.17e + %.17e * $0\">\n" % (numpoints, offset, step) +
+            data_item + "        </DataItem>\n")
+
+
 def generate_xdmf(file_prefix, output, subfile_name, start_time, stop_time,
                   stride, coordinates):
     """
@@ -115,12 +161,8 @@ def generate_xdmf(file_prefix, output, subfile_name, start_time, stop_time,
                 (extents_x - 1) * (extents_y - 1) *
                 (extents_z - 1 if dimensionality == 3 else 1))
 
-            data_item = (
-                "        <DataItem Dimensions=\" %d\" "
-                "NumberType=\"Double\" Precision=\"8\" Format=\"HDF5\">\n" %
-                (numpoints))
-
             # Set up vectors
+            vector_indices = ["_x", "_y", "_z"][:dimensionality]
             if dimensionality == 3:
                 data_item_vec = (
                     "        <DataItem Dimensions=\" %d 3\" "
@@ -170,13 +212,10 @@ def generate_xdmf(file_prefix, output, subfile_name, start_time, stop_time,
                 xdmf_output += "      <Geometry Type=\"X_Y_Z\">\n"
             else:
                 xdmf_output += "      <Geometry Type=\"X_Y\">\n"
-            xdmf_output += (data_item + Grid_path + "/" + coordinates +
-                            "_x\n        </DataItem>\n")
-            xdmf_output += (data_item + Grid_path + "/" + coordinates +
-                            "_y\n        </DataItem>\n")
-            if dimensionality == 3:
-                xdmf_output += (data_item + Grid_path + "/" + coordinates +
-                                "_z\n        </DataItem>\n")
+            for index in vector_indices:
+                xdmf_output += xdmf_data_item(
+                    h5temporal[coordinates + index],
+                    Grid_path + "/" + coordinates + index, numpoints)
             xdmf_output += "      </Geometry>\n"
             # Everything that isn't a coordinate is a "component"
             components = list(h5temporal.keys())
@@ -203,10 +242,10 @@ def generate_xdmf(file_prefix, output, subfile_name, start_time, stop_time,
                         "AttributeType=\"Vector\" Center=\"Node\">\n" %
                         (vector))
                     xdmf_output += data_item_vec
-                    for index in ["_x", "_y", "_z"]:
-                        xdmf_output += (data_item + Grid_path + "/%s" %
-                                        (vector) + index + "\n" +
-                                        "        </DataItem>\n")
+                    for index in vector_indices:
+                        xdmf_output += xdmf_data_item(
+                            h5temporal[vector + index],
+                            Grid_path + "/" + vector + index, numpoints)
                     xdmf_output += "        </DataItem>\n"
                     xdmf_output += "      </Attribute>\n"
                 elif (component.endswith("_y") or component.endswith("_z")):
@@ -220,8 +259,9 @@ def generate_xdmf(file_prefix, output, subfile_name, start_time, stop_time,
                         "      <Attribute Name=\"%s\" "
                         "AttributeType=\"Scalar\" Center=\"Node\">\n" %
                         (component))
-                    xdmf_output += data_item + Grid_path + (
-                        "/%s\n" % component) + "        </DataItem>\n"
+                    xdmf_output += xdmf_data_item(
+                        h5temporal[component], Grid_path + "/" + component,
+                        numpoints)
                     xdmf_output += "      </Attribute>\n"
             xdmf_output += "    </Grid>\n"
 
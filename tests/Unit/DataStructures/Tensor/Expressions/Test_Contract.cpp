@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <iterator>
+#include <limits>
 #include <numeric>
 
 #include "DataStructures/DataVector.hpp"
@@ -643,4 +644,8 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.Contract",
   test_contractions(std::numeric_limits<double>::signaling_NaN());
   test_contractions(
       DataVector(5, std::numeric_limits<double>::signaling_NaN()));
+  // Evaluated in tiles of grid points, with a partial last tile
+  test_contractions(
+      DataVector(2 * TensorExpressions::detail::evaluate_tile_size + 3,
+                 std::numeric_limits<double>::signaling_NaN()));
 }
@@ -5,9 +5,11 @@
 
 #include <cstddef>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <type_traits>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/Tensor/Expressions/AddSubtract.hpp"
 #include "DataStructures/Tensor/Expressions/Evaluate.hpp"
@@ -140,4 +142,8 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.MixedOperations",
   test_mixed_operations(std::numeric_limits<double>::signaling_NaN());
   test_mixed_operations(
       DataVector(5, std::numeric_limits<double>::signaling_NaN()));
+  // Evaluated in tiles of grid points, with a partial last tile
+  test_mixed_operations(
+      DataVector(2 * TensorExpressions::detail::evaluate_tile_size + 3,
+                 std::numeric_limits<double>::signaling_NaN()));
 }
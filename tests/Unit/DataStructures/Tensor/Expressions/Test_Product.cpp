@@ -5,8 +5,10 @@
 
 #include <cstddef>
 #include <iterator>
+#include <limits>
 #include <numeric>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Expressions/Evaluate.hpp"
 #include "DataStructures/Tensor/Expressions/Product.hpp"
 #include "DataStructures/Tensor/Expressions/TensorExpression.hpp"
@@ -1151,4 +1153,8 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.Product",
                   "[DataStructures][Unit]") {
   test_products(std::numeric_limits<double>::signaling_NaN());
   test_products(DataVector(5, std::numeric_limits<double>::signaling_NaN()));
+  // Evaluated in tiles of grid points, with a partial last tile
+  test_products(
+      DataVector(2 * TensorExpressions::detail::evaluate_tile_size + 3,
+                 std::numeric_limits<double>::signaling_NaN()));
 }
@@ -10,6 +10,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "Framework/TestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/GetOutput.hpp"
 #include "Utilities/StdHelpers.hpp"  // IWYU pragma: keep
 
@@ -28,4 +29,18 @@ SPECTRE_TEST_CASE("Unit.DataStructures.TensorData", "[Unit]") {
   const auto after = serialize_and_deserialize(etvd0);
   CHECK(after.extents == etvd0.extents);
   CHECK(after.tensor_components == etvd0.tensor_components);
+
+  const ContiguousElementVolumeData contiguous_data(
+      "[B0,(L0I0)]", {2, 3}, DataVector{1., 2., 3., 4., 5., 6., 7., 8., 9.,
+                                        10., 11., 12.},
+      {Spectral::Basis::Legendre, Spectral::Basis::Chebyshev},
+      {Spectral::Quadrature::GaussLobatto, Spectral::Quadrature::Gauss});
+  CHECK(contiguous_data.number_of_grid_points() == 6);
+  const auto contiguous_data_after =
+      serialize_and_deserialize(contiguous_data);
+  CHECK(contiguous_data_after.grid_name == contiguous_data.grid_name);
+  CHECK(contiguous_data_after.extents == contiguous_data.extents);
+  CHECK(contiguous_data_after.components == contiguous_data.components);
+  CHECK(contiguous_data_after.basis == contiguous_data.basis);
+  CHECK(contiguous_data_after.quadrature == contiguous_data.quadrature);
 }
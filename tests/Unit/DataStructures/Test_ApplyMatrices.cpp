@@ -198,6 +198,45 @@ void test_interpolation() noexcept {
     }
   }
 }
+
+// Enough independent components that they are processed in several
+// blocks, which must agree with processing each component on its own.
+template <typename DataType>
+void test_many_components() noexcept {
+  MAKE_GENERATOR(gen);
+  UniformCustomDistribution<double> dist{-1.0, 1.0};
+  const Mesh<3> source_mesh{{{8, 7, 6}}, basis, quadrature};
+  const Mesh<3> dest_mesh{{{5, 9, 6}}, basis, quadrature};
+  std::array<Matrix, 3> matrices{};
+  for (size_t d = 0; d < 2; ++d) {
+    gsl::at(matrices, d) = Spectral::interpolation_matrix(
+        source_mesh.slice_through(d),
+        Spectral::collocation_points(dest_mesh.slice_through(d)));
+  }
+  const size_t number_of_components = 137;
+  const size_t source_points = source_mesh.number_of_grid_points();
+  const size_t dest_points = dest_mesh.number_of_grid_points();
+  DataType source_data{number_of_components * source_points};
+  fill_with_random_values(make_not_null(&source_data), make_not_null(&gen),
+                          make_not_null(&dist));
+  const auto result =
+      apply_matrices(matrices, source_data, source_mesh.extents());
+  REQUIRE(result.size() == number_of_components * dest_points);
+  Approx custom_approx = Approx::custom().epsilon(1.e-13).scale(1.0);
+  for (size_t component = 0; component < number_of_components; ++component) {
+    CAPTURE(component);
+    DataType single_component{source_points};
+    for (size_t i = 0; i < source_points; ++i) {
+      single_component[i] = source_data[component * source_points + i];
+    }
+    const auto expected =
+        apply_matrices(matrices, single_component, source_mesh.extents());
+    for (size_t i = 0; i < dest_points; ++i) {
+      CHECK_COMPLEX_CUSTOM_APPROX(result[component * dest_points + i],
+                                  expected[i], custom_approx);
+    }
+  }
+}
 }  // namespace
 
 // [[Timeout, 8]]
@@ -215,6 +254,11 @@ SPECTRE_TEST_CASE("Unit.DataStructures.ApplyMatrices",
     test_interpolation<ComplexScalarTag, ComplexTensorTag, 2>();
     test_interpolation<ComplexScalarTag, ComplexTensorTag, 3>();
   }
+  {
+    INFO("Many components");
+    test_many_components<DataVector>();
+    test_many_components<ComplexDataVector>();
+  }
   // Can't use test_interpolation for 0 because Tensor errors on
   // Dim=0.
   const Index<0> extents{};
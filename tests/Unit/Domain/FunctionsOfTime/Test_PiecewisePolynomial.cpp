@@ -102,6 +102,27 @@ void test_within_roundoff(
   CHECK(approx(lambdas2[0][0]) == 1.0);
   CHECK(approx(lambdas2[0][1]) == 1.0);
 }
+
+void test_long_history() noexcept {
+  // x**3 with the third derivative updated to its constant value, so the
+  // function is the same before and after every update
+  constexpr size_t deriv_order = 3;
+  const std::array<DataVector, deriv_order + 1> init_func{
+      {{0.0}, {0.0}, {0.0}, {6.0}}};
+  FunctionsOfTime::PiecewisePolynomial<deriv_order> f_of_t(0.0, init_func,
+                                                           0.5);
+  for (size_t i = 1; i < 100; ++i) {
+    f_of_t.update(0.5 * i, {6.0}, 0.5 * (i + 1));
+  }
+  // Evaluate within the most recent updates and further back in the history
+  for (const double t : {49.9, 49.5, 49.2, 48.2, 0.3, 12.0, 50.0, 0.0}) {
+    CAPTURE(t);
+    const auto lambdas = f_of_t.func_and_2_derivs(t);
+    CHECK(approx(lambdas[0][0]) == cube(t));
+    CHECK(approx(lambdas[1][0]) == 3.0 * square(t));
+    CHECK(approx(lambdas[2][0]) == 6.0 * t);
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.PiecewisePolynomial",
@@ -224,6 +245,8 @@ SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.PiecewisePolynomial",
     test_within_roundoff<deriv_order>(f_of_t);
     test_within_roundoff<deriv_order>(f_of_t2);
   }
+
+  test_long_history();
 }
 
 // [[OutputRegex, t must be increasing from call to call. Attempted to update at
@@ -0,0 +1,155 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <pup.h>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/BlockSearchGrid.hpp"
+#include "Domain/CoordinateMaps/Affine.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
+#include "Domain/CoordinateMaps/TimeDependent/Translation.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/DomainHelpers.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/MakeVector.hpp"
+
+namespace domain {
+namespace {
+using Affine = CoordinateMaps::Affine;
+using Translation = CoordinateMaps::TimeDependent::Translation;
+
+Domain<1> two_intervals() noexcept {
+  return Domain<1>{
+      make_vector<std::unique_ptr<
+          CoordinateMapBase<Frame::Logical, Frame::Inertial, 1>>>(
+          make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+              Affine{-1., 1., -2., 0.}),
+          make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+              Affine{-1., 1., 0., 2.})),
+      std::vector<std::array<size_t, 2>>{{{1, 2}}, {{2, 3}}}};
+}
+
+std::vector<size_t> candidates(const BlockSearchGrid<1>& search_grid,
+                               const double x) noexcept {
+  return search_grid.candidate_blocks(tnsr::I<double, 1, Frame::Grid>{x});
+}
+
+void test_bounding_boxes() noexcept {
+  const auto domain = two_intervals();
+  for (const auto& search_grid :
+       {domain.block_search_grid(),
+        serialize_and_deserialize(domain).block_search_grid()}) {
+    // The boxes are padded by the spacing of the samples of the maps
+    CHECK(search_grid.lower_bounds(0)[0] == approx(-2.25));
+    CHECK(search_grid.upper_bounds(0)[0] == approx(0.25));
+    CHECK(search_grid.lower_bounds(1)[0] == approx(-0.25));
+    CHECK(search_grid.upper_bounds(1)[0] == approx(2.25));
+    CHECK(search_grid.bounding_box_contains(
+        0, tnsr::I<double, 1, Frame::Grid>{-1.0}));
+    CHECK_FALSE(search_grid.bounding_box_contains(
+        1, tnsr::I<double, 1, Frame::Grid>{-1.0}));
+
+    CHECK(candidates(search_grid, -2.0) == std::vector<size_t>{0});
+    CHECK(candidates(search_grid, 0.0) == std::vector<size_t>{0, 1});
+    CHECK(candidates(search_grid, 2.0) == std::vector<size_t>{1});
+    CHECK(candidates(search_grid, 5.0).empty());
+    CHECK(candidates(search_grid, -5.0).empty());
+  }
+
+  // Every point in a block has that block as a candidate
+  Domain<2> domain_2d(
+      maps_for_rectilinear_domains<Frame::Inertial>(
+          Index<2>{3, 2},
+          std::array<std::vector<double>, 2>{
+              {{0.0, 0.5, 1.0, 3.0}, {-1.0, 0.0, 0.1}}},
+          {}, {}, true),
+      corners_for_rectilinear_domains(Index<2>{3, 2}));
+  const auto& search_grid = domain_2d.block_search_grid();
+  CHECK(search_grid.blocks_share_grid_to_inertial_map());
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+  for (const auto& block : domain_2d.blocks()) {
+    for (size_t s = 0; s < 20; ++s) {
+      const auto x = block.stationary_map()(
+          tnsr::I<double, 2, Frame::Logical>{{{dist(gen), dist(gen)}}});
+      const tnsr::I<double, 2, Frame::Grid> x_grid{{{get<0>(x), get<1>(x)}}};
+      const auto& candidate_blocks = search_grid.candidate_blocks(x_grid);
+      CHECK(alg::found(candidate_blocks, block.id()));
+      CHECK(search_grid.bounding_box_contains(block.id(), x_grid));
+    }
+  }
+}
+
+void test_time_dependent_blocks() noexcept {
+  auto domain = two_intervals();
+  CHECK(domain.block_search_grid().blocks_share_grid_to_inertial_map());
+  CHECK(domain.block_search_grid().grid_to_inertial_map_group(1) == 0);
+
+  domain.inject_time_dependent_map_for_block(
+      0, make_coordinate_map_base<Frame::Grid, Frame::Inertial>(
+             Translation{"Translation0"}));
+  for (const auto& search_grid :
+       {domain.block_search_grid(),
+        serialize_and_deserialize(domain).block_search_grid()}) {
+    CHECK_FALSE(search_grid.blocks_share_grid_to_inertial_map());
+    CHECK(search_grid.grid_to_inertial_map_group(0) == 0);
+    CHECK(search_grid.grid_to_inertial_map_group(1) == 1);
+    // The grid frame of the block did not change
+    CHECK(search_grid.lower_bounds(0)[0] == approx(-2.25));
+  }
+
+  std::unordered_map<std::string,
+                     std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>
+      functions_of_time{};
+  functions_of_time["Translation0"] =
+      std::make_unique<domain::FunctionsOfTime::PiecewisePolynomial<2>>(
+          1.0, std::array<DataVector, 3>{{{0.0}, {2.3}, {0.0}}}, 10.0);
+  // Block 0 covers [0.3, 2.3] and block 1 covers [0, 2] at this time, and
+  // points in both are assigned to block 0.
+  const tnsr::I<DataVector, 1, Frame::Inertial> x{{{{1.0, 0.1, 2.2, -1.0}}}};
+  const auto block_logical_coords =
+      block_logical_coordinates(domain, x, 2.0, functions_of_time);
+  REQUIRE(block_logical_coords.size() == 4);
+  CHECK(block_logical_coords[0].value().id.get_index() == 0);
+  CHECK(get<0>(block_logical_coords[0].value().data) == approx(-0.3));
+  CHECK(block_logical_coords[1].value().id.get_index() == 1);
+  CHECK(get<0>(block_logical_coords[1].value().data) == approx(-0.9));
+  CHECK(block_logical_coords[2].value().id.get_index() == 0);
+  CHECK(get<0>(block_logical_coords[2].value().data) == approx(0.9));
+  CHECK_FALSE(block_logical_coords[3].has_value());
+
+  domain.inject_time_dependent_map_for_block(
+      1, make_coordinate_map_base<Frame::Grid, Frame::Inertial>(
+             Translation{"Translation0"}));
+  CHECK(domain.block_search_grid().blocks_share_grid_to_inertial_map());
+  CHECK(domain.block_search_grid().grid_to_inertial_map_group(1) == 0);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.BlockSearchGrid", "[Domain][Unit]") {
+  PUPable_reg(
+      SINGLE_ARG(CoordinateMap<Frame::Logical, Frame::Inertial, Affine>));
+  PUPable_reg(SINGLE_ARG(CoordinateMap<Frame::Logical, Frame::Grid, Affine>));
+  PUPable_reg(
+      SINGLE_ARG(CoordinateMap<Frame::Grid, Frame::Inertial, Translation>));
+
+  test_bounding_boxes();
+  test_time_dependent_blocks();
+}
+}  // namespace domain
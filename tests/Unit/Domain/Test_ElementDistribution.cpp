@@ -0,0 +1,130 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <unordered_set>
+#include <vector>
+
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+
+namespace domain {
+namespace {
+void test_z_curve_index() noexcept {
+  CHECK(z_curve_index(ElementId<1>{0, {{{3, 5}}}}) == 5);
+  // The bits of the segment indices are interleaved, starting with the most
+  // significant bit and the first dimension
+  CHECK(z_curve_index(ElementId<2>{0, {{{2, 0}, {2, 0}}}}) == 0);
+  CHECK(z_curve_index(ElementId<2>{0, {{{2, 0}, {2, 1}}}}) == 1);
+  CHECK(z_curve_index(ElementId<2>{0, {{{2, 1}, {2, 0}}}}) == 2);
+  CHECK(z_curve_index(ElementId<2>{0, {{{2, 1}, {2, 1}}}}) == 3);
+  CHECK(z_curve_index(ElementId<2>{0, {{{2, 2}, {2, 1}}}}) == 9);
+  CHECK(z_curve_index(ElementId<2>{0, {{{2, 3}, {2, 3}}}}) == 15);
+  // Segments with a lower refinement level are rescaled to the finest level
+  CHECK(z_curve_index(ElementId<2>{0, {{{1, 1}, {2, 1}}}}) == 9);
+  CHECK(z_curve_index(ElementId<3>{0, {{{1, 1}, {1, 0}, {1, 1}}}}) == 5);
+
+  // The index enumerates the elements of a block
+  const auto element_ids = initial_element_ids<3>(0, {{2, 1, 2}});
+  std::unordered_set<size_t> indices{};
+  for (const auto& element_id : element_ids) {
+    indices.insert(z_curve_index(element_id));
+  }
+  CHECK(indices.size() == element_ids.size());
+  CHECK(*std::max_element(indices.begin(), indices.end()) < 64);
+}
+
+template <size_t Dim>
+void check_distribution(
+    const std::vector<size_t>& procs_per_node,
+    const std::vector<std::array<size_t, Dim>>& refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& extents,
+    const double max_imbalance) noexcept {
+  const BlockZCurveProcDistribution<Dim> distribution{
+      procs_per_node, refinement_levels, extents};
+  const auto& element_procs = distribution.element_procs();
+  const auto& proc_costs = distribution.proc_costs();
+  const size_t number_of_procs =
+      std::accumulate(procs_per_node.begin(), procs_per_node.end(), size_t{0});
+  REQUIRE(proc_costs.size() == number_of_procs);
+
+  // Every element is placed once, in order of blocks and along the curve,
+  // and the processors increase along the curve
+  const auto element_ids = initial_element_ids(refinement_levels);
+  REQUIRE(element_procs.size() == element_ids.size());
+  std::unordered_set<ElementId<Dim>> placed_ids{};
+  double total_cost = 0.;
+  for (size_t i = 0; i < element_procs.size(); ++i) {
+    const auto& [element_id, proc] = element_procs[i];
+    placed_ids.insert(element_id);
+    CHECK(proc < number_of_procs);
+    const auto& block_extents = extents[element_id.block_id()];
+    total_cost += std::accumulate(block_extents.begin(), block_extents.end(),
+                                  1., std::multiplies<>{});
+    if (i > 0) {
+      const auto& [previous_id, previous_proc] = element_procs[i - 1];
+      CHECK(previous_proc <= proc);
+      CHECK((previous_id.block_id() < element_id.block_id() or
+             (previous_id.block_id() == element_id.block_id() and
+              z_curve_index(previous_id) < z_curve_index(element_id))));
+    }
+  }
+  CHECK(placed_ids.size() == element_ids.size());
+  CHECK(std::accumulate(proc_costs.begin(), proc_costs.end(), 0.) ==
+        approx(total_cost));
+
+  // The load is balanced
+  const double average_cost = total_cost / static_cast<double>(number_of_procs);
+  CHECK(*std::max_element(proc_costs.begin(), proc_costs.end()) <=
+        (1. + max_imbalance) * average_cost);
+}
+
+void test_distribution() noexcept {
+  // Same cost everywhere, divides evenly
+  check_distribution<2>({4}, {{{2, 2}}, {{2, 2}}}, {{{4, 4}}, {{4, 4}}}, 0.);
+  check_distribution<3>({2, 2}, {{{1, 1, 1}}, {{1, 1, 1}}},
+                        {{{3, 3, 3}}, {{3, 3, 3}}}, 0.);
+  // Elements of different cost
+  check_distribution<3>({2, 3}, {{{2, 2, 2}}, {{1, 1, 1}}, {{2, 1, 1}}},
+                        {{{4, 4, 4}}, {{8, 8, 8}}, {{5, 6, 7}}}, 0.15);
+  // More processors than elements
+  check_distribution<1>({3, 3}, {{{1}}}, {{{5}}}, 2.5);
+  check_distribution<1>({1}, {{{0}}, {{3}}}, {{{5}}, {{3}}}, 0.);
+
+  {
+    INFO("Expensive elements get a processor of their own");
+    const BlockZCurveProcDistribution<1> distribution{
+        {2}, {{{0}}, {{2}}}, {{{12}}, {{3}}}};
+    const auto& element_procs = distribution.element_procs();
+    REQUIRE(element_procs.size() == 5);
+    CHECK(element_procs[0].second == 0);
+    for (size_t i = 1; i < element_procs.size(); ++i) {
+      CHECK(element_procs[i].second == 1);
+    }
+    CHECK(distribution.proc_costs() == std::vector<double>{12., 12.});
+  }
+  {
+    INFO("Nodes get contiguous parts of the curve proportional to their size");
+    const BlockZCurveProcDistribution<2> distribution{
+        {1, 3}, {{{2, 2}}}, {{{3, 3}}}};
+    const auto& element_procs = distribution.element_procs();
+    for (size_t i = 0; i < element_procs.size(); ++i) {
+      CHECK(element_procs[i].second == i / 4);
+    }
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
+  test_z_curve_index();
+  test_distribution();
+}
+}  // namespace domain
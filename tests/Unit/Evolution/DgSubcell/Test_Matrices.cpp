@@ -13,6 +13,8 @@
 #include "DataStructures/Tensor/Tensor.hpp"  // IWYU pragma: keep
 #include "Domain/LogicalCoordinates.hpp"
 #include "Evolution/DgSubcell/Matrices.hpp"
+#include "Evolution/DgSubcell/Projection.hpp"
+#include "Evolution/DgSubcell/Reconstruction.hpp"
 #include "Helpers/Evolution/DgSubcell/ProjectionTestHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
@@ -106,6 +108,48 @@ void reconstruction_matrix(const double eps) noexcept {
   }
 }
 
+// Projection and reconstruction apply the tensor-product factors of the
+// full-volume matrices, so check they act like the full-volume matrices
+template <size_t MaxPts, size_t Dim, Spectral::Quadrature QuadratureType>
+void test_factored_operators() noexcept {
+  CAPTURE(Dim);
+  CAPTURE(QuadratureType);
+  Approx local_approx = Approx::custom().epsilon(1.0e-11).scale(1.);
+  for (size_t num_pts_1d = 2; num_pts_1d < MaxPts + 1; ++num_pts_1d) {
+    CAPTURE(num_pts_1d);
+    const Mesh<Dim> dg_mesh{num_pts_1d, Spectral::Basis::Legendre,
+                            QuadratureType};
+    const Index<Dim> subcell_extents{2 * num_pts_1d - 1};
+    const size_t num_pts = dg_mesh.number_of_grid_points();
+    const size_t num_subcells = subcell_extents.product();
+
+    const Matrix& proj_matrix = projection_matrix(dg_mesh, subcell_extents);
+    DataVector dg_unit_vector(num_pts, 0.0);
+    for (size_t j = 0; j < num_pts; ++j) {
+      dg_unit_vector[j] = 1.0;
+      const DataVector projected =
+          project(dg_unit_vector, dg_mesh, subcell_extents);
+      dg_unit_vector[j] = 0.0;
+      for (size_t i = 0; i < num_subcells; ++i) {
+        CHECK(projected[i] == local_approx(proj_matrix(i, j)));
+      }
+    }
+
+    const Matrix& recons_matrix =
+        subcell::fd::reconstruction_matrix(dg_mesh, subcell_extents);
+    DataVector subcell_unit_vector(num_subcells, 0.0);
+    for (size_t j = 0; j < num_subcells; ++j) {
+      subcell_unit_vector[j] = 1.0;
+      const DataVector reconstructed =
+          reconstruct(subcell_unit_vector, dg_mesh, subcell_extents);
+      subcell_unit_vector[j] = 0.0;
+      for (size_t i = 0; i < num_pts; ++i) {
+        CHECK(reconstructed[i] == local_approx(recons_matrix(i, j)));
+      }
+    }
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.Evolution.Subcell.Fd.ProjectionMatrix",
                   "[Evolution][Unit]") {
   test_projection_matrix<10, 1, Spectral::Basis::Legendre,
@@ -146,5 +190,15 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.Fd.ReconstructionMatrix",
   reconstruction_matrix<4, 3, Spectral::Basis::Legendre,
                         Spectral::Quadrature::Gauss>(1.0e-11);
 }
+
+SPECTRE_TEST_CASE("Unit.Evolution.Subcell.Fd.FactoredMatrices",
+                  "[Evolution][Unit]") {
+  test_factored_operators<8, 1, Spectral::Quadrature::GaussLobatto>();
+  test_factored_operators<8, 1, Spectral::Quadrature::Gauss>();
+  test_factored_operators<5, 2, Spectral::Quadrature::GaussLobatto>();
+  test_factored_operators<5, 2, Spectral::Quadrature::Gauss>();
+  test_factored_operators<3, 3, Spectral::Quadrature::GaussLobatto>();
+  test_factored_operators<3, 3, Spectral::Quadrature::Gauss>();
+}
 }  // namespace
 }  // namespace evolution::dg::subcell::fd
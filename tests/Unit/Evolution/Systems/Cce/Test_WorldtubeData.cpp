@@ -4,6 +4,7 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <vector>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -364,7 +365,8 @@ template <typename DataManager, typename DummyUpdater, typename Generator>
 void test_data_manager_with_dummy_buffer_updater(
     const gsl::not_null<Generator*> gen,
     const bool apply_normalization_bug = false, const bool is_spec_input = true,
-    const std::optional<double> extraction_radius = std::nullopt) noexcept {
+    const std::optional<double> extraction_radius = std::nullopt,
+    const size_t prefetch_depth = 0) noexcept {
   // note that the default_extraction_radius is what will be reported
   // from the buffer updater when the extraction_radius is the default
   // `std::nullopt`.
@@ -402,7 +404,7 @@ void test_data_manager_with_dummy_buffer_updater(
               l_max, false, is_spec_input),
           l_max, buffer_size,
           std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
-          is_spec_input};
+          is_spec_input, prefetch_depth};
     } else {
       boundary_data_manager = DataManager{
           std::make_unique<DummyUpdater>(time_buffer, solution,
@@ -410,7 +412,7 @@ void test_data_manager_with_dummy_buffer_updater(
                                          frequency, l_max, true, false),
           l_max, buffer_size,
           std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
-          is_spec_input};
+          is_spec_input, prefetch_depth};
     }
   } else {
     // avoid compiler warnings in the case where the normalization bug booleans
@@ -421,7 +423,8 @@ void test_data_manager_with_dummy_buffer_updater(
         std::make_unique<DummyUpdater>(time_buffer, solution, extraction_radius,
                                        amplitude, frequency, l_max, false),
         l_max, buffer_size,
-        std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u)};
+        std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
+        prefetch_depth};
   }
   const size_t number_of_angular_points =
       Spectral::Swsh::number_of_swsh_collocation_points(l_max);
@@ -431,57 +434,74 @@ void test_data_manager_with_dummy_buffer_updater(
   Variables<Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>
       interpolated_boundary_variables{number_of_angular_points};
 
+  // with prefetching, step through several buffer updates to check that the
+  // prefetched buffers are used correctly
+  std::vector<double> check_times{target_time};
+  if (prefetch_depth > 0) {
+    check_times.clear();
+    for (size_t i = 0; i < 14; ++i) {
+      check_times.push_back(target_time - 1.0 + 0.15 * static_cast<double>(i));
+    }
+  }
   Parallel::NodeLock hdf5_lock{};
-  boundary_data_manager.populate_hypersurface_boundary_data(
-      make_not_null(&interpolated_boundary_variables), target_time,
-      make_not_null(&hdf5_lock));
-
-  // populate the expected variables with the result from the analytic modes
-  // passed to the boundary data computation.
-  const size_t libsharp_size =
-      Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max);
-  tnsr::ii<ComplexModalVector, 3> spatial_metric_coefficients{libsharp_size};
-  tnsr::ii<ComplexModalVector, 3> dt_spatial_metric_coefficients{libsharp_size};
-  tnsr::ii<ComplexModalVector, 3> dr_spatial_metric_coefficients{libsharp_size};
-  tnsr::I<ComplexModalVector, 3> shift_coefficients{libsharp_size};
-  tnsr::I<ComplexModalVector, 3> dt_shift_coefficients{libsharp_size};
-  tnsr::I<ComplexModalVector, 3> dr_shift_coefficients{libsharp_size};
-  Scalar<ComplexModalVector> lapse_coefficients{libsharp_size};
-  Scalar<ComplexModalVector> dt_lapse_coefficients{libsharp_size};
-  Scalar<ComplexModalVector> dr_lapse_coefficients{libsharp_size};
-  TestHelpers::create_fake_time_varying_modal_data(
-      make_not_null(&spatial_metric_coefficients),
-      make_not_null(&dt_spatial_metric_coefficients),
-      make_not_null(&dr_spatial_metric_coefficients),
-      make_not_null(&shift_coefficients), make_not_null(&dt_shift_coefficients),
-      make_not_null(&dr_shift_coefficients), make_not_null(&lapse_coefficients),
-      make_not_null(&dt_lapse_coefficients),
-      make_not_null(&dr_lapse_coefficients), solution,
-      extraction_radius.value_or(default_extraction_radius), amplitude,
-      frequency, target_time, l_max, false);
-
-  create_bondi_boundary_data(
-      make_not_null(&expected_boundary_variables), spatial_metric_coefficients,
-      dt_spatial_metric_coefficients, dr_spatial_metric_coefficients,
-      shift_coefficients, dt_shift_coefficients, dr_shift_coefficients,
-      lapse_coefficients, dt_lapse_coefficients, dr_lapse_coefficients,
-      extraction_radius.value_or(default_extraction_radius), l_max);
-  Approx angular_derivative_approx =
-      Approx::custom()
-          .epsilon(std::numeric_limits<double>::epsilon() * 1.0e4)
-          .scale(1.0);
-
-  tmpl::for_each<
-      Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>(
-      [&expected_boundary_variables, &interpolated_boundary_variables,
-       &angular_derivative_approx](auto tag_v) {
-        using tag = typename decltype(tag_v)::type;
-        INFO(db::tag_name<tag>());
-        const auto& test_lhs = get<tag>(expected_boundary_variables);
-        const auto& test_rhs = get<tag>(interpolated_boundary_variables);
-        CHECK_ITERABLE_CUSTOM_APPROX(test_lhs, test_rhs,
-                                     angular_derivative_approx);
-      });
+  for (const double check_time : check_times) {
+    CAPTURE(check_time);
+    boundary_data_manager.populate_hypersurface_boundary_data(
+        make_not_null(&interpolated_boundary_variables), check_time,
+        make_not_null(&hdf5_lock));
+
+    // populate the expected variables with the result from the analytic modes
+    // passed to the boundary data computation.
+    const size_t libsharp_size =
+        Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max);
+    tnsr::ii<ComplexModalVector, 3> spatial_metric_coefficients{libsharp_size};
+    tnsr::ii<ComplexModalVector, 3> dt_spatial_metric_coefficients{
+        libsharp_size};
+    tnsr::ii<ComplexModalVector, 3> dr_spatial_metric_coefficients{
+        libsharp_size};
+    tnsr::I<ComplexModalVector, 3> shift_coefficients{libsharp_size};
+    tnsr::I<ComplexModalVector, 3> dt_shift_coefficients{libsharp_size};
+    tnsr::I<ComplexModalVector, 3> dr_shift_coefficients{libsharp_size};
+    Scalar<ComplexModalVector> lapse_coefficients{libsharp_size};
+    Scalar<ComplexModalVector> dt_lapse_coefficients{libsharp_size};
+    Scalar<ComplexModalVector> dr_lapse_coefficients{libsharp_size};
+    TestHelpers::create_fake_time_varying_modal_data(
+        make_not_null(&spatial_metric_coefficients),
+        make_not_null(&dt_spatial_metric_coefficients),
+        make_not_null(&dr_spatial_metric_coefficients),
+        make_not_null(&shift_coefficients),
+        make_not_null(&dt_shift_coefficients),
+        make_not_null(&dr_shift_coefficients),
+        make_not_null(&lapse_coefficients),
+        make_not_null(&dt_lapse_coefficients),
+        make_not_null(&dr_lapse_coefficients), solution,
+        extraction_radius.value_or(default_extraction_radius), amplitude,
+        frequency, check_time, l_max, false);
+
+    create_bondi_boundary_data(
+        make_not_null(&expected_boundary_variables),
+        spatial_metric_coefficients, dt_spatial_metric_coefficients,
+        dr_spatial_metric_coefficients,
+        shift_coefficients, dt_shift_coefficients, dr_shift_coefficients,
+        lapse_coefficients, dt_lapse_coefficients, dr_lapse_coefficients,
+        extraction_radius.value_or(default_extraction_radius), l_max);
+    Approx angular_derivative_approx =
+        Approx::custom()
+            .epsilon(std::numeric_limits<double>::epsilon() * 1.0e4)
+            .scale(1.0);
+
+    tmpl::for_each<
+        Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>(
+        [&expected_boundary_variables, &interpolated_boundary_variables,
+         &angular_derivative_approx](auto tag_v) {
+          using tag = typename decltype(tag_v)::type;
+          INFO(db::tag_name<tag>());
+          const auto& test_lhs = get<tag>(expected_boundary_variables);
+          const auto& test_rhs = get<tag>(interpolated_boundary_variables);
+          CHECK_ITERABLE_CUSTOM_APPROX(test_lhs, test_rhs,
+                                       angular_derivative_approx);
+        });
+  }
 }
 
 template <typename Generator>
@@ -826,5 +846,14 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.ReadBoundaryDataH5",
                                                 ReducedDummyBufferUpdater>(
         make_not_null(&gen));
   }
+  {
+    INFO("Testing data managers with prefetching");
+    test_data_manager_with_dummy_buffer_updater<MetricWorldtubeDataManager,
+                                                DummyBufferUpdater>(
+        make_not_null(&gen), false, true, std::nullopt, 2);
+    test_data_manager_with_dummy_buffer_updater<BondiWorldtubeDataManager,
+                                                ReducedDummyBufferUpdater>(
+        make_not_null(&gen), false, true, std::nullopt, 1);
+  }
 }
 }  // namespace Cce
@@ -7,12 +7,15 @@
 #include <cstddef>
 #include <limits>
 #include <random>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/PointwiseFunctions/GeneralRelativity/TestHelpers.hpp"
 #include "Helpers/PointwiseFunctions/Hydro/TestHelpers.hpp"
@@ -29,7 +32,6 @@
 
 namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
 class NewmanHamlin;
-class PalenzuelaEtAl;
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
 
 namespace {
@@ -228,6 +230,118 @@ void test_primitive_from_conservative_known(
                         divergence_cleaning_field);
 }
 
+template <size_t ThermodynamicDim>
+void test_batched_palenzuela(
+    const gsl::not_null<std::mt19937*> generator,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state,
+    const DataVector& used_for_size) noexcept {
+  // Flat space, velocity along x, and the magnetic field in the x-y plane
+  const auto expected_rest_mass_density =
+      TestHelpers::hydro::random_density(generator, used_for_size);
+  const auto expected_lorentz_factor =
+      TestHelpers::hydro::random_lorentz_factor(generator, used_for_size);
+  Scalar<DataVector> specific_internal_energy{};
+  Scalar<DataVector> expected_pressure{};
+  if constexpr (ThermodynamicDim == 1) {
+    specific_internal_energy =
+        equation_of_state.specific_internal_energy_from_density(
+            expected_rest_mass_density);
+    expected_pressure =
+        equation_of_state.pressure_from_density(expected_rest_mass_density);
+  } else if constexpr (ThermodynamicDim == 2) {
+    specific_internal_energy =
+        TestHelpers::hydro::random_specific_internal_energy(generator,
+                                                            used_for_size);
+    expected_pressure = equation_of_state.pressure_from_density_and_energy(
+        expected_rest_mass_density, specific_internal_energy);
+  }
+  const DataVector& rest_mass_density = get(expected_rest_mass_density);
+  const DataVector& lorentz_factor = get(expected_lorentz_factor);
+  const DataVector& pressure = get(expected_pressure);
+  const DataVector expected_rho_h_w_squared =
+      get(hydro::relativistic_specific_enthalpy(expected_rest_mass_density,
+                                                specific_internal_energy,
+                                                expected_pressure)) *
+      rest_mass_density * square(lorentz_factor);
+  const DataVector velocity = sqrt(1.0 - 1.0 / square(lorentz_factor));
+  const DataVector magnetic_field_x = sqrt(pressure);
+  const DataVector magnetic_field_y = 2.0 * sqrt(pressure);
+  const DataVector magnetic_field_squared =
+      square(magnetic_field_x) + square(magnetic_field_y);
+  const DataVector velocity_dot_magnetic_field = velocity * magnetic_field_x;
+  const DataVector momentum_density_x =
+      (expected_rho_h_w_squared + magnetic_field_squared) * velocity -
+      velocity_dot_magnetic_field * magnetic_field_x;
+  const DataVector momentum_density_y =
+      -velocity_dot_magnetic_field * magnetic_field_y;
+  const DataVector momentum_density_squared =
+      square(momentum_density_x) + square(momentum_density_y);
+  const DataVector momentum_density_dot_magnetic_field =
+      momentum_density_x * magnetic_field_x +
+      momentum_density_y * magnetic_field_y;
+  DataVector total_energy_density =
+      expected_rho_h_w_squared - pressure +
+      0.5 * magnetic_field_squared * (1.0 + square(velocity)) -
+      0.5 * square(velocity_dot_magnetic_field);
+  const DataVector rest_mass_density_times_lorentz_factor =
+      rest_mass_density * lorentz_factor;
+  // An unphysical point at which the recovery must fail
+  const size_t bad_point = used_for_size.size() / 2;
+  total_energy_density[bad_point] = -1.0;
+
+  const size_t number_of_points = used_for_size.size();
+  DataVector recovered_rest_mass_density(number_of_points, -1.0);
+  DataVector recovered_lorentz_factor(number_of_points, -1.0);
+  DataVector recovered_pressure(number_of_points, -1.0);
+  DataVector recovered_rho_h_w_squared(number_of_points, -1.0);
+  const std::vector<size_t> failed_points = grmhd::ValenciaDivClean::
+      PrimitiveRecoverySchemes::PalenzuelaEtAl::apply<ThermodynamicDim>(
+          make_not_null(&recovered_rest_mass_density),
+          make_not_null(&recovered_lorentz_factor),
+          make_not_null(&recovered_pressure),
+          make_not_null(&recovered_rho_h_w_squared), total_energy_density,
+          momentum_density_squared, momentum_density_dot_magnetic_field,
+          magnetic_field_squared, rest_mass_density_times_lorentz_factor,
+          equation_of_state);
+  CHECK(failed_points == std::vector<size_t>{bad_point});
+
+  Approx larger_approx =
+      Approx::custom().epsilon(std::numeric_limits<double>::epsilon() * 1.e8);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    CAPTURE(s);
+    if (s == bad_point) {
+      // The outputs at failed points are left untouched
+      CHECK(recovered_rest_mass_density[s] == -1.0);
+      CHECK(recovered_lorentz_factor[s] == -1.0);
+      CHECK(recovered_pressure[s] == -1.0);
+      CHECK(recovered_rho_h_w_squared[s] == -1.0);
+      continue;
+    }
+    CHECK(recovered_rest_mass_density[s] ==
+          larger_approx(rest_mass_density[s]));
+    CHECK(recovered_lorentz_factor[s] == larger_approx(lorentz_factor[s]));
+    CHECK(recovered_pressure[s] == larger_approx(pressure[s]));
+    CHECK(recovered_rho_h_w_squared[s] ==
+          larger_approx(expected_rho_h_w_squared[s]));
+
+    // The batched and pointwise recoveries agree
+    const auto pointwise_data = grmhd::ValenciaDivClean::
+        PrimitiveRecoverySchemes::PalenzuelaEtAl::apply<ThermodynamicDim>(
+            0.0, total_energy_density[s], momentum_density_squared[s],
+            momentum_density_dot_magnetic_field[s], magnetic_field_squared[s],
+            rest_mass_density_times_lorentz_factor[s], equation_of_state);
+    REQUIRE(pointwise_data.has_value());
+    CHECK(recovered_rest_mass_density[s] ==
+          larger_approx(pointwise_data.value().rest_mass_density));
+    CHECK(recovered_lorentz_factor[s] ==
+          larger_approx(pointwise_data.value().lorentz_factor));
+    CHECK(recovered_pressure[s] ==
+          larger_approx(pointwise_data.value().pressure));
+    CHECK(recovered_rho_h_w_squared[s] ==
+          larger_approx(pointwise_data.value().rho_h_w_squared));
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
@@ -257,4 +371,13 @@ SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
       tmpl::list<
           grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>,
       2>(&generator, ideal_fluid, dv);
+  const DataVector larger_dv(50);
+  test_primitive_from_conservative_random<
+      tmpl::list<
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl,
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin>,
+      2>(&generator, ideal_fluid, larger_dv);
+  test_batched_palenzuela(make_not_null(&generator), polytropic_fluid,
+                          larger_dv);
+  test_batched_palenzuela(make_not_null(&generator), ideal_fluid, larger_dv);
 }
@@ -29,4 +29,47 @@ def hydro_coupling_tilde_s(emissivity, absorption_opacity, scattering_opacity,
     return result
 
 
+def implicit_coupling_comoving_moments(tilde_e, tilde_s, tilde_p,
+                                       fluid_velocity, lorentz_factor,
+                                       spatial_metric):
+    v_lower = np.einsum("a, ia", fluid_velocity, spatial_metric)
+    tilde_j = lorentz_factor**2 * (
+        tilde_e - 2. * np.einsum("a, a", fluid_velocity, tilde_s) +
+        np.einsum("a, b, ab", v_lower, v_lower, tilde_p))
+    tilde_hn = lorentz_factor * (tilde_j - tilde_e +
+                                 np.einsum("a, a", fluid_velocity, tilde_s))
+    tilde_hi = lorentz_factor * (
+        tilde_s - np.einsum("ia, ab, b", spatial_metric, tilde_p, v_lower)
+    ) - lorentz_factor * tilde_j * v_lower
+    return tilde_j, tilde_hn, tilde_hi
+
+
+def implicit_coupling_tilde_e(tilde_e, tilde_s, emissivity,
+                              absorption_opacity, scattering_opacity, tilde_p,
+                              fluid_velocity, lorentz_factor, lapse,
+                              spatial_metric, sqrt_det_spatial_metric):
+    tilde_j, tilde_hn, tilde_hi = implicit_coupling_comoving_moments(
+        tilde_e, tilde_s, tilde_p, fluid_velocity, lorentz_factor,
+        spatial_metric)
+    return hydro_coupling_tilde_e(emissivity, absorption_opacity,
+                                  scattering_opacity, tilde_j, tilde_hn,
+                                  tilde_hi, fluid_velocity, lorentz_factor,
+                                  lapse, spatial_metric,
+                                  sqrt_det_spatial_metric)
+
+
+def implicit_coupling_tilde_s(tilde_e, tilde_s, emissivity,
+                              absorption_opacity, scattering_opacity, tilde_p,
+                              fluid_velocity, lorentz_factor, lapse,
+                              spatial_metric, sqrt_det_spatial_metric):
+    tilde_j, tilde_hn, tilde_hi = implicit_coupling_comoving_moments(
+        tilde_e, tilde_s, tilde_p, fluid_velocity, lorentz_factor,
+        spatial_metric)
+    return hydro_coupling_tilde_s(emissivity, absorption_opacity,
+                                  scattering_opacity, tilde_j, tilde_hn,
+                                  tilde_hi, fluid_velocity, lorentz_factor,
+                                  lapse, spatial_metric,
+                                  sqrt_det_spatial_metric)
+
+
 # End of functions for testing M1HydroCoupling.cpp
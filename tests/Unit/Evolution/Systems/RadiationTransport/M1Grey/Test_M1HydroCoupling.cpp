@@ -3,15 +3,116 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
+#include <random>
 #include <string>
 
+#include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/Determinant.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/M1HydroCoupling.hpp"
 #include "Evolution/Systems/RadiationTransport/Tags.hpp"  // IWYU pragma: keep
 #include "Framework/CheckWithRandomValues.hpp"
 #include "Framework/SetupLocalPythonEnvironment.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Helpers/PointwiseFunctions/GeneralRelativity/TestHelpers.hpp"
+#include "Helpers/PointwiseFunctions/Hydro/TestHelpers.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "PointwiseFunctions/Hydro/Tags.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// Check that the implicit solve inverts u - w S(u) for physically sensible
+// backgrounds, where the closed-form elimination has to be well conditioned.
+void test_implicit_solve() noexcept {
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> dist(0.0, 1.0);
+  std::uniform_real_distribution<> opacity_dist(0.0, 100.0);
+  const DataVector used_for_size(5);
+
+  using neutrino_species = tmpl::list<neutrinos::ElectronNeutrinos<1>,
+                                      neutrinos::HeavyLeptonNeutrinos<0>>;
+  using implicit_sector =
+      RadiationTransport::M1Grey::ImplicitM1HydroCoupling<neutrino_species>;
+  using nux = neutrinos::HeavyLeptonNeutrinos<0>;
+
+  const auto lapse = TestHelpers::gr::random_lapse(&generator, used_for_size);
+  const auto spatial_metric =
+      TestHelpers::gr::random_spatial_metric<3>(&generator, used_for_size);
+  const auto sqrt_det_spatial_metric =
+      Scalar<DataVector>{sqrt(get(determinant(spatial_metric)))};
+  const auto lorentz_factor =
+      TestHelpers::hydro::random_lorentz_factor(&generator, used_for_size);
+  const auto fluid_velocity = TestHelpers::hydro::random_velocity(
+      &generator, lorentz_factor, spatial_metric);
+  const auto make_scalar = [&generator, &used_for_size](auto distribution) {
+    return make_with_random_values<Scalar<DataVector>>(
+        make_not_null(&generator), distribution, used_for_size);
+  };
+  const auto tilde_p_e = make_with_random_values<tnsr::II<DataVector, 3>>(
+      make_not_null(&generator), dist, used_for_size);
+  const auto tilde_p_x = make_with_random_values<tnsr::II<DataVector, 3>>(
+      make_not_null(&generator), dist, used_for_size);
+  const auto emissivity_e = make_scalar(dist);
+  const auto emissivity_x = make_scalar(dist);
+  const auto absorption_e = make_scalar(opacity_dist);
+  const auto absorption_x = make_scalar(opacity_dist);
+  const auto scattering_e = make_scalar(opacity_dist);
+  const auto scattering_x = make_scalar(opacity_dist);
+
+  using vars_type = Variables<implicit_sector::vars_tags>;
+  const auto initial_vars = make_with_random_values<vars_type>(
+      make_not_null(&generator), dist, used_for_size);
+
+  for (const double implicit_weight : {0.0, 1.0e-3, 0.5, 10.0}) {
+    auto vars = initial_vars;
+    implicit_sector::solve(
+        make_not_null(&vars), implicit_weight, emissivity_e, emissivity_x,
+        absorption_e, absorption_x, scattering_e, scattering_x, tilde_p_e,
+        tilde_p_x, fluid_velocity, lorentz_factor, lapse, spatial_metric,
+        sqrt_det_spatial_metric);
+    Variables<db::wrap_tags_in<::Tags::dt, implicit_sector::vars_tags>>
+        sources(used_for_size.size());
+    implicit_sector::source(
+        make_not_null(&sources), vars, emissivity_e, emissivity_x,
+        absorption_e, absorption_x, scattering_e, scattering_x, tilde_p_e,
+        tilde_p_x, fluid_velocity, lorentz_factor, lapse, spatial_metric,
+        sqrt_det_spatial_metric);
+    Approx custom_approx = Approx::custom().epsilon(1.0e-10).scale(1.0);
+    tmpl::for_each<implicit_sector::vars_tags>([&implicit_weight, &vars,
+                                                &sources, &initial_vars,
+                                                &custom_approx](auto tag_v) {
+      using tag = tmpl::type_from<decltype(tag_v)>;
+      auto residual = get<tag>(vars);
+      for (size_t i = 0; i < residual.size(); ++i) {
+        residual[i] -= implicit_weight * get<::Tags::dt<tag>>(sources)[i];
+      }
+      CHECK_ITERABLE_CUSTOM_APPROX(residual, get<tag>(initial_vars),
+                                   custom_approx);
+    });
+  }
+  // The species are solved independently, so a species with vanishing
+  // opacities and emissivity is left unchanged.
+  {
+    const auto zero = make_with_value<Scalar<DataVector>>(used_for_size, 0.0);
+    auto vars = initial_vars;
+    implicit_sector::solve(make_not_null(&vars), 0.5, emissivity_e, zero,
+                           absorption_e, zero, scattering_e, zero, tilde_p_e,
+                           tilde_p_x, fluid_velocity, lorentz_factor, lapse,
+                           spatial_metric, sqrt_det_spatial_metric);
+    using TildeEx =
+        RadiationTransport::M1Grey::Tags::TildeE<Frame::Inertial, nux>;
+    using TildeSx =
+        RadiationTransport::M1Grey::Tags::TildeS<Frame::Inertial, nux>;
+    CHECK_ITERABLE_APPROX(get<TildeEx>(vars), get<TildeEx>(initial_vars));
+    CHECK_ITERABLE_APPROX(get<TildeSx>(vars), get<TildeSx>(initial_vars));
+  }
+}
+}  // namespace
 
 SPECTRE_TEST_CASE("Unit.RadiationTransport.M1Grey.M1HydroCoupling",
                   "[Unit][M1Grey]") {
@@ -27,4 +128,13 @@ SPECTRE_TEST_CASE("Unit.RadiationTransport.M1Grey.M1HydroCoupling",
       &CouplingClass::apply, "M1HydroCoupling",
       {"hydro_coupling_tilde_e", "hydro_coupling_tilde_s"}, {{{0.0, 1.0}}},
       DataVector{5});
+
+  pypp::check_with_random_values<1>(
+      &RadiationTransport::M1Grey::detail::
+          compute_implicit_m1_hydro_coupling_impl,
+      "M1HydroCoupling",
+      {"implicit_coupling_tilde_e", "implicit_coupling_tilde_s"},
+      {{{0.0, 1.0}}}, DataVector{5});
+
+  test_implicit_solve();
 }
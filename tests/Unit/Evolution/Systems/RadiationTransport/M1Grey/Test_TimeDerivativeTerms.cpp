@@ -28,8 +28,6 @@ void forward_to_time_deriv(
     const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
     const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
 
-    const Scalar<DataVector>& source_n,
-    const tnsr::i<DataVector, 3, Frame::Inertial>& source_i,
     const tnsr::i<DataVector, 3>& d_lapse,
     const tnsr::iJ<DataVector, 3>& d_shift,
     const tnsr::ijj<DataVector, 3>& d_spatial_metric,
@@ -50,8 +48,7 @@ void forward_to_time_deriv(
           tilde_e, tilde_s, tilde_p, lapse, shift, spatial_metric,
           inv_spatial_metric,
 
-          source_n, source_i, d_lapse, d_shift, d_spatial_metric,
-          extrinsic_curvature);
+          d_lapse, d_shift, d_spatial_metric, extrinsic_curvature);
 }
 }  // namespace
 
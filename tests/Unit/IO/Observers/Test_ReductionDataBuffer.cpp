@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <string>
+#include <vector>
+
+#include "DataStructures/Matrix.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/Observer/ReductionDataBuffer.hpp"
+#include "Utilities/FileSystem.hpp"
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionDataBuffer",
+                  "[Unit][Observers]") {
+  const std::string file_prefix = "Unit.IO.Observers.ReductionDataBuffer";
+  const std::string file_name = file_prefix + ".h5";
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  const std::vector<std::string> errors_legend{"Time", "Error"};
+  const std::vector<std::string> norms_legend{"Time", "L2Norm", "LinfNorm"};
+
+  observers::ReductionDataBuffer buffer{3, 10.0};
+  CHECK(buffer.number_of_buffered_rows() == 0);
+  CHECK_FALSE(buffer.needs_flush(100.0));
+  // Flushing an empty buffer doesn't create the file
+  buffer.flush(file_prefix, 1.0);
+  CHECK_FALSE(file_system::check_if_file_exists(file_name));
+
+  buffer.append("/errors", errors_legend, {0.0, 1.0});
+  buffer.append("/norms", norms_legend, {0.0, 2.0, 3.0});
+  CHECK(buffer.number_of_buffered_rows() == 2);
+  CHECK_FALSE(buffer.needs_flush(2.0));
+  // Too much time has passed since the last flush
+  CHECK(buffer.needs_flush(11.0));
+  // Too many rows are buffered
+  buffer.append("/errors", errors_legend, {0.5, 4.0});
+  CHECK(buffer.needs_flush(2.0));
+
+  // The buffered rows are serialized, e.g. for checkpoints
+  buffer = serialize_and_deserialize(buffer);
+  CHECK(buffer.number_of_buffered_rows() == 3);
+  CHECK(buffer.needs_flush(2.0));
+
+  buffer.flush(file_prefix, 2.0);
+  CHECK(buffer.number_of_buffered_rows() == 0);
+  CHECK_FALSE(buffer.needs_flush(20.0));
+  buffer.append("/errors", errors_legend, {1.0, 5.0});
+  CHECK_FALSE(buffer.needs_flush(11.0));
+  CHECK(buffer.needs_flush(12.0));
+  buffer.flush(file_prefix, 12.0);
+
+  {
+    const h5::H5File<h5::AccessType::ReadOnly> file{file_name};
+    {
+      const auto& errors = file.get<h5::Dat>("/errors");
+      CHECK(errors.get_legend() == errors_legend);
+      CHECK(errors.get_data() == Matrix{{0.0, 1.0}, {0.5, 4.0}, {1.0, 5.0}});
+    }
+    const auto& norms = file.get<h5::Dat>("/norms");
+    CHECK(norms.get_legend() == norms_legend);
+    CHECK(norms.get_data() == Matrix{{0.0, 2.0, 3.0}});
+  }
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+
+// [[OutputRegex, The legend \(Time,Norm\) of the subfile /errors differs from
+// the legend \(Time,Error\)]]
+SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionDataBuffer.LegendMismatch",
+                  "[Unit][Observers]") {
+  ERROR_TEST();
+  observers::ReductionDataBuffer buffer{};
+  buffer.append("/errors", {"Time", "Error"}, {0.0, 1.0});
+  buffer.append("/errors", {"Time", "Norm"}, {1.0, 2.0});
+}
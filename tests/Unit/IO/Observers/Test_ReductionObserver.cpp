@@ -28,6 +28,8 @@
 #include "IO/Observer/Tags.hpp"               // IWYU pragma: keep
 #include "IO/Observer/TypeOfObservation.hpp"
 #include "Parallel/ArrayIndex.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
 #include "Parallel/Reduction.hpp"
 #include "Utilities/FileSystem.hpp"
 #include "Utilities/Gsl.hpp"
@@ -210,6 +212,16 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionObserver", "[Unit][Observers]") {
 
     runner.invoke_queued_threaded_action<obs_writer>(0);
 
+    // The reduction data is buffered by the writer until it is flushed
+    Parallel::local_synchronous_action<observers::Actions::FlushReductionData>(
+        Parallel::get_parallel_component<obs_writer>(
+            ActionTesting::cache<obs_writer>(runner, 0)),
+        output_file_prefix);
+    CHECK(ActionTesting::get_databox_tag<obs_writer,
+                                         observers::Tags::ReductionDataBuffer>(
+              runner, 0)
+              .number_of_buffered_rows() == 0);
+
     REQUIRE(file_system::check_if_file_exists(h5_file_name));
     // Check that the H5 file was written correctly.
     {
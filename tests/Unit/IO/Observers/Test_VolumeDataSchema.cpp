@@ -0,0 +1,32 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <string>
+#include <vector>
+
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/VolumeDataSchema.hpp"
+#include "Utilities/GetOutput.hpp"
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeDataSchema", "[Unit][Observers]") {
+  const std::vector<std::string> component_names{"Psi", "Phi_x", "Phi_y"};
+  const observers::VolumeDataSchema schema{component_names};
+  CHECK(schema.component_names() == component_names);
+  CHECK(schema.number_of_components() == 3);
+  CHECK(get_output(schema) == "(Psi,Phi_x,Phi_y)");
+  test_serialization(schema);
+  test_copy_semantics(schema);
+
+  CHECK(schema == observers::VolumeDataSchema{component_names});
+  CHECK(schema.id() == observers::VolumeDataSchema{component_names}.id());
+  // The order of the components is part of the schema
+  const observers::VolumeDataSchema reordered_schema{{"Phi_x", "Psi", "Phi_y"}};
+  CHECK(schema != reordered_schema);
+  CHECK(schema.id() != reordered_schema.id());
+  const observers::VolumeDataSchema fewer_components{{"Psi", "Phi_x"}};
+  CHECK(schema != fewer_components);
+  CHECK(schema.id() != fewer_components.id());
+  CHECK(observers::VolumeDataSchema{}.number_of_components() == 0);
+}
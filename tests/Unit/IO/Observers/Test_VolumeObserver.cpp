@@ -21,6 +21,7 @@
 #include "Framework/ActionTesting.hpp"
 #include "Helpers/IO/Observers/ObserverHelpers.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/ComponentStorage.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/VolumeData.hpp"
 #include "IO/Observer/Actions/ObserverRegistration.hpp"
@@ -32,6 +33,7 @@
 #include "IO/Observer/Tags.hpp"               // IWYU pragma: keep
 #include "IO/Observer/TypeOfObservation.hpp"
 #include "IO/Observer/VolumeActions.hpp"  // IWYU pragma: keep
+#include "IO/Observer/VolumeDataSchema.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/ArrayIndex.hpp"
 #include "Utilities/Algorithm.hpp"
@@ -155,12 +157,20 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
             /* get<2> = element bases */
             std::get<2>(volume_data_fakes),
             /* get<3> = element quadratures*/
-            std::get<3>(volume_data_fakes));
+            std::get<3>(volume_data_fakes), h5::ComponentStorage{});
   }
   // Invoke the simple action 'ContributeVolumeDataToWriter'
   // to move the volume data to the Writer parallel component.
   runner.invoke_queued_threaded_action<obs_writer>(0);
   CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 0));
+  // The names of the tensor components were split off the data and registered
+  // once with the writer
+  CHECK(ActionTesting::get_databox_tag<obs_writer,
+                                       observers::Tags::VolumeDataSchemas>(
+            runner, 0)
+            .at(observers::ObservationKey("ElementObservationType")) ==
+        observers::VolumeDataSchema{
+            {"T_x", "T_y", "S_xx", "S_xy", "S_yx", "S_yy"}});
 
   REQUIRE(file_system::check_if_file_exists(h5_file_name));
   // Check that the H5 file was written correctly.
@@ -5,21 +5,28 @@
 
 #include <algorithm>
 #include <boost/iterator/transform_iterator.hpp>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/ComponentStorage.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/VolumeData.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/FileSystem.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/Numeric.hpp"
 
@@ -276,6 +283,233 @@ SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData", "[Unit][IO][H5]") {
   }
 }
 
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ComponentStorage",
+                  "[Unit][IO][H5]") {
+  {
+    INFO("Options");
+    const h5::ComponentStorage storage{true, 4, 1.0e-3};
+    CHECK(storage == h5::ComponentStorage{true, 4, 1.0e-3});
+    CHECK(storage != h5::ComponentStorage{false, 4, 1.0e-3});
+    CHECK(storage != h5::ComponentStorage{true, 5, 1.0e-3});
+    CHECK(storage != h5::ComponentStorage{true, 4, std::nullopt});
+    CHECK(h5::ComponentStorage{} ==
+          h5::ComponentStorage{false, 0, std::nullopt});
+    test_serialization(storage);
+    test_copy_semantics(storage);
+    CHECK(TestHelpers::test_creation<h5::ComponentStorage>(
+              "SinglePrecision: true\n"
+              "DeflateLevel: 4\n"
+              "AbsoluteError: 1.0e-3\n") == storage);
+    CHECK(TestHelpers::test_creation<h5::ComponentStorage>(
+              "SinglePrecision: false\n"
+              "DeflateLevel: 0\n"
+              "AbsoluteError: None\n") == h5::ComponentStorage{});
+  }
+
+  const std::string h5_file_name("Unit.IO.H5.VolumeData.ComponentStorage.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+  auto& volume_file =
+      my_file.insert<h5::VolumeData>("/element_data", version_number);
+
+  // Two elements with smooth data, spanning many quantization steps, and data
+  // that cannot be quantized
+  constexpr size_t points_per_element = 125;
+  DataVector smooth_data(2 * points_per_element);
+  for (size_t i = 0; i < smooth_data.size(); ++i) {
+    smooth_data[i] = 3.0 + sin(0.1 * static_cast<double>(i));
+  }
+  DataVector nan_data = smooth_data;
+  nan_data[3] = std::numeric_limits<double>::quiet_NaN();
+  size_t observation_id = 0;
+  const auto write_and_read =
+      [&volume_file, &smooth_data, &nan_data,
+       &observation_id](const h5::ComponentStorage& storage) noexcept {
+        ++observation_id;
+        std::vector<ElementVolumeData> elements{};
+        for (size_t element = 0; element < 2; ++element) {
+          const std::string grid_name = "[[" + std::to_string(element) + "]]";
+          DataVector element_smooth_data(points_per_element);
+          DataVector element_nan_data(points_per_element);
+          for (size_t i = 0; i < points_per_element; ++i) {
+            const size_t point = element * points_per_element + i;
+            element_smooth_data[i] = smooth_data[point];
+            element_nan_data[i] = nan_data[point];
+          }
+          elements.push_back(
+              {{5, 5, 5},
+               {TensorComponent{grid_name + "/Smooth", element_smooth_data},
+                TensorComponent{grid_name + "/WithNan", element_nan_data}},
+               {3, Spectral::Basis::Legendre},
+               {3, Spectral::Quadrature::GaussLobatto}});
+        }
+        volume_file.write_volume_data(observation_id,
+                                      static_cast<double>(observation_id),
+                                      elements, storage);
+        CHECK(volume_file.get_extents(observation_id) ==
+              std::vector<std::vector<size_t>>(2, {5, 5, 5}));
+        return std::make_pair(
+            volume_file.get_tensor_component(observation_id, "Smooth"),
+            volume_file.get_tensor_component(observation_id, "WithNan"));
+      };
+  const auto check_nan_data = [&nan_data](const DataVector& read_nan_data,
+                                          const bool single_precision) {
+    REQUIRE(read_nan_data.size() == nan_data.size());
+    CHECK(std::isnan(read_nan_data[3]));
+    for (size_t i = 0; i < nan_data.size(); ++i) {
+      if (i != 3) {
+        CHECK(read_nan_data[i] ==
+              (single_precision
+                   ? static_cast<double>(static_cast<float>(nan_data[i]))
+                   : nan_data[i]));
+      }
+    }
+  };
+  const DataVector smooth_data_as_float = [&smooth_data]() noexcept {
+    DataVector result(smooth_data.size());
+    for (size_t i = 0; i < smooth_data.size(); ++i) {
+      result[i] = static_cast<float>(smooth_data[i]);
+    }
+    return result;
+  }();
+
+  {
+    INFO("Lossless storage");
+    for (const size_t deflate_level : {0_st, 1_st, 9_st}) {
+      CAPTURE(deflate_level);
+      const auto [read_smooth_data, read_nan_data] =
+          write_and_read(h5::ComponentStorage{false, deflate_level, {}});
+      CHECK(read_smooth_data == smooth_data);
+      check_nan_data(read_nan_data, false);
+    }
+  }
+  {
+    INFO("Single precision");
+    for (const size_t deflate_level : {0_st, 6_st}) {
+      CAPTURE(deflate_level);
+      const auto [read_smooth_data, read_nan_data] =
+          write_and_read(h5::ComponentStorage{true, deflate_level, {}});
+      CHECK(read_smooth_data == smooth_data_as_float);
+      check_nan_data(read_nan_data, true);
+    }
+  }
+  {
+    INFO("Quantized");
+    for (const double absolute_error : {1.0e-1, 1.0e-3, 1.0e-6}) {
+      for (const size_t deflate_level : {0_st, 6_st}) {
+        CAPTURE(absolute_error);
+        CAPTURE(deflate_level);
+        const auto [read_smooth_data, read_nan_data] = write_and_read(
+            h5::ComponentStorage{false, deflate_level, absolute_error});
+        REQUIRE(read_smooth_data.size() == smooth_data.size());
+        for (size_t i = 0; i < smooth_data.size(); ++i) {
+          CHECK(std::abs(read_smooth_data[i] - smooth_data[i]) <=
+                absolute_error + 1.0e-14);
+        }
+        // The minimum is stored exactly
+        CHECK(min(read_smooth_data) == min(smooth_data));
+        // Data that contain non-finite values are not quantized
+        check_nan_data(read_nan_data, false);
+      }
+    }
+    // An error too small to quantize the data into 32 bits stores the data
+    // without quantization
+    const auto [read_smooth_data, read_nan_data] =
+        write_and_read(h5::ComponentStorage{true, 0, 1.0e-20});
+    CHECK(read_smooth_data == smooth_data_as_float);
+    check_nan_data(read_nan_data, true);
+  }
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ContiguousComponents",
+                  "[Unit][IO][H5]") {
+  const std::string h5_file_name(
+      "Unit.IO.H5.VolumeData.ContiguousComponents.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+
+  // Write the same data once with named tensor components and once with the
+  // names given separately, and check that the files hold the same data
+  const std::vector<std::string> component_names{"S", "T_x", "T_y"};
+  const std::vector<std::string> grid_names{"[[2,3]]", "[[5,6]]"};
+  const std::vector<std::vector<size_t>> extents{{2, 2}, {3, 1}};
+  const std::vector<DataVector> components{
+      {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0},
+      {-1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0}};
+  const std::vector<std::vector<Spectral::Basis>> bases{
+      {2, Spectral::Basis::Chebyshev}, {2, Spectral::Basis::Legendre}};
+  const std::vector<std::vector<Spectral::Quadrature>> quadratures{
+      {2, Spectral::Quadrature::Gauss},
+      {2, Spectral::Quadrature::GaussLobatto}};
+
+  std::vector<ElementVolumeData> named_elements{};
+  std::vector<ContiguousElementVolumeData> contiguous_elements{};
+  for (size_t element = 0; element < grid_names.size(); ++element) {
+    const size_t number_of_points = extents[element][0] * extents[element][1];
+    std::vector<TensorComponent> tensor_components{};
+    for (size_t i = 0; i < component_names.size(); ++i) {
+      tensor_components.emplace_back(
+          grid_names[element] + "/" + component_names[i],
+          DataVector{
+              // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+              const_cast<double*>(components[element].data()) +
+                  i * number_of_points,
+              number_of_points});
+    }
+    named_elements.emplace_back(extents[element], std::move(tensor_components),
+                                bases[element], quadratures[element]);
+    contiguous_elements.emplace_back(grid_names[element], extents[element],
+                                     components[element], bases[element],
+                                     quadratures[element]);
+  }
+  my_file.insert<h5::VolumeData>("/named", version_number)
+      .write_volume_data(3, 1.5, named_elements);
+  my_file.close_current_object();
+  my_file.insert<h5::VolumeData>("/contiguous", version_number)
+      .write_volume_data(3, 1.5, component_names, contiguous_elements);
+  my_file.close_current_object();
+
+  const auto& named_file = my_file.get<h5::VolumeData>("/named");
+  const auto named_grid_names = named_file.get_grid_names(3);
+  const auto named_extents = named_file.get_extents(3);
+  const auto named_bases = named_file.get_bases(3);
+  const auto named_quadratures = named_file.get_quadratures(3);
+  std::vector<DataVector> named_components{};
+  for (const auto& name : component_names) {
+    named_components.push_back(named_file.get_tensor_component(3, name));
+  }
+  my_file.close_current_object();
+
+  const auto& contiguous_file = my_file.get<h5::VolumeData>("/contiguous");
+  CHECK(contiguous_file.get_observation_value(3) == 1.5);
+  CHECK(contiguous_file.get_grid_names(3) == grid_names);
+  CHECK(contiguous_file.get_grid_names(3) == named_grid_names);
+  CHECK(contiguous_file.get_extents(3) == extents);
+  CHECK(contiguous_file.get_extents(3) == named_extents);
+  CHECK(contiguous_file.get_bases(3) == named_bases);
+  CHECK(contiguous_file.get_quadratures(3) == named_quadratures);
+  for (size_t i = 0; i < component_names.size(); ++i) {
+    CHECK(contiguous_file.get_tensor_component(3, component_names[i]) ==
+          named_components[i]);
+  }
+  CHECK(contiguous_file.get_tensor_component(3, "T_x") ==
+        DataVector{5.0, 6.0, 7.0, 8.0, -4.0, -5.0, -6.0});
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
 // [[OutputRegex, The expected format of the tensor component names is
 // 'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in]]
 [[noreturn]] SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ComponentFormat0",
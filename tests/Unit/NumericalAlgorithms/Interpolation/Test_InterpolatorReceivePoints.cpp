@@ -231,6 +231,38 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceivePoints",
   // But block_coord_holders should be filled.
   CHECK(vars_info.block_coord_holders == block_logical_coords);
 
+  // An interpolation plan should have been started for the points.
+  const auto& plan = holder.interpolation_plan;
+  CHECK(plan.block_coord_holders == block_logical_coords);
+  CHECK(plan.element_plans.empty());
+  CHECK(vars_info.interpolation_plan_id == plan.id);
+  const size_t first_plan_id = plan.id;
+
+  // The same points at another temporal_id use the same plan.
+  TimeStepId second_temporal_id(true, 0, Time(slab, Rational(12, 15)));
+  runner.simple_action<
+      mock_interpolator<metavars>,
+      intrp::Actions::ReceivePoints<metavars::InterpolationTargetA>>(
+      0, second_temporal_id, block_logical_coords);
+  CHECK(holder.infos.size() == 2);
+  CHECK(holder.infos.at(second_temporal_id).interpolation_plan_id ==
+        first_plan_id);
+  CHECK(plan.id == first_plan_id);
+
+  // Different points reset the plan, which is then no longer used for the
+  // earlier temporal_ids.
+  auto moved_block_logical_coords = block_logical_coords;
+  moved_block_logical_coords.pop_back();
+  TimeStepId third_temporal_id(true, 0, Time(slab, Rational(13, 15)));
+  runner.simple_action<
+      mock_interpolator<metavars>,
+      intrp::Actions::ReceivePoints<metavars::InterpolationTargetA>>(
+      0, third_temporal_id, moved_block_logical_coords);
+  CHECK(plan.id != first_plan_id);
+  CHECK(plan.block_coord_holders == moved_block_logical_coords);
+  CHECK(holder.infos.at(third_temporal_id).interpolation_plan_id == plan.id);
+  CHECK(holder.infos.at(temporal_id).interpolation_plan_id != plan.id);
+
   // There should be no more queued actions; verify this.
   CHECK(runner.is_simple_action_queue_empty<mock_interpolator<metavars>>(0));
 
@@ -8,6 +8,7 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <pup.h>
 #include <string>
 #include <unordered_map>
@@ -36,6 +37,7 @@
 #include "NumericalAlgorithms/Interpolation/InitializeInterpolationTarget.hpp"
 #include "NumericalAlgorithms/Interpolation/InitializeInterpolator.hpp"
 #include "NumericalAlgorithms/Interpolation/InterpolatedVars.hpp"
+#include "NumericalAlgorithms/Interpolation/InterpolatorReceivePoints.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/Interpolation/InterpolatorReceiveVolumeData.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/Interpolation/InterpolatorRegisterElement.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/Interpolation/TryToInterpolate.hpp"
@@ -100,6 +102,10 @@ struct SquareCompute : Square, db::ComputeTag {
 };
 }  // namespace Tags
 
+// The interpolated `Tags::Square` at all target points, in the order of the
+// points, for each call of MockInterpolationTargetReceiveVars.
+std::vector<DataVector> interpolated_squares{};
+
 template <typename InterpolationTargetTag>
 struct MockInterpolationTargetReceiveVars {
   template <typename ParallelComponent, typename DbTags, typename Metavariables,
@@ -115,10 +121,12 @@ struct MockInterpolationTargetReceiveVars {
       const std::vector<std::vector<size_t>>& global_offsets,
       const TemporalId& /*temporal_id*/) noexcept {
     size_t number_of_interpolated_points = 0;
+    DataVector& squares = interpolated_squares.emplace_back(15, 0.0);
     for (size_t i = 0; i < global_offsets.size(); ++i) {
       Scalar<DataVector> expected_vars{global_offsets[i].size()};
       number_of_interpolated_points += global_offsets[i].size();
       for (size_t s = 0; s < global_offsets[i].size(); ++s) {
+        squares[global_offsets[i][s]] = get(get<Tags::Square>(vars_src[i]))[s];
         // Coords at this point. They are the same as the input coordinates,
         // but in strange order because of global_offsets.
         std::array<double, Metavariables::volume_dim> coords{
@@ -234,7 +242,7 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceiveVolumeData",
   const auto domain = domain_creator.create_domain();
   Slab slab(0.0, 1.0);
   TimeStepId temporal_id(true, 0, Time(slab, Rational(11, 15)));
-  auto vars_holders = [&domain, &temporal_id]() {
+  const auto block_logical_coords = [&domain]() {
     const size_t n_pts = 15;
     tnsr::I<DataVector, 3, Frame::Inertial> points(n_pts);
     for (size_t d = 0; d < 3; ++d) {
@@ -242,7 +250,10 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceiveVolumeData",
         points.get(d)[i] = 1.0 + (0.1 + 0.02 * d) * i;  // Chosen by hand.
       }
     }
-    auto coords = block_logical_coordinates(domain, points);
+    return block_logical_coordinates(domain, points);
+  }();
+  auto vars_holders = [&block_logical_coords, &temporal_id]() {
+    auto coords = block_logical_coords;
     typename intrp::Tags::InterpolatedVarsHolders<metavars>::type
         vars_holders_l{};
     auto& vars_infos =
@@ -288,31 +299,41 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceiveVolumeData",
   ActionTesting::set_phase(make_not_null(&runner), metavars::Phase::Testing);
 
   // Create volume data and send it to the interpolator.
-  for (const auto& element_id : element_ids) {
-    const auto& block = domain.blocks()[element_id.block_id()];
-    ::Mesh<3> mesh{domain_creator.initial_extents()[element_id.block_id()],
-                   Spectral::Basis::Legendre,
-                   Spectral::Quadrature::GaussLobatto};
-    if (block.is_time_dependent()) {
-      ERROR("The block must be time-independent");
-    }
-    ElementMap<3, Frame::Inertial> map{element_id,
-                                       block.stationary_map().get_clone()};
-    const auto inertial_coords = map(logical_coordinates(mesh));
-    ::Variables<typename metavars::interpolator_source_vars> output_vars(
-        mesh.number_of_grid_points());
-    auto& lapse = get<gr::Tags::Lapse<DataVector>>(output_vars);
+  const auto send_volume_data =
+      [&domain, &domain_creator, &element_ids, &runner](
+          const TimeStepId& local_temporal_id,
+          const std::unordered_map<ElementId<3>, ::Mesh<3>>&
+              changed_meshes = {}) noexcept {
+        for (const auto& element_id : element_ids) {
+          const auto& block = domain.blocks()[element_id.block_id()];
+          ::Mesh<3> mesh{
+              domain_creator.initial_extents()[element_id.block_id()],
+              Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto};
+          if (changed_meshes.count(element_id) == 1) {
+            mesh = changed_meshes.at(element_id);
+          }
+          if (block.is_time_dependent()) {
+            ERROR("The block must be time-independent");
+          }
+          ElementMap<3, Frame::Inertial> map{
+              element_id, block.stationary_map().get_clone()};
+          const auto inertial_coords = map(logical_coordinates(mesh));
+          ::Variables<typename metavars::interpolator_source_vars> output_vars(
+              mesh.number_of_grid_points());
+          auto& lapse = get<gr::Tags::Lapse<DataVector>>(output_vars);
 
-    // Fill lapse with some analytic solution.
-    get<>(lapse) = 2.0 * get<0>(inertial_coords) +
-                   3.0 * get<1>(inertial_coords) +
-                   5.0 * get<2>(inertial_coords);
+          // Fill lapse with some analytic solution.
+          get<>(lapse) = 2.0 * get<0>(inertial_coords) +
+                         3.0 * get<1>(inertial_coords) +
+                         5.0 * get<2>(inertial_coords);
 
-    // Call the action on each element_id.
-    runner.simple_action<interp_component,
-                         ::intrp::Actions::InterpolatorReceiveVolumeData>(
-        0, temporal_id, element_id, mesh, std::move(output_vars));
-  }
+          // Call the action on each element_id.
+          runner.simple_action<interp_component,
+                               ::intrp::Actions::InterpolatorReceiveVolumeData>(
+              0, local_temporal_id, element_id, mesh, std::move(output_vars));
+        }
+      };
+  send_volume_data(temporal_id);
 
   // Should be no temporal_ids in the target box, since we never
   // put any there.
@@ -335,5 +356,93 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceiveVolumeData",
 
   // No more queued simple actions.
   CHECK(runner.is_simple_action_queue_empty<target_component>(0));
+
+  // Points received with ReceivePoints get an interpolation plan, which is
+  // reused at later temporal_ids with the same points. The points of all
+  // these temporal_ids are received before any volume data, so the plan
+  // stays in use until the last one is interpolated.
+  const std::array<TimeStepId, 4> planned_temporal_ids{
+      {TimeStepId(true, 0, Time(slab, Rational(12, 15))),
+       TimeStepId(true, 0, Time(slab, Rational(13, 15))),
+       TimeStepId(true, 0, Time(slab, Rational(14, 15))),
+       TimeStepId(true, 0, Time(slab, Rational(29, 30)))}};
+  for (const auto& planned_temporal_id : planned_temporal_ids) {
+    runner.simple_action<interp_component,
+                         intrp::Actions::ReceivePoints<
+                             metavars::InterpolationTargetA>>(
+        0, planned_temporal_id, block_logical_coords);
+  }
+  const auto& holder =
+      get<intrp::Vars::HolderTag<metavars::InterpolationTargetA, metavars>>(
+          ActionTesting::get_databox_tag<
+              interp_component, intrp::Tags::InterpolatedVarsHolders<metavars>>(
+              runner, 0));
+  const auto& plan = holder.interpolation_plan;
+  const size_t plan_id = plan.id;
+  for (const auto& planned_temporal_id : planned_temporal_ids) {
+    CHECK(holder.infos.at(planned_temporal_id).interpolation_plan_id ==
+          plan_id);
+  }
+  CHECK(plan.element_plans.empty());
+
+  // The first temporal_id makes a plan for every element, including those
+  // that contain none of the points.
+  send_volume_data(planned_temporal_ids[0]);
+  runner.invoke_queued_simple_action<target_component>(0);
+  CHECK(plan.id == plan_id);
+  REQUIRE(plan.element_plans.size() == element_ids.size());
+  std::optional<ElementId<3>> element_with_points{};
+  for (const auto& [element_id, element_plan] : plan.element_plans) {
+    if (not element_plan.offsets.empty()) {
+      element_with_points = element_id;
+      break;
+    }
+  }
+  REQUIRE(element_with_points.has_value());
+  const auto first_element_plan =
+      plan.element_plans.at(*element_with_points);
+
+  // The second temporal_id reuses the element plans, so it gives the same
+  // values.
+  send_volume_data(planned_temporal_ids[1]);
+  runner.invoke_queued_simple_action<target_component>(0);
+  CHECK(plan.id == plan_id);
+  CHECK(plan.element_plans.size() == element_ids.size());
+  CHECK(plan.element_plans.at(*element_with_points).mesh ==
+        first_element_plan.mesh);
+  CHECK(plan.element_plans.at(*element_with_points).interpolant ==
+        first_element_plan.interpolant);
+  REQUIRE(interpolated_squares.size() == 3);
+  CHECK(interpolated_squares[2] == interpolated_squares[1]);
+
+  // A changed Mesh rebuilds the interpolant of the element.
+  const ::Mesh<3> changed_mesh{8, Spectral::Basis::Legendre,
+                               Spectral::Quadrature::GaussLobatto};
+  REQUIRE(changed_mesh != first_element_plan.mesh);
+  send_volume_data(planned_temporal_ids[2],
+                   {{*element_with_points, changed_mesh}});
+  runner.invoke_queued_simple_action<target_component>(0);
+  CHECK(plan.id == plan_id);
+  CHECK(plan.element_plans.at(*element_with_points).mesh == changed_mesh);
+  CHECK(plan.element_plans.at(*element_with_points).offsets ==
+        first_element_plan.offsets);
+  CHECK(plan.element_plans.at(*element_with_points).interpolant !=
+        first_element_plan.interpolant);
+  REQUIRE(interpolated_squares.size() == 4);
+  Approx custom_approx = Approx::custom().epsilon(1.e-5).scale(1.0);
+  CHECK_ITERABLE_CUSTOM_APPROX(interpolated_squares[3], interpolated_squares[1],
+                               custom_approx);
+
+  // The plan is cleared once the last temporal_id with points is done.
+  send_volume_data(planned_temporal_ids[3],
+                   {{*element_with_points, changed_mesh}});
+  runner.invoke_queued_simple_action<target_component>(0);
+  CHECK(holder.infos.empty());
+  CHECK(plan.element_plans.empty());
+  CHECK(plan.block_coord_holders.empty());
+  REQUIRE(interpolated_squares.size() == 5);
+  CHECK_ITERABLE_CUSTOM_APPROX(interpolated_squares[4], interpolated_squares[1],
+                               custom_approx);
+  CHECK(runner.is_simple_action_queue_empty<target_component>(0));
 }
 }  // namespace
@@ -55,6 +55,8 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/Actions/SetupDataBox.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/AnalyticSolutions/GeneralRelativity/Minkowski.hpp"
@@ -487,6 +489,12 @@ SPECTRE_TEST_CASE(
   CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 1));
   CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 2));
 
+  // The writer buffers the reduction data until it is flushed
+  Parallel::local_synchronous_action<observers::Actions::FlushReductionData>(
+      Parallel::get_parallel_component<obs_writer>(
+          ActionTesting::cache<obs_writer>(runner, 0)),
+      h5_file_prefix);
+
   // By hand compute integral(r^2 d(cos theta) dphi (2x+3y+5z)^2)
   const std::vector<double> expected_integral_a{2432.0 * M_PI / 3.0};
   // SurfaceB has a larger radius by a factor of 2 than SurfaceA,
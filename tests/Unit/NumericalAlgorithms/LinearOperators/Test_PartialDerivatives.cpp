@@ -504,6 +504,23 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.PartialDerivs",
   test_partial_derivatives_3d<two_vars<3>>(mesh_3d);
   test_partial_derivatives_3d<two_vars<3>, one_var<3>>(mesh_3d);
 
+  // On the largest mesh the fused computation of the logical derivatives and
+  // their contraction with the inverse Jacobian is split into several blocks
+  // of components, the last of which is only partially filled.
+  const size_t n_max =
+      Spectral::maximum_number_of_points<Spectral::Basis::Legendre>;
+  const Mesh<3> large_mesh_3d{n_max, Spectral::Basis::Legendre,
+                              Spectral::Quadrature::GaussLobatto};
+  const size_t components_per_block =
+      partial_derivatives_detail::fused_derivatives_block_size /
+      ((3 + 2) * large_mesh_3d.number_of_grid_points());
+  constexpr size_t number_of_components =
+      Variables<two_vars<3>>::number_of_independent_components;
+  CHECK(components_per_block > 0);
+  CHECK(components_per_block < number_of_components);
+  CHECK(number_of_components % components_per_block != 0);
+  test_partial_derivatives_3d<two_vars<3>>(large_mesh_3d);
+
   TestHelpers::db::test_prefix_tag<
       Tags::deriv<Var1<3>, tmpl::size_t<3>, Frame::Grid>>("deriv(Var1)");
   TestHelpers::db::test_prefix_tag<
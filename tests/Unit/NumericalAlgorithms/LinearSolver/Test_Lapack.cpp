@@ -4,6 +4,7 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <vector>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -98,6 +99,57 @@ void test_square_general_matrix_linear_solve(
   CHECK(operator_matrix_copy != operator_matrix);
 }
 
+template <typename Generator>
+void test_batched_lu(const gsl::not_null<Generator*> generator) noexcept {
+  UniformCustomDistribution<size_t> size_dist(2, 6);
+  const size_t matrix_size = size_dist(*generator);
+  const size_t number_of_matrices = size_dist(*generator);
+  UniformCustomDistribution<double> value_dist(0.1, 0.5);
+
+  // column-major matrices stored one after the other
+  std::vector<double> matrices(number_of_matrices * matrix_size * matrix_size);
+  for (size_t i = 0; i < matrices.size(); ++i) {
+    matrices[i] = value_dist(*generator);
+  }
+  for (size_t matrix = 0; matrix < number_of_matrices; ++matrix) {
+    for (size_t i = 0; i < matrix_size; ++i) {
+      matrices[(matrix * matrix_size + i) * matrix_size + i] += 1.0;
+    }
+  }
+  const auto multiply = [&matrices, &matrix_size,
+                         &number_of_matrices](const DataVector& x) noexcept {
+    DataVector result{x.size(), 0.0};
+    for (size_t matrix = 0; matrix < number_of_matrices; ++matrix) {
+      for (size_t column = 0; column < matrix_size; ++column) {
+        for (size_t row = 0; row < matrix_size; ++row) {
+          result[matrix * matrix_size + row] +=
+              matrices[(matrix * matrix_size + column) * matrix_size + row] *
+              x[matrix * matrix_size + column];
+        }
+      }
+    }
+    return result;
+  };
+
+  std::vector<double> factored_matrices = matrices;
+  std::vector<int> pivots(number_of_matrices * matrix_size);
+  CHECK(lapack::batched_lu_factorization(
+            make_not_null(factored_matrices.data()),
+            make_not_null(pivots.data()), matrix_size,
+            number_of_matrices) == 0);
+  // The factorization may be reused for several right-hand sides
+  for (size_t repeat = 0; repeat < 2; ++repeat) {
+    const auto expected_solution = make_with_random_values<DataVector>(
+        generator, make_not_null(&value_dist),
+        number_of_matrices * matrix_size);
+    DataVector solution = multiply(expected_solution);
+    CHECK(lapack::batched_lu_solve(make_not_null(solution.data()),
+                                   factored_matrices.data(), pivots.data(),
+                                   matrix_size, number_of_matrices) == 0);
+    CHECK_ITERABLE_APPROX(solution, expected_solution);
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.Numerical.LinearSolver.Lapack",
                   "[Unit][NumericalAlgorithms][LinearSolver]") {
   MAKE_GENERATOR(gen);
@@ -105,4 +157,8 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearSolver.Lapack",
     INFO("Test general linear solve on invertible square matrix")
     test_square_general_matrix_linear_solve(make_not_null(&gen));
   }
+  {
+    INFO("Test batched LU factorization and solve")
+    test_batched_lu(make_not_null(&gen));
+  }
 }
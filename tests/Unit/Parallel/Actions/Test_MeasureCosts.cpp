@@ -0,0 +1,113 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Parallel/Actions/MeasureCosts.hpp"
+#include "Parallel/Actions/SetupDataBox.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/MeasuredCosts.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace {
+struct StartTime : db::SimpleTag {
+  using type = double;
+};
+
+// Waits until some wall time has passed, so the measured cost is not zero
+struct Work {
+  using simple_tags = tmpl::list<StartTime>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    const double start_time = sys::wall_time();
+    while (sys::wall_time() == start_time) {
+    }
+    db::mutate<StartTime>(
+        make_not_null(&box),
+        [&start_time](const gsl::not_null<double*> t) noexcept {
+          *t = start_time;
+        });
+    return {std::move(box)};
+  }
+};
+
+template <typename Metavariables>
+struct Component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Initialization,
+          tmpl::list<Actions::SetupDataBox,
+                     Parallel::Actions::InitializeMeasuredCosts>>,
+      Parallel::PhaseActions<
+          typename Metavariables::Phase, Metavariables::Phase::Testing,
+          Parallel::Actions::measure_cost<
+              Parallel::CostCategory::PrimitiveRecovery, tmpl::list<Work>>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<Component<Metavariables>>;
+  enum class Phase { Initialization, Testing, Exit };
+};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.Actions.MeasureCosts",
+                  "[Unit][Parallel][Actions]") {
+  using component = Component<Metavariables>;
+  using Parallel::CostCategory;
+  const auto get_costs = [](const auto& runner) noexcept
+      -> const Parallel::MeasuredCosts& {
+    return ActionTesting::get_databox_tag<component,
+                                          Parallel::Tags::MeasuredCosts>(runner,
+                                                                         0);
+  };
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  ActionTesting::emplace_component<component>(&runner, 0);
+  for (size_t i = 0; i < 2; ++i) {
+    runner.next_action<component>(0);
+  }
+  CHECK(get_costs(runner) == Parallel::MeasuredCosts{});
+
+  ActionTesting::set_phase(make_not_null(&runner),
+                           Metavariables::Phase::Testing);
+  const double time_before = sys::wall_time();
+  // StartCostMeasurement
+  runner.next_action<component>(0);
+  CHECK(get_costs(runner).measuring());
+  // Work
+  runner.next_action<component>(0);
+  CHECK(get_costs(runner).cost(CostCategory::PrimitiveRecovery) == 0.);
+  // StopCostMeasurement
+  runner.next_action<component>(0);
+  const double time_after = sys::wall_time();
+  const auto& costs = get_costs(runner);
+  CHECK_FALSE(costs.measuring());
+  CHECK(costs.cost(CostCategory::PrimitiveRecovery) > 0.);
+  CHECK(costs.cost(CostCategory::PrimitiveRecovery) <=
+        time_after - time_before);
+  CHECK(costs.total() == costs.cost(CostCategory::PrimitiveRecovery));
+  CHECK(ActionTesting::get_databox_tag<component, StartTime>(runner, 0) >=
+        time_before);
+}
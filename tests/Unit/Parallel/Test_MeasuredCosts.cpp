@@ -0,0 +1,80 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <string>
+
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/MeasuredCosts.hpp"
+#include "Utilities/GetOutput.hpp"
+
+SPECTRE_TEST_CASE("Unit.Parallel.MeasuredCosts", "[Parallel][Unit]") {
+  using Parallel::CostCategory;
+  CHECK(get_output(CostCategory::VolumeTerms) == "VolumeTerms");
+  CHECK(get_output(CostCategory::BoundaryCorrections) ==
+        "BoundaryCorrections");
+  CHECK(get_output(CostCategory::PrimitiveRecovery) == "PrimitiveRecovery");
+  CHECK(get_output(CostCategory::Observation) == "Observation");
+
+  Parallel::MeasuredCosts costs{};
+  CHECK_FALSE(costs.measuring());
+  CHECK(costs.total() == 0.);
+
+  costs.start(CostCategory::VolumeTerms, 1.);
+  CHECK(costs.measuring());
+  CHECK(costs.cost(CostCategory::VolumeTerms) == 0.);
+  // The measurement survives serialization, e.g. for checkpoints
+  costs = serialize_and_deserialize(costs);
+  costs.stop(CostCategory::VolumeTerms, 3.5);
+  CHECK_FALSE(costs.measuring());
+  CHECK(costs.cost(CostCategory::VolumeTerms) == 2.5);
+
+  costs.start(CostCategory::BoundaryCorrections, 4.);
+  costs.stop(CostCategory::BoundaryCorrections, 5.);
+  costs.start(CostCategory::VolumeTerms, 5.);
+  costs.stop(CostCategory::VolumeTerms, 5.5);
+  CHECK(costs.cost(CostCategory::VolumeTerms) == 3.);
+  CHECK(costs.cost(CostCategory::BoundaryCorrections) == 1.);
+  CHECK(costs.cost(CostCategory::PrimitiveRecovery) == 0.);
+  CHECK(costs.cost(CostCategory::Observation) == 0.);
+  CHECK(costs.total() == 4.);
+  // The time between pausing and resuming the measurement is not counted
+  costs.start(CostCategory::Observation, 6.);
+  costs.pause(6.5);
+  CHECK(costs.measuring());
+  CHECK(costs.cost(CostCategory::Observation) == 0.5);
+  test_serialization(costs);
+  costs.resume(8.);
+  costs.stop(CostCategory::Observation, 8.5);
+  CHECK(costs.cost(CostCategory::Observation) == 1.);
+  CHECK(costs.total() == 5.);
+  test_serialization(costs);
+  CHECK(costs != Parallel::MeasuredCosts{});
+}
+
+// [[OutputRegex, Cannot start measuring the cost of Observation while
+// measuring the cost of VolumeTerms]]
+[[noreturn]] SPECTRE_TEST_CASE("Unit.Parallel.MeasuredCosts.NestedStart",
+                               "[Parallel][Unit]") {
+  ASSERTION_TEST();
+#ifdef SPECTRE_DEBUG
+  Parallel::MeasuredCosts costs{};
+  costs.start(Parallel::CostCategory::VolumeTerms, 0.);
+  costs.start(Parallel::CostCategory::Observation, 1.);
+  ERROR("Failed to trigger ASSERT in an assertion test");
+#endif
+}
+
+// [[OutputRegex, Cannot stop measuring the cost of Observation because it was
+// not started]]
+[[noreturn]] SPECTRE_TEST_CASE("Unit.Parallel.MeasuredCosts.StopWithoutStart",
+                               "[Parallel][Unit]") {
+  ASSERTION_TEST();
+#ifdef SPECTRE_DEBUG
+  Parallel::MeasuredCosts costs{};
+  costs.start(Parallel::CostCategory::VolumeTerms, 0.);
+  costs.stop(Parallel::CostCategory::Observation, 1.);
+  ERROR("Failed to trigger ASSERT in an assertion test");
+#endif
+}
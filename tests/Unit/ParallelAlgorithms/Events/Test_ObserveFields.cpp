@@ -5,11 +5,13 @@
 
 #include <array>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -18,7 +20,6 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
-#include "DataStructures/Tensor/TensorData.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
@@ -26,9 +27,12 @@
 #include "Framework/CheckWithRandomValues.hpp"
 #include "Framework/TestCreation.hpp"
 #include "Framework/TestHelpers.hpp"
+#include "IO/H5/ComponentStorage.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "IO/Observer/VolumeDataSchema.hpp"
 #include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/ArrayIndex.hpp"
@@ -70,15 +74,25 @@ struct ObservationTimeTag : db::SimpleTag {
   using type = double;
 };
 
+const h5::ComponentStorage storage_for_test{true, 4, 1.0e-6};
+constexpr auto storage_creation_string =
+    "\n"
+    "  Storage:\n"
+    "    SinglePrecision: true\n"
+    "    DeflateLevel: 4\n"
+    "    AbsoluteError: 1.0e-6";
+
 struct MockContributeVolumeData {
   struct Results {
     observers::ObservationId observation_id{};
     std::string subfile_name{};
     observers::ArrayComponentId array_component_id{};
-    std::vector<TensorComponent> in_received_tensor_data{};
+    std::string grid_name{};
+    DataVector received_components{};
     std::vector<size_t> received_extents{};
     std::vector<Spectral::Basis> received_basis{};
     std::vector<Spectral::Quadrature> received_quadrature{};
+    h5::ComponentStorage storage{};
   };
   static Results results;
 
@@ -90,20 +104,23 @@ struct MockContributeVolumeData {
                     const observers::ObservationId& observation_id,
                     const std::string& subfile_name,
                     const observers::ArrayComponentId& array_component_id,
-                    std::vector<TensorComponent>&& in_received_tensor_data,
+                    std::string&& grid_name, DataVector&& received_components,
                     const Index<Dim>& received_extents,
                     const std::array<Spectral::Basis, Dim>& received_basis,
                     const std::array<Spectral::Quadrature, Dim>&
-                        received_quadrature) noexcept {
+                        received_quadrature,
+                    const h5::ComponentStorage& storage) noexcept {
     results.observation_id = observation_id;
     results.subfile_name = subfile_name;
     results.array_component_id = array_component_id;
-    results.in_received_tensor_data = in_received_tensor_data;
+    results.grid_name = std::move(grid_name);
+    results.received_components = std::move(received_components);
     results.received_extents.assign(received_extents.indices().begin(),
                                     received_extents.indices().end());
     results.received_basis.assign(received_basis.begin(), received_basis.end());
     results.received_quadrature.assign(received_quadrature.begin(),
                                        received_quadrature.end());
+    results.storage = storage;
   }
 };
 
@@ -138,11 +155,26 @@ struct MockObserverComponent {
                                         tmpl::list<>>>;
 };
 
+template <typename Metavariables>
+struct MockObserverWriterComponent {
+  using component_being_mocked = observers::ObserverWriter<Metavariables>;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockNodeGroupChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      typename Metavariables::Phase, Metavariables::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<
+          db::AddSimpleTags<observers::Tags::VolumeDataSchemas>>>>>;
+};
+
 template <typename System>
 struct Metavariables {
   using system = System;
-  using component_list = tmpl::list<ElementComponent<Metavariables>,
-                                    MockObserverComponent<Metavariables>>;
+  using component_list =
+      tmpl::list<ElementComponent<Metavariables>,
+                 MockObserverComponent<Metavariables>,
+                 MockObserverWriterComponent<Metavariables>>;
   using const_global_cache_tags =
       tmpl::list<Tags::AnalyticSolution<typename System::solution_for_test>>;
   enum class Phase { Initialization, Testing, Exit };
@@ -192,7 +224,8 @@ struct ScalarSystem {
       "  VariablesToObserve: [Scalar]\n";
   static ObserveEvent make_test_object(
       const std::optional<Mesh<volume_dim>>& interpolating_mesh) noexcept {
-    return ObserveEvent{"element_data", {"Scalar"}, interpolating_mesh};
+    return ObserveEvent{"element_data", {"Scalar"}, interpolating_mesh,
+                        storage_for_test};
   }
 };
 
@@ -292,7 +325,7 @@ struct ComplicatedSystem {
       const std::optional<Mesh<volume_dim>>& interpolating_mesh) noexcept {
     return ObserveEvent("element_data",
                         {"Scalar", "Vector", "Tensor", "Tensor2"},
-                        interpolating_mesh);
+                        interpolating_mesh, storage_for_test);
   }
 };
 
@@ -305,6 +338,7 @@ void test_observe(
   using metavariables = Metavariables<System>;
   using element_component = ElementComponent<metavariables>;
   using observer_component = MockObserverComponent<metavariables>;
+  using writer_component = MockObserverWriterComponent<metavariables>;
   static constexpr auto volume_dim = System::volume_dim;
   using coordinates_tag =
       domain::Tags::Coordinates<volume_dim, Frame::Inertial>;
@@ -343,6 +377,9 @@ void test_observe(
   ActionTesting::emplace_component<element_component>(make_not_null(&runner),
                                                       element_id);
   ActionTesting::emplace_group_component<observer_component>(&runner);
+  ActionTesting::emplace_nodegroup_component_and_initialize<writer_component>(
+      &runner, {std::unordered_map<observers::ObservationKey,
+                                   observers::VolumeDataSchema>{}});
 
   const auto box = db::create<db::AddSimpleTags<
       ObservationTimeTag, domain::Tags::Mesh<volume_dim>,
@@ -386,25 +423,39 @@ void test_observe(
   CHECK(std::equal(results.received_quadrature.begin(),
                    results.received_quadrature.end(),
                    interpolating_mesh.value_or(mesh).quadrature().begin()));
+  CHECK(results.storage == storage_for_test);
+  CHECK(results.grid_name == element_name);
+
+  // The names of the tensor components are registered once with the writer
+  const auto& schemas =
+      ActionTesting::get_databox_tag<writer_component,
+                                     observers::Tags::VolumeDataSchemas>(
+          runner, 0);
+  REQUIRE(schemas.size() == 1);
+  const auto& schema =
+      schemas.at(observers::ObservationKey("/element_data.vol"));
+  const size_t number_of_points =
+      interpolating_mesh.value_or(mesh).number_of_grid_points();
+  CHECK(results.received_components.size() ==
+        schema.number_of_components() * number_of_points);
 
   size_t num_components_observed = 0;
-  // gcc 6.4.0 gets confused if we try to capture tensor_data by
-  // reference and fails to compile because it wants it to be
-  // non-const, so we capture a pointer instead.
   const auto check_component =
-      [&element_name, &num_components_observed,
-       tensor_data = &results.in_received_tensor_data, &interpolant](
-          const std::string& component, const DataVector& expected) noexcept {
-        CAPTURE(*tensor_data);
+      [&num_components_observed, &number_of_points, &results, &schema,
+       &interpolant](const std::string& component,
+                     const DataVector& expected) noexcept {
+        CAPTURE(schema);
         CAPTURE(component);
-        const auto it =
-            alg::find_if(*tensor_data, [name = element_name + "/" + component](
-                                           const TensorComponent& tc) noexcept {
-              return tc.name == name;
-            });
-        CHECK(it != tensor_data->end());
-        if (it != tensor_data->end()) {
-          CHECK(it->data == interpolant.interpolate(expected));
+        const auto it = alg::find(schema.component_names(), component);
+        CHECK(it != schema.component_names().end());
+        if (it != schema.component_names().end()) {
+          const auto index = static_cast<size_t>(
+              std::distance(schema.component_names().begin(), it));
+          CHECK(DataVector(
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+                    const_cast<double*>(results.received_components.data()) +
+                        index * number_of_points,
+                    number_of_points) == interpolant.interpolate(expected));
         }
         ++num_components_observed;
       };
@@ -425,7 +476,7 @@ void test_observe(
           check_component(name, get<decltype(tag)>(errors).get(indices...));
         });
   }
-  CHECK(results.in_received_tensor_data.size() == num_components_observed);
+  CHECK(schema.number_of_components() == num_components_observed);
 
   CHECK(observe->needs_evolved_variables());
 }
@@ -450,7 +501,8 @@ void test_system(
       typename System::solution_for_test::vars_for_test>>>;
   Parallel::register_derived_classes_with_charm<EventType>();
   const std::string creation_string =
-      System::creation_string_for_test + mesh_creation_string;
+      System::creation_string_for_test + mesh_creation_string +
+      storage_creation_string;
   const auto factory_event =
       TestHelpers::test_factory_creation<EventType>(creation_string);
   auto serialized_event = serialize_and_deserialize(factory_event);
@@ -577,7 +629,11 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields.bad_field",
   TestHelpers::test_creation<ScalarSystem::ObserveEvent>(
       "SubfileName: VolumeData\n"
       "VariablesToObserve: [NotAVar]\n"
-      "InterpolateToMesh: None");
+      "InterpolateToMesh: None\n"
+      "Storage:\n"
+      "  SinglePrecision: false\n"
+      "  DeflateLevel: 0\n"
+      "  AbsoluteError: None");
 }
 
 // [[OutputRegex, Scalar specified multiple times]]
@@ -587,5 +643,9 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields.repeated_field",
   TestHelpers::test_creation<ScalarSystem::ObserveEvent>(
       "SubfileName: VolumeData\n"
       "VariablesToObserve: [Scalar, Scalar]\n"
-      "InterpolateToMesh: None");
+      "InterpolateToMesh: None\n"
+      "Storage:\n"
+      "  SinglePrecision: false\n"
+      "  DeflateLevel: 0\n"
+      "  AbsoluteError: None");
 }
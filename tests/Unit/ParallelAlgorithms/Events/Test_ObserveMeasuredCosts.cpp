@@ -0,0 +1,204 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/Actions/RegisterEvents.hpp"
+#include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Parallel/MeasuredCosts.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "ParallelAlgorithms/Events/ObserveMeasuredCosts.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Time/Tags.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+namespace observers::Actions {
+struct ContributeReductionData;
+}  // namespace observers::Actions
+
+namespace {
+template <typename Metavariables>
+struct MockContributeReductionData {
+  using ReductionData = tmpl::wrap<
+      tmpl::front<typename Events::ObserveMeasuredCosts<
+          Tags::Time>::observed_reduction_data_tags>,
+      Parallel::ReductionData>;
+  struct Results {
+    observers::ObservationId observation_id;
+    std::string subfile_name;
+    std::vector<std::string> reduction_names;
+    ReductionData reduction_data;
+  };
+
+  static std::optional<Results> results;
+
+  template <typename ParallelComponent, typename... DbTags, typename ArrayIndex>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const observers::ObservationId& observation_id,
+                    observers::ArrayComponentId /*sender_array_id*/,
+                    const std::string& subfile_name,
+                    const std::vector<std::string>& reduction_names,
+                    ReductionData&& reduction_data) noexcept {
+    if (results) {
+      CHECK(results->observation_id == observation_id);
+      CHECK(results->subfile_name == subfile_name);
+      CHECK(results->reduction_names == reduction_names);
+      results->reduction_data.combine(std::move(reduction_data));
+    } else {
+      results.emplace();
+      *results = {observation_id, subfile_name, reduction_names,
+                  std::move(reduction_data)};
+    }
+  }
+};
+
+template <typename Metavariables>
+std::optional<typename MockContributeReductionData<Metavariables>::Results>
+    MockContributeReductionData<Metavariables>::results{};
+
+template <typename Metavariables>
+struct ElementComponent {
+  using component_being_mocked = void;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<typename Metavariables::Phase,
+                                        Metavariables::Phase::Initialization,
+                                        tmpl::list<>>>;
+};
+
+template <typename Metavariables>
+struct MockObserverComponent {
+  using component_being_mocked = observers::Observer<Metavariables>;
+  using replace_these_simple_actions =
+      tmpl::list<observers::Actions::ContributeReductionData>;
+  using with_these_simple_actions =
+      tmpl::list<MockContributeReductionData<Metavariables>>;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockGroupChare;
+  using array_index = int;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<typename Metavariables::Phase,
+                                        Metavariables::Phase::Initialization,
+                                        tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementComponent<Metavariables>,
+                                    MockObserverComponent<Metavariables>>;
+  using const_global_cache_tags = tmpl::list<>;
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+Parallel::MeasuredCosts make_costs(const double volume_terms,
+                                   const double observation) noexcept {
+  Parallel::MeasuredCosts costs{};
+  costs.start(Parallel::CostCategory::VolumeTerms, 0.);
+  costs.stop(Parallel::CostCategory::VolumeTerms, volume_terms);
+  costs.start(Parallel::CostCategory::Observation, 0.);
+  costs.stop(Parallel::CostCategory::Observation, observation);
+  return costs;
+}
+
+template <typename Observer>
+void test_observe(const Observer& observer) noexcept {
+  using element_component = ElementComponent<Metavariables>;
+  using observer_component = MockObserverComponent<Metavariables>;
+
+  auto& results = MockContributeReductionData<Metavariables>::results;
+  results.reset();
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  ActionTesting::emplace_group_component<observer_component>(&runner);
+
+  const double observation_time = 2.0;
+  using tag_list = tmpl::list<Tags::Time, Parallel::Tags::MeasuredCosts>;
+  std::vector<db::compute_databox_type<tag_list>> element_boxes{};
+  for (const auto& [volume_terms, observation] :
+       std::vector<std::pair<double, double>>{{1., 0.5}, {4., 0.5}, {2., 1.}}) {
+    auto box = db::create<tag_list>(observation_time,
+                                    make_costs(volume_terms, observation));
+    const auto ids_to_register =
+        observers::get_registration_observation_type_and_key(observer, box);
+    CHECK(ids_to_register->first == observers::TypeOfObservation::Reduction);
+    CHECK(ids_to_register->second ==
+          observers::ObservationKey("/cost_subfile.dat"));
+    element_boxes.push_back(std::move(box));
+    ActionTesting::emplace_component<element_component>(
+        &runner, element_boxes.size() - 1);
+  }
+
+  for (size_t index = 0; index < element_boxes.size(); ++index) {
+    observer.run(element_boxes[index],
+                 ActionTesting::cache<element_component>(runner, index),
+                 static_cast<element_component::array_index>(index),
+                 std::add_pointer_t<element_component>{});
+  }
+  for (size_t i = 0; i < element_boxes.size(); ++i) {
+    REQUIRE(
+        not runner.template is_simple_action_queue_empty<observer_component>(
+            0));
+    runner.template invoke_queued_simple_action<observer_component>(0);
+  }
+  CHECK(runner.template is_simple_action_queue_empty<observer_component>(0));
+
+  REQUIRE(results);
+  auto& reduction_data = results->reduction_data;
+  reduction_data.finalize();
+  CHECK(results->observation_id.value() == observation_time);
+  CHECK(results->subfile_name == "/cost_subfile");
+  CHECK(results->reduction_names ==
+        std::vector<std::string>{"Time", "NumberOfElements", "VolumeTerms",
+                                 "BoundaryCorrections", "PrimitiveRecovery",
+                                 "Observation", "Total", "MaxElementTotal"});
+  CHECK(std::get<0>(reduction_data.data()) == observation_time);
+  CHECK(std::get<1>(reduction_data.data()) == size_t{3});
+  CHECK(std::get<2>(reduction_data.data()) ==
+        std::vector<double>{7., 0., 0., 2., 9.});
+  CHECK(std::get<3>(reduction_data.data()) == 4.5);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.Events.ObserveMeasuredCosts",
+                  "[Unit][ParallelAlgorithms]") {
+  using EventType = Event<
+      tmpl::list<Events::Registrars::ObserveMeasuredCosts<Tags::Time>>>;
+  Parallel::register_derived_classes_with_charm<EventType>();
+
+  const Events::ObserveMeasuredCosts<Tags::Time> observer("cost_subfile");
+  CHECK_FALSE(observer.needs_evolved_variables());
+  test_observe(observer);
+  test_observe(serialize_and_deserialize(observer));
+
+  const auto event = TestHelpers::test_factory_creation<EventType>(
+      "ObserveMeasuredCosts:\n"
+      "  SubfileName: cost_subfile");
+  test_observe(*event);
+  test_observe(*serialize_and_deserialize(event));
+}
@@ -16,9 +16,12 @@
 #include "IO/H5/Dat.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ReductionActions.hpp"
 #include "NumericalAlgorithms/Convergence/HasConverged.hpp"
 #include "NumericalAlgorithms/Convergence/Tags.hpp"
 #include "Parallel/Actions/SetupDataBox.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
 #include "ParallelAlgorithms/Actions/SetData.hpp"
 #include "ParallelAlgorithms/LinearSolver/AsynchronousSolvers/ElementActions.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
@@ -198,6 +201,11 @@ SPECTRE_TEST_CASE("Unit.ParallelLinearSolver.Asynchronous.ElementActions",
 
   {
     INFO("Reduction observations");
+    // The writer buffers the reduction data until it is flushed
+    Parallel::local_synchronous_action<observers::Actions::FlushReductionData>(
+        Parallel::get_parallel_component<obs_writer>(
+            ActionTesting::cache<obs_writer>(runner, 0)),
+        reduction_file_name);
     REQUIRE(file_system::check_if_file_exists(reduction_file_name + ".h5"));
     {
       const auto reductions_file =
@@ -85,6 +85,8 @@ struct MockElementArray {
       LinearSolver::cg::detail::Tags::InitialHasConverged<TestLinearSolver>,
       LinearSolver::cg::detail::Tags::Alpha<TestLinearSolver>,
       LinearSolver::cg::detail::Tags::ResidualRatioAndHasConverged<
+          TestLinearSolver>,
+      LinearSolver::cg::detail::Tags::PipelinedInnerProductsAndHasConverged<
           TestLinearSolver>>;
 };
 
@@ -312,4 +314,83 @@ SPECTRE_TEST_CASE(
     REQUIRE(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::RelativeResidual);
   }
+
+  SECTION("UpdatePipelinedResidualInFirstIteration") {
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::cg::detail::InitializeResidual<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 9.);
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::cg::detail::UpdatePipelinedResidual<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 0_st, 9., 2.);
+    // The initial residual was already observed and checked for convergence
+    CHECK(get_residual_monitor_tag(residual_square_tag{}) == 9.);
+    CHECK(get_residual_monitor_tag(initial_residual_magnitude_tag{}) == 3.);
+    const auto& element_inbox =
+        get_element_inbox_tag(
+            LinearSolver::cg::detail::Tags::
+                PipelinedInnerProductsAndHasConverged<TestLinearSolver>{})
+            .at(0);
+    CHECK(get<0>(element_inbox) == 9.);
+    CHECK(get<1>(element_inbox) == 2.);
+    CHECK_FALSE(get<2>(element_inbox));
+  }
+
+  SECTION("UpdatePipelinedResidual") {
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::cg::detail::InitializeResidual<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 9.);
+    ActionTesting::invoke_queued_threaded_action<observer_writer>(
+        make_not_null(&runner), 0);
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::cg::detail::UpdatePipelinedResidual<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 1_st, 4., 2.);
+    ActionTesting::invoke_queued_threaded_action<observer_writer>(
+        make_not_null(&runner), 0);
+    // Test residual monitor state
+    CHECK(get_residual_monitor_tag(residual_square_tag{}) == 4.);
+    CHECK(get_residual_monitor_tag(initial_residual_magnitude_tag{}) == 3.);
+    // Test element state
+    const auto& element_inbox =
+        get_element_inbox_tag(
+            LinearSolver::cg::detail::Tags::
+                PipelinedInnerProductsAndHasConverged<TestLinearSolver>{})
+            .at(1);
+    CHECK(get<0>(element_inbox) == 4.);
+    CHECK(get<1>(element_inbox) == 2.);
+    CHECK_FALSE(get<2>(element_inbox));
+    // Test observer writer state
+    CHECK(
+        get_observer_writer_tag(helpers::CheckObservationIdTag{}) ==
+        observers::ObservationId{1, "(anonymous namespace)::TestLinearSolver"});
+    CHECK(get<0>(get_observer_writer_tag(helpers::CheckReductionDataTag{})) ==
+          1);
+    CHECK(get<1>(get_observer_writer_tag(helpers::CheckReductionDataTag{})) ==
+          approx(2.));
+  }
+
+  SECTION("UpdatePipelinedResidualAndConverge") {
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::cg::detail::InitializeResidual<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 1.);
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::cg::detail::UpdatePipelinedResidual<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 2_st, 1., 1.);
+    const auto& has_converged =
+        get<2>(get_element_inbox_tag(
+                   LinearSolver::cg::detail::Tags::
+                       PipelinedInnerProductsAndHasConverged<
+                           TestLinearSolver>{})
+                   .at(2));
+    REQUIRE(has_converged);
+    CHECK(has_converged.reason() == Convergence::Reason::MaxIterations);
+  }
 }
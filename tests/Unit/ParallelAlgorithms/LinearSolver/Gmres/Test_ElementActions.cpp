@@ -207,11 +207,13 @@ void test_element_actions() {
             element_array, LinearSolver::gmres::detail::Tags::
                                FinalOrthogonalization<DummyOptionsGroup>>(
             make_not_null(&runner), 0);
-        const double normalization = 4.;
+        // Projecting out the first basis vector leaves an operand of 1.5
+        const std::vector<double> orthogonalizations{1., 0.};
+        const double normalization = 3.;
         const DenseVector<double> minres{2., 4.};
         CAPTURE(has_converged);
-        inbox[iteration_id] =
-            std::make_tuple(normalization, minres, has_converged);
+        inbox[iteration_id] = std::make_tuple(orthogonalizations, normalization,
+                                              minres, has_converged);
         ActionTesting::next_action<element_array>(make_not_null(&runner), 0);
         REQUIRE(ActionTesting::is_ready<element_array>(runner, 0));
         CHECK_ITERABLE_APPROX(get_tag(operand_tag{}),
@@ -203,10 +203,12 @@ SPECTRE_TEST_CASE(
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
         make_not_null(&runner), 0, 1.);
+    // The projection cancels most of the operand, so the orthogonalization is
+    // repeated
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0_st, 0_st, 2.);
+        make_not_null(&runner), 0, 0_st, 0_st, std::vector<double>{2., 5.});
     // Test residual monitor state
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{})(0, 0) ==
           2.);
@@ -214,7 +216,27 @@ SPECTRE_TEST_CASE(
     CHECK(get_element_inbox_tag(
               LinearSolver::gmres::detail::Tags::Orthogonalization<
                   TestLinearSolver>{})
-              .at(0) == 2.);
+              .at(0) == std::vector<double>{2.});
+    CHECK(get_element_inbox_tag(
+              LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
+                  TestLinearSolver>{})
+              .empty());
+    // The second pass accumulates the projections and completes the
+    // orthogonalization
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 0_st, 1_st, std::vector<double>{0.5, 4.25});
+    // H = [[2.5], [2.]]
+    CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
+          DenseMatrix<double>({{2.5}, {2.}}));
+    const auto& element_inbox =
+        get_element_inbox_tag(
+            LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
+                TestLinearSolver>{})
+            .at(0);
+    CHECK(get<0>(element_inbox) == std::vector<double>{0.5});
+    CHECK(get<1>(element_inbox) == approx(2.));
   }
 
   SECTION("StoreOrthogonalization (final)") {
@@ -228,14 +250,14 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0_st, 0_st, 3.);
+        make_not_null(&runner), 0, 0_st, 0_st, std::vector<double>{3., 13.});
     // Test intermediate residual monitor state
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{})(0, 0) ==
           3.);
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0_st, 1_st, 4.);
+        make_not_null(&runner), 0, 0_st, 1_st, std::vector<double>{0., 4.});
     ActionTesting::invoke_queued_threaded_action<observer_writer>(
         make_not_null(&runner), 0);
     // Test residual monitor state
@@ -250,15 +272,16 @@ SPECTRE_TEST_CASE(
             .at(0);
     // beta = [2., 0.]
     // minres = inv(qr_R(H)) * trans(qr_Q(H)) * beta = [0.4615384615384615]
-    const auto& minres = get<1>(element_inbox);
+    const auto& minres = get<2>(element_inbox);
     CHECK(minres.size() == 1);
     CHECK_ITERABLE_APPROX(minres, DenseVector<double>({0.4615384615384615}));
     // r = beta - H * minres = [0.6153846153846154, -0.923076923076923]
     // |r| = 1.1094003924504583
     const double residual_magnitude = 1.1094003924504583;
-    const auto& has_converged = get<2>(element_inbox);
+    const auto& has_converged = get<3>(element_inbox);
     CHECK_FALSE(has_converged);
-    CHECK(get<0>(element_inbox) == approx(2.));
+    CHECK(get<0>(element_inbox) == std::vector<double>{0.});
+    CHECK(get<1>(element_inbox) == approx(2.));
     // Test observer writer state
     CHECK(
         get_observer_writer_tag(helpers::CheckObservationIdTag{}) ==
@@ -282,11 +305,11 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0_st, 0_st, 1.);
+        make_not_null(&runner), 0, 0_st, 0_st, std::vector<double>{1., 1.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0_st, 1_st, 0.);
+        make_not_null(&runner), 0, 0_st, 1_st, std::vector<double>{0., 0.});
     // Test residual monitor state
     // H = [[1.], [0.]]
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
@@ -299,15 +322,15 @@ SPECTRE_TEST_CASE(
             .at(0);
     // beta = [2., 0.]
     // minres = inv(qr_R(H)) * trans(qr_Q(H)) * beta = [2.]
-    const auto& minres = get<1>(element_inbox);
+    const auto& minres = get<2>(element_inbox);
     CHECK(minres.size() == 1);
     CHECK_ITERABLE_APPROX(minres, DenseVector<double>({2.}));
     // r = beta - H * minres = [0., 0.]
     // |r| = 0.
-    const auto& has_converged = get<2>(element_inbox);
+    const auto& has_converged = get<3>(element_inbox);
     REQUIRE(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::AbsoluteResidual);
-    CHECK(get<0>(element_inbox) == 0.);
+    CHECK(get<1>(element_inbox) == 0.);
   }
 
   SECTION("ConvergeByMaxIterations") {
@@ -316,27 +339,16 @@ SPECTRE_TEST_CASE(
         LinearSolver::gmres::detail::InitializeResidualMagnitude<
             fields_tag, TestLinearSolver, element_array>>(
         make_not_null(&runner), 0, 1.);
-    // Perform 2 mock iterations
-    ActionTesting::simple_action<
-        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
-                              fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0_st, 0_st, 1.);
-    ActionTesting::simple_action<
-        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
-                              fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0_st, 1_st, 4.);
-    ActionTesting::simple_action<
-        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
-                              fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 0_st, 3.);
+    // Perform 2 mock iterations that need no reorthogonalization
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 1_st, 4.);
+        make_not_null(&runner), 0, 0_st, 0_st, std::vector<double>{1., 5.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 1_st, 2_st, 25.);
+        make_not_null(&runner), 0, 1_st, 0_st,
+        std::vector<double>{3., 4., 50.});
     // Test residual monitor state
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
           DenseMatrix<double>({{1., 3.}, {2., 4.}, {0., 5.}}));
@@ -348,13 +360,13 @@ SPECTRE_TEST_CASE(
             .at(1);
     // beta = [1., 0., 0.]
     // minres = inv(qr_R(H)) * trans(qr_Q(H)) * beta = [0.13178295, 0.03100775]
-    const auto& minres = get<1>(element_inbox);
+    const auto& minres = get<2>(element_inbox);
     CHECK(minres.size() == 2);
     CHECK_ITERABLE_APPROX(
         minres, DenseVector<double>({0.1317829457364342, 0.0310077519379845}));
     // r = beta - H * minres = [0.77519, -0.38759, -0.15503]
     // |r| = 0.8804509063256237
-    const auto& has_converged = get<2>(element_inbox);
+    const auto& has_converged = get<3>(element_inbox);
     CHECK(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::MaxIterations);
   }
@@ -368,11 +380,11 @@ SPECTRE_TEST_CASE(
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0_st, 0_st, 3.);
+        make_not_null(&runner), 0, 0_st, 0_st, std::vector<double>{3., 10.});
     ActionTesting::simple_action<
         residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalization<
                               fields_tag, TestLinearSolver, element_array>>(
-        make_not_null(&runner), 0, 0_st, 1_st, 1.);
+        make_not_null(&runner), 0, 0_st, 1_st, std::vector<double>{0., 1.});
     // Test residual monitor state
     // H = [[3.], [1.]]
     CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
@@ -385,13 +397,13 @@ SPECTRE_TEST_CASE(
             .at(0);
     // beta = [2., 0.]
     // minres = inv(qr_R(H)) * trans(qr_Q(H)) * beta = [0.6]
-    const auto& minres = get<1>(element_inbox);
+    const auto& minres = get<2>(element_inbox);
     CHECK(minres.size() == 1);
     CHECK_ITERABLE_APPROX(minres, DenseVector<double>({0.6}));
     // r = beta - H * minres = [0.2, -0.6]
     // |r| = 0.6324555320336759
     // |r| / |r_initial| = 0.31622776601683794
-    const auto& has_converged = get<2>(element_inbox);
+    const auto& has_converged = get<3>(element_inbox);
     REQUIRE(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::RelativeResidual);
   }
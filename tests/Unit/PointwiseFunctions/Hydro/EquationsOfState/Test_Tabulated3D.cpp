@@ -0,0 +1,155 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Informer/InfoFromBuild.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3D.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// The sample table has two points in each dimension.  The values below are
+// the coordinates and the data of the table, with the data indexed as
+// [ye][temp][rho].
+constexpr std::array<double, 2> log_rho{
+    {3.0239960056064277, 3.0573293389397609}};
+constexpr std::array<double, 2> log_temp{{-3.0, -2.9666666666666668}};
+constexpr std::array<double, 2> ye{{0.005, 0.015}};
+constexpr double energy_shift = 317.0;
+constexpr double log_press[2][2][2] = {
+    {{18.000096394732644, 18.033424170052783},
+     {18.033447660355776, 18.066775331565321}},
+    {{17.990459396691801, 18.0237747523636},
+     {18.023852243798054, 18.057168258597677}}};
+constexpr double log_energy[2][2][2] = {
+    {{19.279083431017359, 19.279083430081528},
+     {19.279086019802637, 19.279086018868753}},
+    {{19.273645709972406, 19.273645706932353},
+     {19.273648277270205, 19.273648274167705}}};
+constexpr double cs2[2][2][2] = {
+    {{1577678648549693.8, 1577667221164363.8},
+     {1703576033357332.5, 1703564429793273.2}},
+    {{1543882126488769.0, 1543838596546058.0},
+     {1667202534427290.2, 1667158615466813.5}}};
+
+// Evaluates the trilinear interpolant at the fractional positions `x` within
+// the table
+std::array<double, 3> expected_values(const std::array<double, 3>& x) {
+  double interpolated_log_press = 0.0;
+  double interpolated_log_energy = 0.0;
+  double interpolated_cs2 = 0.0;
+  for (size_t k = 0; k < 2; ++k) {
+    for (size_t j = 0; j < 2; ++j) {
+      for (size_t i = 0; i < 2; ++i) {
+        const double weight = (i == 0 ? 1.0 - x[0] : x[0]) *
+                              (j == 0 ? 1.0 - x[1] : x[1]) *
+                              (k == 0 ? 1.0 - x[2] : x[2]);
+        interpolated_log_press += weight * log_press[k][j][i];
+        interpolated_log_energy += weight * log_energy[k][j][i];
+        interpolated_cs2 += weight * cs2[k][j][i];
+      }
+    }
+  }
+  return {{pow(10.0, interpolated_log_press),
+           pow(10.0, interpolated_log_energy) - energy_shift,
+           interpolated_cs2}};
+}
+
+void check_point(const EquationsOfState::Tabulated3D& eos,
+                 const std::array<double, 3>& rho_temp_ye,
+                 const std::array<double, 3>& x) noexcept {
+  CAPTURE(rho_temp_ye);
+  Scalar<double> pressure{};
+  Scalar<double> specific_internal_energy{};
+  Scalar<double> sound_speed_squared{};
+  eos.pressure_energy_and_sound_speed_squared(
+      make_not_null(&pressure), make_not_null(&specific_internal_energy),
+      make_not_null(&sound_speed_squared), Scalar<double>{rho_temp_ye[0]},
+      Scalar<double>{rho_temp_ye[1]}, Scalar<double>{rho_temp_ye[2]});
+  const auto expected = expected_values(x);
+  CHECK(get(pressure) == approx(expected[0]));
+  CHECK(get(specific_internal_energy) == approx(expected[1]));
+  CHECK(get(sound_speed_squared) == approx(expected[2]));
+}
+
+void test_tabulated_3d(const EquationsOfState::Tabulated3D& eos) noexcept {
+  const std::array<double, 3> lower{
+      {pow(10.0, log_rho[0]), pow(10.0, log_temp[0]), ye[0]}};
+  const std::array<double, 3> upper{
+      {pow(10.0, log_rho[1]), pow(10.0, log_temp[1]), ye[1]}};
+  CHECK_ITERABLE_APPROX(eos.lower_bounds(), lower);
+  CHECK_ITERABLE_APPROX(eos.upper_bounds(), upper);
+
+  // Grid points of the table
+  check_point(eos, lower, {{0.0, 0.0, 0.0}});
+  check_point(eos, upper, {{1.0, 1.0, 1.0}});
+  check_point(eos, {{upper[0], lower[1], upper[2]}}, {{1.0, 0.0, 1.0}});
+
+  // Points inside the table, interpolated in log(rho) and log(T)
+  const std::array<double, 3> x{{0.25, 0.5, 0.75}};
+  const std::array<double, 3> inside{
+      {pow(10.0, log_rho[0] + x[0] * (log_rho[1] - log_rho[0])),
+       pow(10.0, log_temp[0] + x[1] * (log_temp[1] - log_temp[0])),
+       ye[0] + x[2] * (ye[1] - ye[0])}};
+  check_point(eos, inside, x);
+
+  // Points outside the table are clamped to its boundary
+  check_point(eos, {{1.e10, 1.e-5, inside[2]}}, {{1.0, 0.0, x[2]}});
+  check_point(eos, {{1.0, 1.e3, 0.5}}, {{0.0, 1.0, 1.0}});
+
+  // A batched call gives the same result as individual points
+  const DataVector rest_mass_density{lower[0], upper[0], inside[0], 1.e10};
+  const DataVector temperature{lower[1], upper[1], inside[1], 1.e-5};
+  const DataVector electron_fraction{lower[2], upper[2], inside[2], inside[2]};
+  Scalar<DataVector> pressure{};
+  Scalar<DataVector> specific_internal_energy{};
+  Scalar<DataVector> sound_speed_squared{};
+  eos.pressure_energy_and_sound_speed_squared(
+      make_not_null(&pressure), make_not_null(&specific_internal_energy),
+      make_not_null(&sound_speed_squared),
+      Scalar<DataVector>{rest_mass_density}, Scalar<DataVector>{temperature},
+      Scalar<DataVector>{electron_fraction});
+  REQUIRE(get(pressure).size() == rest_mass_density.size());
+  for (size_t s = 0; s < rest_mass_density.size(); ++s) {
+    CAPTURE(s);
+    Scalar<double> point_pressure{};
+    Scalar<double> point_specific_internal_energy{};
+    Scalar<double> point_sound_speed_squared{};
+    eos.pressure_energy_and_sound_speed_squared(
+        make_not_null(&point_pressure),
+        make_not_null(&point_specific_internal_energy),
+        make_not_null(&point_sound_speed_squared),
+        Scalar<double>{rest_mass_density[s]}, Scalar<double>{temperature[s]},
+        Scalar<double>{electron_fraction[s]});
+    CHECK(get(pressure)[s] == get(point_pressure));
+    CHECK(get(specific_internal_energy)[s] ==
+          get(point_specific_internal_energy));
+    CHECK(get(sound_speed_squared)[s] == get(point_sound_speed_squared));
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.PointwiseFunctions.EquationsOfState.Tabulated3D",
+                  "[Unit][EquationsOfState]") {
+  const std::string filename =
+      unit_test_src_path() + "/IO/StellarCollapse2017Sample.h5";
+  const EquationsOfState::Tabulated3D eos{filename, "/"};
+  test_tabulated_3d(eos);
+  test_tabulated_3d(serialize_and_deserialize(eos));
+  test_serialization(eos);
+
+  const auto eos_from_tag =
+      hydro::Tags::TabulatedEquationOfState::create_from_options(
+          filename, "/sample_data");
+  CHECK(eos_from_tag == eos);
+  CHECK_FALSE(eos_from_tag != eos);
+  test_tabulated_3d(eos_from_tag);
+}
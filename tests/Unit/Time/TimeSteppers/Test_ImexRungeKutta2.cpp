@@ -0,0 +1,110 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/Time/TimeSteppers/TimeStepperTestUtils.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/ImexRungeKutta2.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+// Integrates dy/dt = cos(t) - k y over one time unit, where the source -k y
+// is stiff for large k, and returns the largest deviation from the particular
+// solution (k cos(t) + sin(t)) / (k^2 + 1) relative to its amplitude 1/k.
+double imex_error(const ImexTimeStepper& stepper, const double stiffness,
+                  const int32_t num_steps) noexcept {
+  const auto particular_solution = [&stiffness](const double t) noexcept {
+    return (stiffness * cos(t) + sin(t)) / (square(stiffness) + 1.);
+  };
+  const Slab slab(0., 1.);
+  const TimeDelta step_size = slab.duration() / num_steps;
+  TimeStepId time_id(true, 0, slab.start());
+  TimeSteppers::History<double, double> history{2};
+  TimeSteppers::History<double, double> implicit_history{2};
+  double y = particular_solution(0.);
+  double max_error = 0.;
+  for (int32_t i = 0; i < num_steps; ++i) {
+    for (uint64_t substep = 0; substep < stepper.number_of_substeps();
+         ++substep) {
+      const double t = time_id.substep_time().value();
+      history.insert(time_id, y, cos(t));
+      implicit_history.insert(time_id, 0., -stiffness * y);
+      // Apply the substep twice to check that this is allowed
+      stepper.imex_update_u(make_not_null(&y), make_not_null(&history),
+                            make_not_null(&implicit_history), step_size);
+      const double implicit_weight =
+          stepper.imex_update_u(make_not_null(&y), make_not_null(&history),
+                                make_not_null(&implicit_history), step_size);
+      // Solve y - w S(y) = y* for the linear source
+      y /= 1. + implicit_weight * stiffness;
+      time_id = stepper.next_time_id(time_id, step_size);
+    }
+    CHECK(history.size() <= 2);
+    CHECK(implicit_history.size() <= 2);
+    const double t = time_id.step_time().value();
+    max_error = std::max(max_error,
+                         stiffness * std::abs(y - particular_solution(t)));
+  }
+  CHECK(time_id.step_time() == slab.end());
+  return max_error;
+}
+
+void test_imex(const ImexTimeStepper& stepper) noexcept {
+  // Second-order convergence when the source is not stiff
+  const double coarse_error = imex_error(stepper, 1., 20);
+  const double fine_error = imex_error(stepper, 1., 40);
+  CHECK(log2(coarse_error / fine_error) == approx(2.).margin(0.1));
+
+  // The explicit part is unstable for steps larger than 2 / k, but the stiff
+  // source doesn't limit the step size. The relative accuracy of the
+  // equilibrium solution is first order in the step size.
+  for (const double stiffness : {1.e3, 1.e6}) {
+    CAPTURE(stiffness);
+    CHECK(imex_error(stepper, stiffness, 10) < 0.1);
+    CHECK(imex_error(stepper, stiffness, 40) < 0.02);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.ImexRungeKutta2", "[Unit][Time]") {
+  const TimeSteppers::ImexRungeKutta2 stepper{};
+  TimeStepperTestUtils::check_substep_properties(stepper);
+  TimeStepperTestUtils::integrate_test(stepper, 2, 0, 1., 1e-6, true);
+  TimeStepperTestUtils::integrate_test(stepper, 2, 0, -1., 1e-6, true);
+  TimeStepperTestUtils::integrate_test_explicit_time_dependence(stepper, 2, 0,
+                                                                -1.0, 1.0e-9);
+  TimeStepperTestUtils::integrate_error_test(stepper, 2, 0, 1.0, 1.0e-4, 100,
+                                             1.0e-3);
+  TimeStepperTestUtils::integrate_error_test(stepper, 2, 0, -1.0, 1.0e-4, 100,
+                                             1.0e-3);
+  TimeStepperTestUtils::integrate_variable_test(stepper, 2, 0, 1e-6);
+  TimeStepperTestUtils::stability_test(stepper);
+  TimeStepperTestUtils::check_convergence_order(stepper);
+  TimeStepperTestUtils::check_dense_output(stepper);
+  test_imex(stepper);
+
+  CHECK(stepper.order() == 2_st);
+  CHECK(stepper.error_estimate_order() == 1_st);
+
+  TestHelpers::test_factory_creation<TimeStepper>("ImexRungeKutta2");
+  test_serialization(stepper);
+  test_serialization_via_base<TimeStepper, TimeSteppers::ImexRungeKutta2>();
+  test_serialization_via_base<ImexTimeStepper,
+                              TimeSteppers::ImexRungeKutta2>();
+  // test operator !=
+  CHECK_FALSE(stepper != stepper);
+}
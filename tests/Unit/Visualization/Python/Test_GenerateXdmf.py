@@ -4,8 +4,11 @@
 from spectre.Visualization.GenerateXdmf import generate_xdmf
 
 import spectre.Informer as spectre_informer
-import unittest
+import h5py
+import numpy as np
 import os
+import shutil
+import unittest
 
 # For Py2 compatibility
 try:
@@ -39,6 +42,49 @@ class TestGenerateXdmf(unittest.TestCase):
         self.assertTrue(os.path.isfile(output_filename + '.xmf'))
         os.remove(output_filename + '.xmf')
 
+    def test_number_types(self):
+        # Store one component in single precision and add a quantized copy of
+        # it to check that the XDMF describes the data as it is stored
+        source_filename = os.path.join(spectre_informer.unit_test_src_path(),
+                                       'Visualization/Python',
+                                       'VolTestData0.h5')
+        data_file_prefix = os.path.join(
+            spectre_informer.unit_test_build_path(), 'Visualization/Python',
+            'Test_GenerateXdmf_number_types')
+        output_filename = data_file_prefix + '_output'
+        shutil.copyfile(source_filename, data_file_prefix + '0.h5')
+        with h5py.File(data_file_prefix + '0.h5', 'r+') as h5file:
+            for observation in h5file['element_data.vol'].values():
+                values = np.array(observation['Error(Psi)'])
+                del observation['Error(Psi)']
+                observation.create_dataset('Error(Psi)',
+                                           data=values.astype(np.float32))
+                step = 2.0e-3
+                offset = np.min(values)
+                quantized = observation.create_dataset(
+                    'QuantizedError(Psi)',
+                    data=np.round((values - offset) / step).astype(np.uint16))
+                quantized.attrs['quantization_offset'] = offset
+                quantized.attrs['quantization_step'] = step
+
+        generate_xdmf(file_prefix=data_file_prefix,
+                      output=output_filename,
+                      subfile_name="element_data",
+                      start_time=0.,
+                      stop_time=1.,
+                      stride=1,
+                      coordinates='InertialCoordinates')
+
+        with open(output_filename + '.xmf', 'r') as xmf_file:
+            xdmf = xmf_file.read()
+        self.assertIn('NumberType="Float" Precision="8"', xdmf)
+        self.assertIn('NumberType="Float" Precision="4"', xdmf)
+        self.assertIn('NumberType="UShort" Precision="2"', xdmf)
+        self.assertIn('* $0', xdmf)
+        self.assertNotIn('NumberType="Double"', xdmf)
+        os.remove(output_filename + '.xmf')
+        os.remove(data_file_prefix + '0.h5')
+
     def test_subfile_not_found(self):
         data_file_prefix = os.path.join(spectre_informer.unit_test_src_path(),
                                         'Visualization/Python', 'VolTestData')